@@ -17,19 +17,13 @@ void advect_scalar2D(real4d &f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j        = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
-
-  // for (int i=0; i<nx+4; i++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(nz-1,j,i,icrm)=0.0;
-  });
+  auto &mx    = ::adv_mx;
+  auto &mn    = ::adv_mn;
+  auto &uuu   = ::adv_uuu;
+  auto &www   = ::adv_www;
+  auto &iadz  = ::adv_iadz;
+  auto &irho  = ::adv_irho;
+  auto &irhow = ::adv_irhow;
 
   if (dowallx) {
     if (rank%nsubdomains_x == 0) {
@@ -51,11 +45,11 @@ void advect_scalar2D(real4d &f, real2d &flux) {
     }
   }
 
-  if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+  // for (int k=0; k<nzm; k++) {
+  //  for (int i=0; i<nx+5; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    if (nonos && i <= nx+1) {
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int ib=i-1;
@@ -64,13 +58,7 @@ void advect_scalar2D(real4d &f, real2d &flux) {
                      max(f(kc,j,i+offx_s-1,icrm),f(k,j,i+offx_s-1,icrm)))));
       mn(k,j,i,icrm)=min(f(k,j,ib+offx_s-1,icrm),min(f(k,j,ic+offx_s-1,icrm),min(f(kb,j,i+offx_s-1,icrm),
                      min(f(kc,j,i+offx_s-1,icrm),f(k,j,i+offx_s-1,icrm)))));
-    });
-  }// nonos
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+5; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    }
     int kb=max(0,k-1);
     uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(k,j,i-1+offx_s-2,icrm)+
                     min(0.0,u(k,j,i,icrm))*f(k,j,i+offx_s-2,icrm);
@@ -79,18 +67,16 @@ void advect_scalar2D(real4d &f, real2d &flux) {
     }
     if (i == 1) {
       flux(k,icrm) = 0.0;
+      irho(k,icrm) = 1.0/rho(k,icrm);
+      iadz(k,icrm) = 1.0/adz(k,icrm);
+      irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
+    }
+    if (k == nzm-1 && i <= nx+3) {
+      www(nz-1,j,i,icrm) = 0.0;
     }
   });
 
 
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    irho(k,icrm) = 1.0/rho(k,icrm);
-    iadz(k,icrm) = 1.0/adz(k,icrm);
-    irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
-  });
-
   // for (int k=0; k<nzm; k++) {
   //  for (int i=0; i<nx+4; i++) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
@@ -115,7 +101,10 @@ void advect_scalar2D(real4d &f, real2d &flux) {
          across2(dd*(f(kc,j,ib+offx_s-1,icrm)+f(kc,j,i+offx_s-1,icrm)-f(kb,j,ib+offx_s-1,icrm)-f(kb,j,i+offx_s-1,icrm)),
                  u(k,j,i+offx_u-1,icrm), w(k,j,ib+offx_w-1,icrm)+w(kc,j,ib+offx_w-1,icrm)+w(k,j,i+offx_w-1,icrm)+
                  w(kc,j,i+offx_w-1,icrm)) *irho(k,icrm);
-    if (i <= nxp1) {
+    if (i <= nxp1 && k == 0) {
+      // No antidiffusive flux through the bottom
+      www(0,j,i+offx_www-1,icrm) = 0.0;
+    } else if (i <= nxp1) {
       int ic=i+1;
       www(k,j,i+offx_www-1,icrm) = 
          andiff2(f(kb,j,i+offx_s-1,icrm),f(k,j,i+offx_s-1,icrm),w(k,j,i+offx_w-1,icrm),irhow(k,icrm)) -
@@ -125,12 +114,6 @@ void advect_scalar2D(real4d &f, real2d &flux) {
     }
   });
 
-  //  for (int i=0; i<nx+4; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(0,j,i,icrm) = 0.0;
-  });
-
   if (nonos) {
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx+2; i++) {
@@ -140,22 +123,14 @@ void advect_scalar2D(real4d &f, real2d &flux) {
       int kb=max(0,k-1);
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm)=max(f(k,j,ib+offx_s-1,icrm),max(f(k,j,ic+offx_s-1,icrm),max(f(kb,j,i+offx_s-1,icrm),
-                     max(f(kc,j,i+offx_s-1,icrm),max(f(k,j,i+offx_s-1,icrm),mx(k,j,i,icrm))))));
-      mn(k,j,i,icrm)=min(f(k,j,ib+offx_s-1,icrm),min(f(k,j,ic+offx_s-1,icrm),min(f(kb,j,i+offx_s-1,icrm),
-                     min(f(kc,j,i+offx_s-1,icrm),min(f(k,j,i+offx_s-1,icrm),mn(k,j,i,icrm))))));
-    });
-
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(k,j,i+offx_s-1,icrm))/(pn2(uuu(k,j,ic+offx_uuu-1,icrm)) +
+      real mxv=max(f(k,j,ib+offx_s-1,icrm),max(f(k,j,ic+offx_s-1,icrm),max(f(kb,j,i+offx_s-1,icrm),
+               max(f(kc,j,i+offx_s-1,icrm),max(f(k,j,i+offx_s-1,icrm),mx(k,j,i,icrm))))));
+      real mnv=min(f(k,j,ib+offx_s-1,icrm),min(f(k,j,ic+offx_s-1,icrm),min(f(kb,j,i+offx_s-1,icrm),
+               min(f(kc,j,i+offx_s-1,icrm),min(f(k,j,i+offx_s-1,icrm),mn(k,j,i,icrm))))));
+      mx(k,j,i,icrm)=rho(k,icrm)*(mxv-f(k,j,i+offx_s-1,icrm))/(pn2(uuu(k,j,ic+offx_uuu-1,icrm)) +
                      pp2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pn2(www(kc,j,i+offx_www-1,icrm)) +
                      pp2(www(k,j,i+offx_www-1,icrm)))+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(k,j,i+offx_s-1,icrm)-mn(k,j,i,icrm))/(pp2(uuu(k,j,ic+offx_uuu-1,icrm)) +
+      mn(k,j,i,icrm)=rho(k,icrm)*(f(k,j,i+offx_s-1,icrm)-mnv)/(pp2(uuu(k,j,ic+offx_uuu-1,icrm)) +
                      pn2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pp2(www(kc,j,i+offx_www-1,icrm)) +
                      pn2(www(k,j,i+offx_www-1,icrm)))+eps);
     });
@@ -212,19 +187,13 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
-
-  // for (int i=0; i<nx+4; i++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(nz-1,j,i,icrm)=0.0;
-  });
+  auto &mx    = ::adv_mx;
+  auto &mn    = ::adv_mn;
+  auto &uuu   = ::adv_uuu;
+  auto &www   = ::adv_www;
+  auto &iadz  = ::adv_iadz;
+  auto &irho  = ::adv_irho;
+  auto &irhow = ::adv_irhow;
 
   if (dowallx) {
     if (rank%nsubdomains_x == 0) {
@@ -246,11 +215,11 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
     }
   }
 
-  if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+  // for (int k=0; k<nzm; k++) {
+  //  for (int i=0; i<nx+5; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    if (nonos && i <= nx+1) {
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int ib=i-1;
@@ -259,13 +228,7 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
                      max(f(ind_f,kb,j,i+offx_s-1,icrm),max(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
       mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),
                      min(f(ind_f,kb,j,i+offx_s-1,icrm),min(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
-    });
-  }// nonos
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+5; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    }
     int kb=max(0,k-1);
     uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i-1+offx_s-2,icrm)+
                     min(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
@@ -275,18 +238,16 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
     }
     if (i == 1) {
       flux(k,icrm) = 0.0;
+      irho(k,icrm) = 1.0/rho(k,icrm);
+      iadz(k,icrm) = 1.0/adz(k,icrm);
+      irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
+    }
+    if (k == nzm-1 && i <= nx+3) {
+      www(nz-1,j,i,icrm) = 0.0;
     }
   });
 
 
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    irho(k,icrm) = 1.0/rho(k,icrm);
-    iadz(k,icrm) = 1.0/adz(k,icrm);
-    irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
-  });
-
   // for (int k=0; k<nzm; k++) {
   //  for (int i=0; i<nx+4; i++) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
@@ -313,7 +274,10 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
                   f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,kb,j,i+offx_s-1,icrm)),
                   u(k,j,i+offx_u-1,icrm), w(k,j,ib+offx_w-1,icrm)+w(kc,j,ib+offx_w-1,icrm)+
                   w(k,j,i+offx_w-1,icrm)+w(kc,j,i+offx_w-1,icrm)) *irho(k,icrm);
-    if (i <= nxp1) {
+    if (i <= nxp1 && k == 0) {
+      // No antidiffusive flux through the bottom
+      www(0,j,i+offx_www-1,icrm) = 0.0;
+    } else if (i <= nxp1) {
       int ic=i+1;
       www(k,j,i+offx_www-1,icrm) = 
           andiff2(f(ind_f,kb,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),w(k,j,i+offx_w-1,icrm),irhow(k,icrm)) - 
@@ -324,12 +288,6 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
     }
   });
 
-  //  for (int i=0; i<nx+4; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(0,j,i,icrm) = 0.0;
-  });
-
   if (nonos) {
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx+2; i++) {
@@ -339,22 +297,14 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
       int kb=max(0,k-1);
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm)=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),max(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     max(f(ind_f,kc,j,i+offx_s-1,icrm),max(f(ind_f,k,j,i+offx_s-1,icrm),mx(k,j,i,icrm))))));
-      mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     min(f(ind_f,kc,j,i+offx_s-1,icrm),min(f(ind_f,k,j,i+offx_s-1,icrm),mn(k,j,i,icrm))))));
-    });
-
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(ind_f,k,j,i+offx_s-1,icrm))/(pn2(uuu(k,j,ic+offx_uuu-1,icrm)) +
+      real mxv=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),max(f(ind_f,kb,j,i+offx_s-1,icrm),
+               max(f(ind_f,kc,j,i+offx_s-1,icrm),max(f(ind_f,k,j,i+offx_s-1,icrm),mx(k,j,i,icrm))))));
+      real mnv=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
+               min(f(ind_f,kc,j,i+offx_s-1,icrm),min(f(ind_f,k,j,i+offx_s-1,icrm),mn(k,j,i,icrm))))));
+      mx(k,j,i,icrm)=rho(k,icrm)*(mxv-f(ind_f,k,j,i+offx_s-1,icrm))/(pn2(uuu(k,j,ic+offx_uuu-1,icrm)) +
                      pp2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pn2(www(kc,j,i+offx_www-1,icrm)) +
                      pp2(www(k,j,i+offx_www-1,icrm)))+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j,i+offx_s-1,icrm)-mn(k,j,i,icrm))/(pp2(uuu(k,j,ic+offx_uuu-1,icrm)) +
+      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j,i+offx_s-1,icrm)-mnv)/(pp2(uuu(k,j,ic+offx_uuu-1,icrm)) +
                      pn2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pp2(www(kc,j,i+offx_www-1,icrm)) +
                      pn2(www(k,j,i+offx_www-1,icrm)))+eps);
     });
@@ -408,19 +358,13 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
-
-  // for (int i=0; i<nx+4; i++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(nz-1,j,i,icrm)=0.0;
-  });
+  auto &mx    = ::adv_mx;
+  auto &mn    = ::adv_mn;
+  auto &uuu   = ::adv_uuu;
+  auto &www   = ::adv_www;
+  auto &iadz  = ::adv_iadz;
+  auto &irho  = ::adv_irho;
+  auto &irhow = ::adv_irhow;
 
   if (dowallx) {
     if (rank%nsubdomains_x == 0) {
@@ -442,12 +386,11 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     }
   }
 
-  if (nonos) {
-    
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+  // for (int k=0; k<nzm; k++) {
+  //  for (int i=0; i<nx+5; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    if (nonos && i <= nx+1) {
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int ib=i-1;
@@ -456,13 +399,7 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
                      max(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
       mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
                      min(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
-    });
-  }// nonos
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+5; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    }
     int kb=max(0,k-1);
     uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i-1+offx_s-2,icrm)+
                     min(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
@@ -471,18 +408,16 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     }
     if (i == 1) {
       flux(ind_flux,k,icrm) = 0.0;
+      irho(k,icrm) = 1.0/rho(k,icrm);
+      iadz(k,icrm) = 1.0/adz(k,icrm);
+      irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
+    }
+    if (k == nzm-1 && i <= nx+3) {
+      www(nz-1,j,i,icrm) = 0.0;
     }
   });
 
 
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    irho(k,icrm) = 1.0/rho(k,icrm);
-    iadz(k,icrm) = 1.0/adz(k,icrm);
-    irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
-  });
-
   // for (int k=0; k<nzm; k++) {
   //  for (int i=0; i<nx+4; i++) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
@@ -508,7 +443,10 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
                  f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,kb,j,i+offx_s-1,icrm)),
                  u(k,j,i+offx_u-1,icrm), w(k,j,ib+offx_w-1,icrm)+w(kc,j,ib+offx_w-1,icrm)+
                  w(k,j,i+offx_w-1,icrm)+w(kc,j,i+offx_w-1,icrm)) *irho(k,icrm);
-    if (i <= nxp1) {
+    if (i <= nxp1 && k == 0) {
+      // No antidiffusive flux through the bottom
+      www(0,j,i+offx_www-1,icrm) = 0.0;
+    } else if (i <= nxp1) {
       int ic=i+1;
       www(k,j,i+offx_www-1,icrm) = 
          andiff2(f(ind_f,kb,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),w(k,j,i+offx_w-1,icrm),irhow(k,icrm)) - 
@@ -519,12 +457,6 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     }
   });
 
-  //  for (int i=0; i<nx+4; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(0,j,i,icrm) = 0.0;
-  });
-
   if (nonos) {
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx+2; i++) {
@@ -534,22 +466,14 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int kb=max(0,k-1);
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm)=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),max(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     max(f(ind_f,kc,j,i+offx_s-1,icrm),max(f(ind_f,k,j,i+offx_s-1,icrm),mx(k,j,i,icrm))))));
-      mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     min(f(ind_f,kc,j,i+offx_s-1,icrm),min(f(ind_f,k,j,i+offx_s-1,icrm),mn(k,j,i,icrm))))));
-    });
-
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(ind_f,k,j,i+offx_s-1,icrm))/(pn2(uuu(k,j,ic+offx_uuu-1,icrm)) +
+      real mxv=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),max(f(ind_f,kb,j,i+offx_s-1,icrm),
+               max(f(ind_f,kc,j,i+offx_s-1,icrm),max(f(ind_f,k,j,i+offx_s-1,icrm),mx(k,j,i,icrm))))));
+      real mnv=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
+               min(f(ind_f,kc,j,i+offx_s-1,icrm),min(f(ind_f,k,j,i+offx_s-1,icrm),mn(k,j,i,icrm))))));
+      mx(k,j,i,icrm)=rho(k,icrm)*(mxv-f(ind_f,k,j,i+offx_s-1,icrm))/(pn2(uuu(k,j,ic+offx_uuu-1,icrm)) +
                      pp2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pn2(www(kc,j,i+offx_www-1,icrm)) +
                      pp2(www(k,j,i+offx_www-1,icrm)))+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j,i+offx_s-1,icrm)-mn(k,j,i,icrm))/(pp2(uuu(k,j,ic+offx_uuu-1,icrm)) +
+      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j,i+offx_s-1,icrm)-mnv)/(pp2(uuu(k,j,ic+offx_uuu-1,icrm)) +
                      pn2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pp2(www(kc,j,i+offx_www-1,icrm)) +
                      pn2(www(k,j,i+offx_www-1,icrm)))+eps);
     });
@@ -23,22 +23,14 @@ void advect_scalar3D(real4d &f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
-
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny+4; j++) {
-  //     for (int i=0; i<nx+4; i++) {
-  //       for(int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    www(nz-1,j,i,icrm)=0.0;
-  });
+  auto &mx    = ::adv_mx;
+  auto &mn    = ::adv_mn;
+  auto &uuu   = ::adv_uuu;
+  auto &vvv   = ::adv_vvv;
+  auto &www   = ::adv_www;
+  auto &iadz  = ::adv_iadz;
+  auto &irho  = ::adv_irho;
+  auto &irhow = ::adv_irhow;
 
   if (dowallx) {
     if (rank%nsubdomains_x == 0) {
@@ -84,12 +76,12 @@ void advect_scalar3D(real4d &f, real2d &flux) {
     }
   }
 
-  if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny+2; j++) {
-    //     for (int i=0; i<nx+2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny+5; j++) {
+  //     for (int i=0; i<nx+5; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    if (nonos && j <= ny+1 && i <= nx+1) {
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int jb=j-1;
@@ -104,14 +96,7 @@ void advect_scalar3D(real4d &f, real2d &flux) {
            min(f(k,j+offy_s-1,ib+offx_s-1,icrm),min(f(k,j+offy_s-1,ic+offx_s-1,icrm),
            min(f(k,jb+offy_s-1,i+offx_s-1,icrm),min(f(k,jc+offy_s-1,i+offx_s-1,icrm),
            min(f(kb,j+offy_s-1,i+offx_s-1,icrm),min(f(kc,j+offy_s-1,i+offx_s-1,icrm),f(k,j+offy_s-1,i+offx_s-1,icrm)))))));
-    });
-  } 
-
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny+5; j++) {
-  //     for (int i=0; i<nx+5; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    }
     int kb=max(0,k-1);
     if (j <= ny+3){
       uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(k,j+offy_s-2,i-1+offx_s-2,icrm)+
@@ -127,15 +112,13 @@ void advect_scalar3D(real4d &f, real2d &flux) {
     }
     if (i == 0 && j == 0) {
       flux(k,icrm) = 0.0;
+      irho(k,icrm) = 1.0/rho(k,icrm);
+      iadz(k,icrm) = 1.0/adz(k,icrm);
+      irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
+    }
+    if (k == nzm-1 && i <= nx+3 && j <= ny+3) {
+      www(nz-1,j,i,icrm) = 0.0;
     }
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    irho(k,icrm) = 1.0/rho(k,icrm);
-    iadz(k,icrm) = 1.0/adz(k,icrm);
-    irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
   });
 
   // for (int k=0; k<nzm; k++) {
@@ -188,7 +171,10 @@ void advect_scalar3D(real4d &f, real2d &flux) {
                    f(kb,j+offy_s-1,i+offx_s-1,icrm)),v(k,j+offy_v-1,i+offx_v-1,icrm), w(k,jb+offy_w-1,i+offx_w-1,icrm)+
                    w(k,j+offy_w-1,i+offx_w-1,icrm)+w(kc,j+offy_w-1,i+offx_w-1,icrm)+w(kc,jb+offy_w-1,i+offx_w-1,icrm))) *irho(k,icrm);
     }
-    if (i <= nx+1 && j <= ny+1) {
+    if (i <= nx+1 && j <= ny+1 && k == 0) {
+      // No antidiffusive flux through the bottom
+      www(0,j+offy_www-1,i+offx_www-1,icrm) = 0.0;
+    } else if (i <= nx+1 && j <= ny+1) {
       int kb=max(0,k-1);
       int jb=j-1;
       int jc=j+1;
@@ -205,13 +191,6 @@ void advect_scalar3D(real4d &f, real2d &flux) {
     }
   });
 
-  //   for (int j=0; j<ny+4; j++) {
-  //     for (int i=0; i<nx+4; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    www(0,j,i,icrm) = 0.0;
-  });
-
   if (nonos) {
     // for (int k=0; k<nzm; k++) {
     //   for (int j=0; j<ny+2; j++) {
@@ -224,29 +203,19 @@ void advect_scalar3D(real4d &f, real2d &flux) {
       int jc=j+1;
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm) = 
+      real mxv = 
           max(f(k,j+offy_s-1,ib+offx_s-1,icrm),max(f(k,j+offy_s-1,ic+offx_s-1,icrm),max(f(k,jb+offy_s-1,i+offx_s-1,icrm),
           max(f(k,jc+offy_s-1,i+offx_s-1,icrm),max(f(kb,j+offy_s-1,i+offx_s-1,icrm),max(f(kc,j+offy_s-1,i+offx_s-1,icrm),
           max(f(k,j+offy_s-1,i+offx_s-1,icrm),mx(k,j,i,icrm))))))));
-      mn(k,j,i,icrm) = 
+      real mnv = 
           min(f(k,j+offy_s-1,ib+offx_s-1,icrm),min(f(k,j+offy_s-1,ic+offx_s-1,icrm),min(f(k,jb+offy_s-1,i+offx_s-1,icrm),
           min(f(k,jc+offy_s-1,i+offx_s-1,icrm),min(f(kb,j+offy_s-1,i+offx_s-1,icrm),min(f(kc,j+offy_s-1,i+offx_s-1,icrm),
           min(f(k,j+offy_s-1,i+offx_s-1,icrm),mn(k,j,i,icrm))))))));
-    });
-
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny+2; j++) {
-    //     for (int i=0; i<nx+2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int jc=j+1;
-      int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(k,j+offy_s-1,i+offx_s-1,icrm))/
+      mx(k,j,i,icrm)=rho(k,icrm)*(mxv-f(k,j+offy_s-1,i+offx_s-1,icrm))/
                 ( pn3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pp3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
                   pn3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pp3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
                  (pn3(www(kc,j+offy_www-1,i+offx_www-1,icrm)) + pp3(www(k,j+offy_www-1,i+offx_www-1,icrm)))*iadz(k,icrm)+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(k,j+offy_s-1,i+offx_s-1,icrm)-mn(k,j,i,icrm))/
+      mn(k,j,i,icrm)=rho(k,icrm)*(f(k,j+offy_s-1,i+offx_s-1,icrm)-mnv)/
                 ( pp3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pn3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
                   pp3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pn3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
                  (pp3(www(kc,j+offy_www-1,i+offx_www-1,icrm)) + pn3(www(k,j+offy_www-1,i+offx_www-1,icrm)))*iadz(k,icrm)+eps);
@@ -320,22 +289,14 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
-
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny+4; j++) {
-  //     for (int i=0; i<nx+4; i++) {
-  //       for(int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    www(nz-1,j,i,icrm)=0.0;
-  });
+  auto &mx    = ::adv_mx;
+  auto &mn    = ::adv_mn;
+  auto &uuu   = ::adv_uuu;
+  auto &vvv   = ::adv_vvv;
+  auto &www   = ::adv_www;
+  auto &iadz  = ::adv_iadz;
+  auto &irho  = ::adv_irho;
+  auto &irhow = ::adv_irhow;
 
   if (dowallx) {
     if (rank%nsubdomains_x == 0) {
@@ -381,12 +342,12 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
     }
   }
 
-  if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny+2; j++) {
-    //     for (int i=0; i<nx+2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny+5; j++) {
+  //     for (int i=0; i<nx+5; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    if (nonos && j <= ny+1 && i <= nx+1) {
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int jb=j-1;
@@ -401,14 +362,7 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
            min(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),min(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
            min(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),
            min(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)))))));
-    });
-  } 
-
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny+5; j++) {
-  //     for (int i=0; i<nx+5; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    }
     int kb=max(0,k-1);
     if (j <= ny+3){
       uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i-1+offx_s-2,icrm)+
@@ -424,15 +378,13 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
     }
     if (i == 0 && j == 0) {
       flux(k,icrm) = 0.0;
+      irho(k,icrm) = 1.0/rho(k,icrm);
+      iadz(k,icrm) = 1.0/adz(k,icrm);
+      irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
+    }
+    if (k == nzm-1 && i <= nx+3 && j <= ny+3) {
+      www(nz-1,j,i,icrm) = 0.0;
     }
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    irho(k,icrm) = 1.0/rho(k,icrm);
-    iadz(k,icrm) = 1.0/adz(k,icrm);
-    irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
   });
 
   // for (int k=0; k<nzm; k++) {
@@ -485,7 +437,10 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
                    f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm)),v(k,j+offy_v-1,i+offx_v-1,icrm), w(k,jb+offy_w-1,i+offx_w-1,icrm)+
                    w(k,j+offy_w-1,i+offx_w-1,icrm)+w(kc,j+offy_w-1,i+offx_w-1,icrm)+w(kc,jb+offy_w-1,i+offx_w-1,icrm))) *irho(k,icrm);
     }
-    if (i <= nx+1 && j <= ny+1) {
+    if (i <= nx+1 && j <= ny+1 && k == 0) {
+      // No antidiffusive flux through the bottom
+      www(0,j+offy_www-1,i+offx_www-1,icrm) = 0.0;
+    } else if (i <= nx+1 && j <= ny+1) {
       int kb=max(0,k-1);
       int jb=j-1;
       int jc=j+1;
@@ -502,13 +457,6 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
     }
   });
 
-  //   for (int j=0; j<ny+4; j++) {
-  //     for (int i=0; i<nx+4; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    www(0,j,i,icrm) = 0.0;
-  });
-
   if (nonos) {
     // for (int k=0; k<nzm; k++) {
     //   for (int j=0; j<ny+2; j++) {
@@ -521,29 +469,19 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
       int jc=j+1;
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm) = 
+      real mxv = 
           max(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),max(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),max(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),
           max(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),max(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),max(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
           max(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),mx(k,j,i,icrm))))))));
-      mn(k,j,i,icrm) = 
+      real mnv = 
           min(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),min(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),min(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),
           min(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
           min(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),mn(k,j,i,icrm))))))));
-    });
-
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny+2; j++) {
-    //     for (int i=0; i<nx+2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int jc=j+1;
-      int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm))/
+      mx(k,j,i,icrm)=rho(k,icrm)*(mxv-f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm))/
                 ( pn3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pp3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
                   pn3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pp3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
                  (pn3(www(kc,j+offy_www-1,i+offx_www-1,icrm)) + pp3(www(k,j+offy_www-1,i+offx_www-1,icrm)))*iadz(k,icrm)+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)-mn(k,j,i,icrm))/
+      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)-mnv)/
                 ( pp3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pn3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
                   pp3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pn3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
                  (pp3(www(kc,j+offy_www-1,i+offx_www-1,icrm)) + pn3(www(k,j+offy_www-1,i+offx_www-1,icrm)))*iadz(k,icrm)+eps);
@@ -617,22 +555,14 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
-
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny+4; j++) {
-  //     for (int i=0; i<nx+4; i++) {
-  //       for(int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    www(nz-1,j,i,icrm)=0.0;
-  });
+  auto &mx    = ::adv_mx;
+  auto &mn    = ::adv_mn;
+  auto &uuu   = ::adv_uuu;
+  auto &vvv   = ::adv_vvv;
+  auto &www   = ::adv_www;
+  auto &iadz  = ::adv_iadz;
+  auto &irho  = ::adv_irho;
+  auto &irhow = ::adv_irhow;
 
   if (dowallx) {
     if (rank%nsubdomains_x == 0) {
@@ -678,12 +608,12 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     }
   }
 
-  if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny+2; j++) {
-    //     for (int i=0; i<nx+2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny+5; j++) {
+  //     for (int i=0; i<nx+5; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    if (nonos && j <= ny+1 && i <= nx+1) {
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int jb=j-1;
@@ -700,14 +630,7 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
            min(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),
            min(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
                                                           f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)))))));
-    });
-  } 
-
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny+5; j++) {
-  //     for (int i=0; i<nx+5; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    }
     int kb=max(0,k-1);
     if (j <= ny+3){
       uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i-1+offx_s-2,icrm)+
@@ -723,15 +646,13 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     }
     if (i == 0 && j == 0) {
       flux(ind_flux,k,icrm) = 0.0;
+      irho(k,icrm) = 1.0/rho(k,icrm);
+      iadz(k,icrm) = 1.0/adz(k,icrm);
+      irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
+    }
+    if (k == nzm-1 && i <= nx+3 && j <= ny+3) {
+      www(nz-1,j,i,icrm) = 0.0;
     }
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    irho(k,icrm) = 1.0/rho(k,icrm);
-    iadz(k,icrm) = 1.0/adz(k,icrm);
-    irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
   });
 
   // for (int k=0; k<nzm; k++) {
@@ -798,7 +719,10 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
                    w(k,j+offy_w-1,i+offx_w-1,icrm)+w(kc,j+offy_w-1,i+offx_w-1,icrm)+
                    w(kc,jb+offy_w-1,i+offx_w-1,icrm))) *irho(k,icrm);
     }
-    if (i <= nx+1 && j <= ny+1) {
+    if (i <= nx+1 && j <= ny+1 && k == 0) {
+      // No antidiffusive flux through the bottom
+      www(0,j+offy_www-1,i+offx_www-1,icrm) = 0.0;
+    } else if (i <= nx+1 && j <= ny+1) {
       int kb=max(0,k-1);
       int jb=j-1;
       int jc=j+1;
@@ -822,13 +746,6 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     }
   });
 
-  //   for (int j=0; j<ny+4; j++) {
-  //     for (int i=0; i<nx+4; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    www(0,j,i,icrm) = 0.0;
-  });
-
   if (nonos) {
     // for (int k=0; k<nzm; k++) {
     //   for (int j=0; j<ny+2; j++) {
@@ -841,34 +758,24 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int jc=j+1;
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm) = 
+      real mxv = 
           max(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),max(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
           max(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),
           max(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),max(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),
           max(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
           max(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),mx(k,j,i,icrm))))))));
-      mn(k,j,i,icrm) = 
+      real mnv = 
           min(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),min(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
           min(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),
           min(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),
           min(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
           min(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),mn(k,j,i,icrm))))))));
-    });
-
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny+2; j++) {
-    //     for (int i=0; i<nx+2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int jc=j+1;
-      int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm))/
+      mx(k,j,i,icrm)=rho(k,icrm)*(mxv-f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm))/
                 ( pn3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pp3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
                   pn3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pp3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
                  (pn3(www(kc,j+offy_www-1,i+offx_www-1,icrm)) + pp3(www(k,j+offy_www-1,i+offx_www-1,icrm)))
                  *iadz(k,icrm)+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)-mn(k,j,i,icrm))/
+      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)-mnv)/
                 ( pp3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pn3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
                   pp3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pn3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
                  (pp3(www(kc,j+offy_www-1,i+offx_www-1,icrm)) + pn3(www(k,j+offy_www-1,i+offx_www-1,icrm)))
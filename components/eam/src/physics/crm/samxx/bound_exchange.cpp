@@ -1,561 +1,123 @@
 #include "bound_exchange.h"
 
-void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
-  auto &ncrms = ::ncrms;
-
-  real1d buffer("buffer", (nx+ny)*3*nz*ncrms);
-  int i1  = i_1-1;
-  int i2  = i_2-1;
-  int j1  = j_1-1;
-  int j2  = j_2-1;
-  int i1p = i1+1;
-  int i2p = i2+1;
-  int j1p = j1+1;
-  int j2p = j2+1;
-  int offx, offy;
+// The halo of each CRM is filled from its own interior (periodic boundaries). Each
+// halo point is written by exactly one thread, reading an interior point, so all
+// the halo regions (sides and corners) are filled in a single kernel. The halo
+// widths are i_1/j_1 cells to the west/south, and i_2/j_2 cells to the east/north.
 
+static void bound_exchange_offsets(int id, int &offx, int &offy) {
   if        (id==1) {
     offx = offx_u;
     offy = offy_u;
   } else if (id==2) {
     offx = offx_v;
-    offy = offy_v; 
+    offy = offy_v;
   } else if (id==3) {
     offx = offx_w;
-    offy = offy_w; 
+    offy = offy_w;
   } else if (id==4) {
     offx = offx_s;
-    offy = offy_s; 
+    offy = offy_s;
   } else if (id==5) {
     offx = offx_d;
-    offy = offy_d; 
+    offy = offy_d;
   } else {
     std::cout << "Id set in bound_exchange incorrectly:" << std::endl;
     exit(-1);
   }
+}
 
-  if (RUN3D) {
-    //"North" -> "South":
-    //Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=ny-j1-1; j<ny; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = ny-j1-1;
-      int jInd = ny-j1-1+j;
-      int jEnd = ny-1;
-      int n = _IDX(0,ncrms-1,icrm, 0,nx-1,i, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(k,jInd+offy,i+offx,icrm);
-    });
-
-    //Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=-j1-1; j<0; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = -j1-1;
-      int jInd = -j1-1+j;
-      int jEnd = 0-1;
-      int n = _IDX(0,ncrms-1,icrm, 0,nx-1,i, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(k,jInd+offy,i+offx,icrm) = buffer(n);
-    });
-
-    //"North-East" -> "South-West":
-    //Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=ny-j1-1; j<ny; j++) {
-    //     for (int i=nx-i1-1; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = ny-j1-1;
-      int jInd = ny-j1-1+j;
-      int jEnd = ny-1;
-      int iStart = nx-i1-1;
-      int iInd = nx-i1-1+i;
-      int iEnd = nx-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(k,jInd+offy,iInd+offx,icrm);
-    });
-
-    //Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=-j1-1; j<0; j++) {
-    //     for (int i=-i1-1; i<0; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = -j1-1;
-      int jInd = -j1-1+j;
-      int jEnd = 0-1;
-      int iStart = -i1-1;
-      int iInd = -i1-1+i;
-      int iEnd = 0-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(k,jInd+offy,iInd+offx,icrm) = buffer(n);
-    });
-
-    // "South-East" -> "North-West":
-    // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=1-1; j<i+j2; j++) {
-    //     for (int i=nx-i1-1; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = 1-1;
-      int jInd = 1-1+j;
-      int jEnd = 1+j2-1;
-      int iStart = nx-i1-1;
-      int iInd = nx-i1-1+i;
-      int iEnd = nx-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(k,jInd+offy,iInd+offx,icrm);
-    });
-
-    // Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=nyp1-1; j<nyp1+j2; j++) {
-    //     for (int i=-i1-1; i<0; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = nyp1-1;
-      int jInd = nyp1-1+j;
-      int jEnd = nyp1+j2-1;
-      int iStart = -i1-1;
-      int iInd = -i1-1+i;
-      int iEnd = 0-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(k,jInd+offy,iInd+offx,icrm) = buffer(n);
-    });
-
-    // "South" -> "North":
-    // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<1+j2; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = 1-1;
-      int jInd = 1-1+j;
-      int jEnd = 1+j2-1;
-      int n = _IDX(0,ncrms-1,icrm, 0,nx-1,i, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(k,jInd+offy,i+offx,icrm);
-    });
-
-    // Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=nyp1-1; j<nyp1+j2; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = nyp1-1;
-      int jInd = nyp1-1+j;
-      int jEnd = nyp1+j2-1;
-      int n = _IDX(0,ncrms-1,icrm, 0,nx-1,i, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(k,jInd+offy,i+offx,icrm) = buffer(n);
-    });
-
-    // "South-West" -> "North-East":
-    // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<1+j2; j++) {
-    //     for (int i=0; i<1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = 1-1;
-      int jInd = 1-1+j;
-      int jEnd = 1+j2-1;
-      int iStart = 1-1;
-      int iInd = 1-1+i;
-      int iEnd = 1+i2-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(k,jInd+offy,iInd+offx,icrm);
-    });
-
-    // Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=nyp1-1; j<nyp1+j2; j++) {
-    //     for (int i=nxp1-1; i<nxp1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = nyp1-1;
-      int jInd = nyp1-1+j;
-      int jEnd = nyp1+j2-1;
-      int iStart = nxp1-1;
-      int iInd = nxp1-1+i;
-      int iEnd = nxp1+i2-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(k,jInd+offy,iInd+offx,icrm) = buffer(n);
-    });
-    
-    // To "North-West" -> "South-East":
-    // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=ny-j1-1; j<ny; j++) {
-    //     for (int i=0; i<1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = ny-j1-1;
-      int jInd = ny-j1-1+j;
-      int jEnd = ny-1;
-      int iStart = 1-1;
-      int iInd = 1-1+i;
-      int iEnd = 1+i2-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(k,jInd+offy,iInd+offx,icrm);
-    });
-
-    //Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=-j1-1; j<0; j++) {
-    //     for (int i=nxp1-1; i<nxp1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = -j1-1;
-      int jInd = -j1-1+j;
-      int jEnd = 0-1;
-      int iStart = nxp1-1;
-      int iInd = nxp1-1+i;
-      int iEnd = nxp1+i2-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(k,jInd+offy,iInd+offx,icrm) = buffer(n);
-    });
-     
-  } //Endif for run3d
-
-  //  "East" -> "West":
-  // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=nx-i1-1; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int iStart = nx-i1-1;
-    int iInd = nx-i1-1+i;
-    int iEnd = nx-1;
-    int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, 0,ny-1,j, 0,dimz-1,k);
-    buffer(n) = f(k,j+offy,iInd+offx,icrm);
-  });
-  
-  //Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=-i1-1; i<0; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int iStart = -i1-1;
-    int iInd = -i1-1+i;
-    int iEnd = 0-1;
-    int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, 0,ny-1,j, 0,dimz-1,k);
-    f(k,j+offy,iInd+offx,icrm) = buffer(n);
-  });
-
-  // "West" -> "East":
-  // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=0; i<1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int iStart = 1-1;
-    int iInd = 1-1+i;
-    int iEnd = 1+i2-1;
-    int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, 0,ny-1,j, 0,dimz-1,k);
-    buffer(n) = f(k,j+offy,iInd+offx,icrm);
-  });
-
-  //Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=nxp1-1; i<nxp1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int iStart = nxp1-1;
-    int iInd = nxp1-1+i;
-    int iEnd = nxp1+i2-1;
+void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
+  auto &ncrms = ::ncrms;
 
-    int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, 0,ny-1,j, 0,dimz-1,k);
-    f(k,j+offy,iInd+offx,icrm) = buffer(n);
+  int offx, offy;
+  bound_exchange_offsets(id,offx,offy);
+
+  // No exchange in the y direction for 2D runs
+  int jw1 = RUN3D ? j_1 : 0;
+  int jw2 = RUN3D ? j_2 : 0;
+  int nhalo = (jw1+jw2)*(nx+i_1+i_2) + ny*(i_1+i_2);
+
+  // for (int k=0; k<dimz; k++) {
+  //   for (int n=0; n<nhalo; n++) {
+  //     for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(dimz,nhalo,ncrms) , YAKL_LAMBDA (int k, int n, int icrm) {
+    int j, i;
+    halo_index(n,i_1,i_2,jw1,j,i);
+    int jsrc = periodic_index(j,ny);
+    int isrc = periodic_index(i,nx);
+    f(k,j+offy,i+offx,icrm) = f(k,jsrc+offy,isrc+offx,icrm);
   });
-
 }
 
 void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
   auto &ncrms = ::ncrms;
 
-  real1d buffer("buffer", (nx+ny)*3*nz*ncrms);
-  int i1  = i_1-1;
-  int i2  = i_2-1;
-  int j1  = j_1-1;
-  int j2  = j_2-1;
-  int i1p = i1+1;
-  int i2p = i2+1;
-  int j1p = j1+1;
-  int j2p = j2+1;
   int offx, offy;
-
-  if        (id==1) {
-    offx = offx_u;
-    offy = offy_u;
-  } else if (id==2) {
-    offx = offx_v;
-    offy = offy_v; 
-  } else if (id==3) {
-    offx = offx_w;
-    offy = offy_w; 
-  } else if (id==4) {
-    offx = offx_s;
-    offy = offy_s; 
-  } else if (id==5) {
-    offx = offx_d;
-    offy = offy_d; 
-  } else {
-    std::cout << "Id set in bound_exchange incorrectly:" << std::endl;
-    exit(-1);
-  }
-
-  if (RUN3D) {
-    //"North" -> "South":
-    //Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=ny-j1-1; j<ny; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = ny-j1-1;
-      int jInd = ny-j1-1+j;
-      int jEnd = ny-1;
-      int n = _IDX(0,ncrms-1,icrm, 0,nx-1,i, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(offL,k,jInd+offy,i+offx,icrm);
-    });
-
-    //Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=-j1-1; j<0; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = -j1-1;
-      int jInd = -j1-1+j;
-      int jEnd = 0-1;
-      int n = _IDX(0,ncrms-1,icrm, 0,nx-1,i, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(offL,k,jInd+offy,i+offx,icrm) = buffer(n);
-    });
-
-    //"North-East" -> "South-West":
-    //Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=ny-j1-1; j<ny; j++) {
-    //     for (int i=nx-i1-1; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = ny-j1-1;
-      int jInd = ny-j1-1+j;
-      int jEnd = ny-1;
-      int iStart = nx-i1-1;
-      int iInd = nx-i1-1+i;
-      int iEnd = nx-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(offL,k,jInd+offy,iInd+offx,icrm);
-    });
-
-    //Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=-j1-1; j<0; j++) {
-    //     for (int i=-i1-1; i<0; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = -j1-1;
-      int jInd = -j1-1+j;
-      int jEnd = 0-1;
-      int iStart = -i1-1;
-      int iInd = -i1-1+i;
-      int iEnd = 0-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(offL,k,jInd+offy,iInd+offx,icrm) = buffer(n);
-    });
-
-    // "South-East" -> "North-West":
-    // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=1-1; j<i+j2; j++) {
-    //     for (int i=nx-i1-1; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = 1-1;
-      int jInd = 1-1+j;
-      int jEnd = 1+j2-1;
-      int iStart = nx-i1-1;
-      int iInd = nx-i1-1+i;
-      int iEnd = nx-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(offL,k,jInd+offy,iInd+offx,icrm);
-    });
-
-    // Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=nyp1-1; j<nyp1+j2; j++) {
-    //     for (int i=-i1-1; i<0; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = nyp1-1;
-      int jInd = nyp1-1+j;
-      int jEnd = nyp1+j2-1;
-      int iStart = -i1-1;
-      int iInd = -i1-1+i;
-      int iEnd = 0-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(offL,k,jInd+offy,iInd+offx,icrm) = buffer(n);
-    });
-
-    // "South" -> "North":
-    // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<1+j2; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = 1-1;
-      int jInd = 1-1+j;
-      int jEnd = 1+j2-1;
-      int n = _IDX(0,ncrms-1,icrm, 0,nx-1,i, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(offL,k,jInd+offy,i+offx,icrm);
-    });
-
-    // Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=nyp1-1; j<nyp1+j2; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = nyp1-1;
-      int jInd = nyp1-1+j;
-      int jEnd = nyp1+j2-1;
-      int n = _IDX(0,ncrms-1,icrm, 0,nx-1,i, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(offL,k,jInd+offy,i+offx,icrm) = buffer(n);
-    });
-
-    // "South-West" -> "North-East":
-    // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<1+j2; j++) {
-    //     for (int i=0; i<1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = 1-1;
-      int jInd = 1-1+j;
-      int jEnd = 1+j2-1;
-      int iStart = 1-1;
-      int iInd = 1-1+i;
-      int iEnd = 1+i2-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(offL,k,jInd+offy,iInd+offx,icrm);
-    });
-
-    // Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=nyp1-1; j<nyp1+j2; j++) {
-    //     for (int i=nxp1-1; i<nxp1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j2p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = nyp1-1;
-      int jInd = nyp1-1+j;
-      int jEnd = nyp1+j2-1;
-      int iStart = nxp1-1;
-      int iInd = nxp1-1+i;
-      int iEnd = nxp1+i2-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(offL,k,jInd+offy,iInd+offx,icrm) = buffer(n);
-    });
-    
-    // To "North-West" -> "South-East":
-    // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=ny-j1-1; j<ny; j++) {
-    //     for (int i=0; i<1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = ny-j1-1;
-      int jInd = ny-j1-1+j;
-      int jEnd = ny-1;
-      int iStart = 1-1;
-      int iInd = 1-1+i;
-      int iEnd = 1+i2-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      buffer(n) = f(offL,k,jInd+offy,iInd+offx,icrm);
-    });
-
-    //Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=-j1-1; j<0; j++) {
-    //     for (int i=nxp1-1; i<nxp1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(dimz,j1p,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      int jStart = -j1-1;
-      int jInd = -j1-1+j;
-      int jEnd = 0-1;
-      int iStart = nxp1-1;
-      int iInd = nxp1-1+i;
-      int iEnd = nxp1+i2-1;
-      int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, jStart,jEnd,jInd, 0,dimz-1,k);
-      f(offL,k,jInd+offy,iInd+offx,icrm) = buffer(n);
-    });
-     
-  } //Endif for run3d
-
-  //  "East" -> "West":
-  // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=nx-i1-1; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int iStart = nx-i1-1;
-    int iInd = nx-i1-1+i;
-    int iEnd = nx-1;
-    int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, 0,ny-1,j, 0,dimz-1,k);
-    buffer(n) = f(offL,k,j+offy,iInd+offx,icrm);
-  });
-  
-  //Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=-i1-1; i<0; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i1p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int iStart = -i1-1;
-    int iInd = -i1-1+i;
-    int iEnd = 0-1;
-    int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, 0,ny-1,j, 0,dimz-1,k);
-    f(offL,k,j+offy,iInd+offx,icrm) = buffer(n);
-  });
-
-  // "West" -> "East":
-  // Pack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=0; i<1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int iStart = 1-1;
-    int iInd = 1-1+i;
-    int iEnd = 1+i2-1;
-    int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, 0,ny-1,j, 0,dimz-1,k);
-    buffer(n) = f(offL,k,j+offy,iInd+offx,icrm);
+  bound_exchange_offsets(id,offx,offy);
+
+  // No exchange in the y direction for 2D runs
+  int jw1 = RUN3D ? j_1 : 0;
+  int jw2 = RUN3D ? j_2 : 0;
+  int nhalo = (jw1+jw2)*(nx+i_1+i_2) + ny*(i_1+i_2);
+
+  // for (int k=0; k<dimz; k++) {
+  //   for (int n=0; n<nhalo; n++) {
+  //     for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(dimz,nhalo,ncrms) , YAKL_LAMBDA (int k, int n, int icrm) {
+    int j, i;
+    halo_index(n,i_1,i_2,jw1,j,i);
+    int jsrc = periodic_index(j,ny);
+    int isrc = periodic_index(i,nx);
+    f(offL,k,j+offy,i+offx,icrm) = f(offL,k,jsrc+offy,isrc+offx,icrm);
   });
+}
 
-  //Unpack
-    // for (int k=0; k<dimz; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=nxp1-1; i<nxp1+i2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(dimz,ny,i2p,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int iStart = nxp1-1;
-    int iInd = nxp1-1+i;
-    int iEnd = nxp1+i2-1;
+// Exchange t and the advected sgs and microphysics fields in a single kernel. They
+// are all scalars, so they share the same offsets and halo widths.
+void bound_exchange_scalars(int i_1, int i_2, int j_1, int j_2) {
+  auto &t           = ::t;
+  auto &sgs_field   = ::sgs_field;
+  auto &micro_field = ::micro_field;
+  auto &ncrms       = ::ncrms;
+
+  // List of fields to exchange: 0 is t, then 1+l for sgs field l, and
+  // 1+nsgs_fields+l for micro field l
+  SArray<int,1,1+nsgs_fields+nmicro_fields> flds;
+  int nflds = 0;
+  flds(nflds++) = 0;
+  if (dosgs && advect_sgs) {
+    for (int l=0; l<nsgs_fields; l++) {
+      flds(nflds++) = 1+l;
+    }
+  }
+  for (int l=0; l<nmicro_fields; l++) {
+    if (l == index_water_vapor || (docloud && flag_precip(l)!=1) || (doprecip && flag_precip(l)==1)) {
+      flds(nflds++) = 1+nsgs_fields+l;
+    }
+  }
 
-    int n = _IDX(0,ncrms-1,icrm, iStart,iEnd,iInd, 0,ny-1,j, 0,dimz-1,k);
-    f(offL,k,j+offy,iInd+offx,icrm) = buffer(n);
+  // No exchange in the y direction for 2D runs
+  int jw1 = RUN3D ? j_1 : 0;
+  int jw2 = RUN3D ? j_2 : 0;
+  int nhalo = (jw1+jw2)*(nx+i_1+i_2) + ny*(i_1+i_2);
+
+  // for (int ifld=0; ifld<nflds; ifld++) {
+  //   for (int k=0; k<nzm; k++) {
+  //     for (int n=0; n<nhalo; n++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nflds,nzm,nhalo,ncrms) , YAKL_LAMBDA (int ifld, int k, int n, int icrm) {
+    int j, i;
+    halo_index(n,i_1,i_2,jw1,j,i);
+    int jsrc = periodic_index(j,ny);
+    int isrc = periodic_index(i,nx);
+    int l = flds(ifld);
+    if (l == 0) {
+      t(k,j+offy_s,i+offx_s,icrm) = t(k,jsrc+offy_s,isrc+offx_s,icrm);
+    } else if (l <= nsgs_fields) {
+      sgs_field(l-1,k,j+offy_s,i+offx_s,icrm) = sgs_field(l-1,k,jsrc+offy_s,isrc+offx_s,icrm);
+    } else {
+      micro_field(l-1-nsgs_fields,k,j+offy_s,i+offx_s,icrm) = micro_field(l-1-nsgs_fields,k,jsrc+offy_s,isrc+offx_s,icrm);
+    }
   });
-
 }
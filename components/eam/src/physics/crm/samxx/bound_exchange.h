@@ -6,13 +6,33 @@
 
 void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int id);
 void bound_exchange(real5d &f, int offL, int dimz, int i_1, int i_2, int j_1, int j_2, int id);
+void bound_exchange_scalars(int i_1, int i_2, int j_1, int j_2);
 
-YAKL_INLINE int constexpr _IDX(int const l1, int const u1, int const i1, int const l2, int const u2, 
-                               int const i2, int const l3, int const u3, int const i3, int const l4, 
-                               int const u4, int const i4) {
-  return ( ((i4)-(l4))*((u3)-(l3)+1)*((u2)-(l2)+1)*((u1)-(l1)+1) + 
-           ((i3)-(l3))              *((u2)-(l2)+1)*((u1)-(l1)+1) + 
-           ((i2)-(l2))                            *((u1)-(l1)+1) + 
-           ((i1)-(l1)) );
+// The CRM domain is periodic and not decomposed, so every halo point is a copy of
+// an interior point of the same CRM. The halo points are enumerated as: the j_1
+// full rows to the south, then the i_1+i_2 halo points of each of the ny interior
+// rows, then the j_2 full rows to the north. Given the index n of a halo point,
+// this returns its (j,i) indices relative to the interior, which start at 0.
+YAKL_INLINE void halo_index(int const n, int const i_1, int const i_2, int const j_1,
+                            int &j, int &i) {
+  int const nxh = nx+i_1+i_2;
+  int const nxb = i_1+i_2;
+  if (n < j_1*nxh) {
+    j = n/nxh - j_1;
+    i = n%nxh - i_1;
+  } else if (n < j_1*nxh + ny*nxb) {
+    int const m = n - j_1*nxh;
+    int const r = m%nxb;
+    j = m/nxb;
+    i = r < i_1 ? r-i_1 : nx+r-i_1;
+  } else {
+    int const m = n - j_1*nxh - ny*nxb;
+    j = ny + m/nxh;
+    i = m%nxh - i_1;
+  }
 }
 
+// Periodic image of index i in [0,n)
+YAKL_INLINE int periodic_index(int const i, int const n) {
+  return i < 0 ? i+n : (i >= n ? i-n : i);
+}
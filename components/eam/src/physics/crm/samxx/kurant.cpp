@@ -16,9 +16,9 @@ void kurant () {
   int constexpr max_ncycle = 4;
   real cfl;
 
-  real2d wm    ("wm"   ,nz ,ncrms);
-  real2d uhm   ("uhm"  ,nz ,ncrms);
-  real2d tmpMax("uhMax",nzm,ncrms);
+  auto &wm      = ::kurant_wm;
+  auto &uhm     = ::kurant_uhm;
+  auto &tmpMax  = ::kurant_tmpmax;
 
   ncycle = 1;
   parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
@@ -66,6 +66,10 @@ void kurant () {
 
   kurant_sgs(cfl);
 
+  // All CRMs take the same number of subcycles: the time step (dtn, dt3,
+  // dtfactor), the Adams-Bashforth coefficients and the na/nb/nc time levels
+  // are shared by all CRMs. Letting a CRM take fewer subcycles would need
+  // those per CRM, and a mask of the active CRMs in every kernel of timeloop.
   ncycle = max(ncycle,max(1,static_cast<int>(ceil(cfl/0.7))));
 
 #ifdef MMF_FIXED_SUBCYCLE
@@ -52,19 +52,8 @@ void periodic(int flag) {
     bound_exchange(u,nzm,2,3,2,2, 1);
     bound_exchange(v,nzm,2,2,2,3, 2);
     bound_exchange(w,nz,2,2,2,2, 3);
-    bound_exchange(t,nzm,3,3,3,3, 4);
-
-    for (int i=0; i<nsgs_fields; i++) {
-      if (dosgs && advect_sgs) {
-        bound_exchange(sgs_field,i,nzm,3,3,3,3, 4);
-      }
-    }
-
-    for (int i=0; i<nmicro_fields; i++) {
-      if (i == index_water_vapor || (docloud && flag_precip(i)!=1) || (doprecip && flag_precip(i)==1)) {
-        bound_exchange(micro_field,i,nzm,3,3,3,3, 4);
-      }
-    }
+    // t, sgs_field and micro_field
+    bound_exchange_scalars(3,3,3,3);
 #ifdef MMF_ESMT
     bound_exchange(u_esmt, nzm, 3, 3, 3, 3, 4);
     bound_exchange(v_esmt, nzm, 3, 3, 3, 3, 4);
@@ -72,18 +61,8 @@ void periodic(int flag) {
   }
 
   if (flag == 3) {
-    bound_exchange(t,nzm,1,1,1,1, 4);
-    for (int i=0; i<nsgs_fields; i++) {
-      if (dosgs && advect_sgs) {
-        bound_exchange(sgs_field,i,nzm,1,1,1,1, 4);
-      }
-    }
-
-    for (int i=0; i<nmicro_fields; i++) {
-      if ( i==index_water_vapor || (docloud && flag_precip(i)!=1) || (doprecip && flag_precip(i)==1)) {
-          bound_exchange(micro_field,i,nzm,1,1,1,1, 4);
-      }
-    }
+    // t, sgs_field and micro_field
+    bound_exchange_scalars(1,1,1,1);
 #ifdef MMF_ESMT
     bound_exchange(u_esmt, nzm, 1, 1, 1, 1, 4);
     bound_exchange(v_esmt, nzm, 1, 1, 1, 1, 4);
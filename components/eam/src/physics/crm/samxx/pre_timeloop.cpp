@@ -502,4 +502,7 @@ void pre_timeloop() {
     crm_accel_nstop(nstop);  // reduce nstop by factor of (1 + crm_accel_factor)
   }
 
+  // Geometry dependent setup of the pressure solver
+  pressure_init();
+
 }
@@ -1,15 +1,103 @@
 
 #include "pressure.h"
 
-void pressure() {
-  auto &p             = :: p;
+// The vertical solve below assumes the whole column is in a single pressure slab
+static_assert(nsubdomains == 1, "pressure() assumes that nzslab == nzm");
+
+// FFT plans (twiddle factors), computed once in pressure_init()
+yakl::RealFFT1D<nx> press_fftx;
+yakl::RealFFT1D<press_ffty_size> press_ffty;
+
+// Everything in the Poisson solve that only depends on the CRM geometry: the FFT
+// twiddle factors, the horizontal eigenvalues, and the coefficients of the vertical
+// tridiagonal systems. Called once per crm() call, after pre_timeloop() sets up
+// the grid and the reference density profiles.
+void pressure_init() {
+  auto &rho           = :: rho;
   auto &rhow          = :: rhow;
   auto &adz           = :: adz;
   auto &adzw          = :: adzw;
   auto &dz            = :: dz;
   auto &dx            = :: dx;
   auto &dy            = :: dy;
-  auto &rho           = :: rho;
+  auto &a             = :: press_a;
+  auto &c             = :: press_c;
+  auto &eign          = :: press_eign;
+  auto &alfa          = :: press_alfa;
+  auto &e             = :: press_e;
+  auto &ncrms         = :: ncrms;
+
+  int nypp = RUN2D ? 1 : ny+2;
+
+  #ifndef USE_ORIG_FFT
+    press_fftx.init(press_fftx.trig);
+    press_ffty.init(press_ffty.trig);
+  #endif
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    a(k,icrm)=rhow(k,icrm)/(adz(k,icrm)*adzw(k,icrm)*dz(icrm)*dz(icrm));
+    c(k,icrm)=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
+  });
+
+  //   for (int j=0; j<nypp; j++) {
+  //     for (int i=0; i<nx+1; i++) {
+  parallel_for( SimpleBounds<2>(nypp,nx+1) , YAKL_LAMBDA (int j, int i) {
+    int jt = 0;
+    int it = 0;
+
+    real ddx2=1.0/(dx*dx);
+    real ddy2=1.0/(dy*dy);
+    real pii = 3.14159265358979323846;
+    real xnx=pii/nx;
+    real xny=pii/ny;
+    int jd=((j+1)+jt-0.1)/2.0;
+    real facty = 2.0;
+    real xj=jd;
+    int id=((i+1)+it-0.1)/2.0;
+    real factx = 2.0;
+    real xi=id;
+    eign(j,i)=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
+  });
+
+  // LU factorization (Thomas algorithm) of the vertical tridiagonal system of each
+  // wavenumber and CRM. The matrix does not depend on the right hand side, so only
+  // the forward and back substitutions are left to do in pressure(). e holds the
+  // inverse of the pivots, except at the top level, where it holds the pivot itself
+  // so that pressure() divides by it like the original solver did.
+  // for (int j=0; j<nypp; j++) {
+  //  for (int i=0; i<nx+1; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nypp,nx+1,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    int jt = 0;
+    int it = 0;
+    int jd=((j+1)+jt-0.1)/2.0;
+    int id=((i+1)+it-0.1)/2.0;
+    if(id+jd == 0) {
+      e(0,j,i,icrm)=1.0/(eign(j,i)*rho(0,icrm)-a(0,icrm)-c(0,icrm));
+    }
+    else {
+      e(0,j,i,icrm)=1.0/(eign(j,i)*rho(0,icrm)-c(0,icrm));
+    }
+    alfa(0,j,i,icrm)=-c(0,icrm)*e(0,j,i,icrm);
+
+    for(int k=1; k<nzm-1; k++) {
+      e(k,j,i,icrm)=1.0/(eign(j,i)*rho(k,icrm)-a(k,icrm)-c(k,icrm)+a(k,icrm)*alfa(k-1,j,i,icrm));
+      alfa(k,j,i,icrm)=-c(k,icrm)*e(k,j,i,icrm);
+    }
+    e(nzm-1,j,i,icrm)=eign(j,i)*rho(nzm-1,icrm)-a(nzm-1,icrm)+a(nzm-1,icrm)*alfa(nzm-2,j,i,icrm);
+  });
+}
+
+void pressure() {
+  auto &p             = :: p;
+  auto &f             = :: press_f;
+  auto &a             = :: press_a;
+  auto &alfa          = :: press_alfa;
+  auto &e             = :: press_e;
+  auto &fftx          = :: press_fftx;
+  auto &ffty          = :: press_ffty;
   auto &ncrms         = :: ncrms;
 
   int npressureslabs = nsubdomains;
@@ -18,24 +106,8 @@ void pressure() {
   int ny2 = ny+2*YES3D;
   int constexpr n3i=3*nx_gl/2+1;
   int constexpr n3j=3*ny_gl/2+1;
-  int constexpr fftySize = ny > 4 ? ny : 4;
-
-  real4d f ("f" , nzslab, ny2, nx2, ncrms);
-  real4d ff("ff", nzm,ny2,nx+1,ncrms);
-  real2d a ("a" , nzm, ncrms);
-  real2d c ("c" , nzm, ncrms);
-
-  int iwall = 0;
-  int nypp, jwall;
-
-  if (RUN2D) {
-    nypp = 1;
-    jwall = 0;
-  } else {
-    nypp = ny+2;
-  }
 
-  real2d eign("eign",nypp,nx+1);
+  int nypp = RUN2D ? 1 : ny+2;
 
   press_rhs();
 
@@ -49,11 +121,6 @@ void pressure() {
 
   #ifndef USE_ORIG_FFT
 
-    yakl::RealFFT1D<nx> fftx;
-    yakl::RealFFT1D<fftySize> ffty;
-    fftx.init(fftx.trig);
-    ffty.init(ffty.trig);
-
     // for (int k=0; k<nzslab; k++) {
     //  for (int j=0; j<ny; j++) {
     //      for (int icrm=0; icrm<ncrms; icrm++) {
@@ -124,85 +191,24 @@ void pressure() {
 
   #endif
 
-  // for(int k=0; k<nzslab; k++) {
-  //  for(int j=0; j<nypp; j++) {
-  //    for(int i=0; i<nx+1; i++) {
-  //      for(int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    ff(k,j,i,icrm) = f(k,j,i,icrm);
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    a(k,icrm)=rhow(k,icrm)/(adz(k,icrm)*adzw(k,icrm)*dz(icrm)*dz(icrm));
-    c(k,icrm)=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
-  });
-
-  //   for (int j=0; j<nypp; j++) {
-  //     for (int i=0; i<nx+1; i++) {
-  parallel_for( SimpleBounds<2>(nypp,nx+1) , YAKL_LAMBDA (int j, int i) {
-    int jt = 0;
-    int it = 0;
-
-    real ddx2=1.0/(dx*dx);
-    real ddy2=1.0/(dy*dy);
-    real pii = 3.14159265358979323846;
-    real xnx=pii/nx;
-    real xny=pii/ny;
-    int jd=((j+1)+jt-0.1)/2.0;
-    real facty = 2.0;
-    real xj=jd;
-    int id=((i+1)+it-0.1)/2.0;
-    real factx = 2.0;
-    real xi=id;
-    eign(j,i)=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
-  });
-
+  // Solve the vertical tridiagonal systems, using the factorization computed in
+  // pressure_init(). There is a single vertical slab (nzslab == nzm), so the solve is
+  // done in place in f, batched over all the wavenumbers and CRMs. beta is stored in
+  // f during the forward substitution.
   // for (int j=0; j<nypp; j++) {
   //  for (int i=0; i<nx+1; i++) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(nypp,nx+1,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
-    SArray<real,1,nzm-1> alfa;
-    SArray<real,1,nzm-1> beta;
-
-    int jt = 0;
-    int it = 0;
-    int jd=((j+1)+jt-0.1)/2.0;
-    int id=((i+1)+it-0.1)/2.0;
-    real b;
-    if(id+jd == 0) {
-      b=1.0/(eign(j,i)*rho(0,icrm)-a(0,icrm)-c(0,icrm));
-      alfa(0)=-c(0,icrm)*b;
-      beta(0)=ff(0,j,i,icrm)*b;
-    }
-    else {
-      b=1.0/(eign(j,i)*rho(0,icrm)-c(0,icrm));
-      alfa(0)=-c(0,icrm)*b;
-      beta(0)=ff(0,j,i,icrm)*b;
-    }
-
-    real e;
+    f(0,j,i,icrm)=f(0,j,i,icrm)*e(0,j,i,icrm);
     for(int k=1; k<nzm-1; k++) {
-      e=1.0/(eign(j,i)*rho(k,icrm)-a(k,icrm)-c(k,icrm)+a(k,icrm)*alfa(k-1));
-      alfa(k)=-c(k,icrm)*e;
-      beta(k)=(ff(k,j,i,icrm)-a(k,icrm)*beta(k-1))*e;
+      f(k,j,i,icrm)=(f(k,j,i,icrm)-a(k,icrm)*f(k-1,j,i,icrm))*e(k,j,i,icrm);
     }
-    ff(nzm-1,j,i,icrm)=(ff(nzm-1,j,i,icrm)-a(nzm-1,icrm)*beta(nzm-2))/
-                       (eign(j,i)*rho(nzm-1,icrm)-a(nzm-1,icrm)+a(nzm-1,icrm)*alfa(nzm-2));
+    f(nzm-1,j,i,icrm)=(f(nzm-1,j,i,icrm)-a(nzm-1,icrm)*f(nzm-2,j,i,icrm))/e(nzm-1,j,i,icrm);
     for(int k=nzm-2; k>=0; k--) {
-      ff(k,j,i,icrm)=alfa(k)*ff(k+1,j,i,icrm)+beta(k);
+      f(k,j,i,icrm)=alfa(k,j,i,icrm)*f(k+1,j,i,icrm)+f(k,j,i,icrm);
     }
   });
 
-  // for (int k=0; k<nzslab; k++) {
-  //   for (int j=0; j<nypp; j++) {
-  //     for (int i=0; i<nx+1; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    f(k,j,i,icrm) = ff(k,j,i,icrm);
-  });
-
   #ifndef USE_ORIG_FFT
 
     if (RUN3D) {
@@ -10,5 +10,11 @@
 extern "C" void fftfax_crm(int n, int *ifax, real *trigs);
 extern "C" void fft991_crm(real *a, real *work, real *trigs, int *ifax, int inc, int jump, int n, int lot, int isign);
 
+int constexpr press_ffty_size = ny > 4 ? ny : 4;
+
+extern yakl::RealFFT1D<nx> press_fftx;
+extern yakl::RealFFT1D<press_ffty_size> press_ffty;
+
+void pressure_init();
 void pressure();
 
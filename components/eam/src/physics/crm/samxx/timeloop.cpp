@@ -19,7 +19,9 @@ void timeloop() {
     //  Check if the dynamical time step should be decreased
     //  to handle the cases when the flow being locally linearly unstable
     //------------------------------------------------------------------
+    samxx_timer_start("kurant");
     kurant();
+    samxx_timer_stop("kurant");
 
     for(int icyc=1; icyc<=ncycle; icyc++) {
       icycle = icyc;
@@ -39,11 +41,15 @@ void timeloop() {
 
       //---------------------------------------------
       //    initialize stuff:
+      samxx_timer_start("zero");
       zero();
+      samxx_timer_stop("zero");
 
       //-----------------------------------------------------------
       //       Buoyancy term:
+      samxx_timer_start("buoyancy");
       buoyancy();
+      samxx_timer_stop("buoyancy");
 
       //-----------------------------------------------------------
       // variance transport forcing
@@ -54,7 +60,9 @@ void timeloop() {
 
       //------------------------------------------------------------
       //       Large-scale and surface forcing:
+      samxx_timer_start("forcing");
       forcing();
+      samxx_timer_stop("forcing");
 
       // Apply radiative tendency
       // for (int k=0; k<nzm; k++) {
@@ -76,41 +84,57 @@ void timeloop() {
       //---------------------------------------------------------
       //   Ice fall-out
       if (docloud) { 
+        samxx_timer_start("ice_fall");
         ice_fall();
+        samxx_timer_stop("ice_fall");
       }
 
       //----------------------------------------------------------
       //     Update scalar boundaries after large-scale processes:
+      samxx_timer_start("boundaries");
       boundaries(3);
+      samxx_timer_stop("boundaries");
 
       //---------------------------------------------------------
       //     Update boundaries for velocities:
+      samxx_timer_start("boundaries");
       boundaries(0);
+      samxx_timer_stop("boundaries");
 
       //-----------------------------------------------
       //     surface fluxes:
       if (dosurface) {
+        samxx_timer_start("crmsurface");
         crmsurface(bflx);
+        samxx_timer_stop("crmsurface");
       }
 
       //-----------------------------------------------------------
       //  SGS physics:
       if (dosgs) {
+        samxx_timer_start("sgs_proc");
         sgs_proc();
+        samxx_timer_stop("sgs_proc");
       }
 
       //----------------------------------------------------------
       //     Fill boundaries for SGS diagnostic fields:
+      samxx_timer_start("boundaries");
       boundaries(4);
+      samxx_timer_stop("boundaries");
 
       //-----------------------------------------------
       //       advection of momentum:
+      samxx_timer_start("advect_mom");
       advect_mom();
+      samxx_timer_stop("advect_mom");
 
       //----------------------------------------------------------
       //  SGS effects on momentum:
       if (dosgs) { 
+        samxx_timer_start("sgs_mom");
         sgs_mom();
+        samxx_timer_stop("sgs_mom");
       }
 
 #ifdef MMF_ESMT
@@ -125,33 +149,47 @@ void timeloop() {
 
       //---------------------------------------------------------
       //       compute rhs of the Poisson equation and solve it for pressure.
+      samxx_timer_start("pressure");
       pressure();
+      samxx_timer_stop("pressure");
 
       //---------------------------------------------------------
       //       find velocity field at n+1/2 timestep needed for advection of scalars:
       //  Note that at the end of the call, the velocities are in nondimensional form.
+      samxx_timer_start("adams");
       adams();
+      samxx_timer_stop("adams");
 
       //----------------------------------------------------------
       //     Update boundaries for all prognostic scalar fields for advection:
+      samxx_timer_start("boundaries");
       boundaries(2);
+      samxx_timer_stop("boundaries");
 
       //---------------------------------------------------------
       //      advection of scalars :
+      samxx_timer_start("advect_all_scalars");
       advect_all_scalars();
+      samxx_timer_stop("advect_all_scalars");
 
       //-----------------------------------------------------------
       //    Convert velocity back from nondimensional form:
+      samxx_timer_start("uvw");
       uvw();
+      samxx_timer_stop("uvw");
 
       //----------------------------------------------------------
       //     Update boundaries for scalars to prepare for SGS effects:
+      samxx_timer_start("boundaries");
       boundaries(3);
+      samxx_timer_stop("boundaries");
 
       //---------------------------------------------------------
       //      SGS effects on scalars :
       if (dosgs) { 
+        samxx_timer_start("sgs_scalars");
         sgs_scalars();
+        samxx_timer_stop("sgs_scalars");
       }
 
       //-----------------------------------------------------------
@@ -160,7 +198,9 @@ void timeloop() {
       //-----------------------------------------------------------
       //       Cloud condensation/evaporation and precipitation processes:
       if (docloud || dosmoke) {
+        samxx_timer_start("micro_proc");
         micro_proc();
+        samxx_timer_stop("micro_proc");
       }
 
       //-----------------------------------------------------------
@@ -173,7 +213,9 @@ void timeloop() {
 
       //-----------------------------------------------------------
       //    Compute diagnostics fields:
+      samxx_timer_start("diagnose");
       diagnose();
+      samxx_timer_stop("diagnose");
 
       //----------------------------------------------------------
       // Rotate the dynamic tendency arrays for Adams-bashforth scheme:
@@ -25,6 +25,7 @@
 #include "pressure.h"
 #include "scalar_momentum.h"
 #include "crm_variance_transport.h"
+#include "timing.h"
 
 void timeloop();
 
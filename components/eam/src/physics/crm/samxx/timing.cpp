@@ -0,0 +1,42 @@
+
+#include "timing.h"
+#include <chrono>
+#include <map>
+#include <string>
+
+struct SamxxTimer {
+  std::chrono::steady_clock::time_point start;
+  double total = 0;
+  long   count = 0;
+};
+
+std::map<std::string,SamxxTimer> samxx_timers;
+
+void samxx_timer_start(char const *name) {
+#ifdef MMF_SAMXX_TIMERS
+  yakl::fence();
+  samxx_timers[name].start = std::chrono::steady_clock::now();
+#endif
+}
+
+void samxx_timer_stop(char const *name) {
+#ifdef MMF_SAMXX_TIMERS
+  yakl::fence();
+  auto &timer = samxx_timers[name];
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - timer.start;
+  timer.total += elapsed.count();
+  timer.count += 1;
+#endif
+}
+
+extern "C" void samxx_timers_print() {
+  if (samxx_timers.empty()) { return; }
+  std::cout << "samxx timers:" << std::endl;
+  std::cout << std::setw(24) << std::left << "  routine" << std::right
+            << std::setw(14) << "total (s)" << std::setw(10) << "calls" << std::setw(16) << "per call (s)" << std::endl;
+  for (auto const &it : samxx_timers) {
+    std::cout << "  " << std::setw(22) << std::left << it.first << std::right << std::scientific << std::setprecision(4)
+              << std::setw(14) << it.second.total << std::setw(10) << it.second.count
+              << std::setw(16) << it.second.total / it.second.count << std::endl;
+  }
+}
@@ -0,0 +1,13 @@
+
+#pragma once
+
+#include "samxx_const.h"
+
+// Wall clock timers for the main routines of the CRM time loop, accumulated over all
+// the crm() calls. Timing a routine requires a fence before and after it, so the
+// timers only do something when samxx is built with -DMMF_SAMXX_TIMERS.
+void samxx_timer_start(char const *name);
+void samxx_timer_stop (char const *name);
+
+// Print the accumulated times of all the timers
+extern "C" void samxx_timers_print();
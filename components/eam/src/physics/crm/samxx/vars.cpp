@@ -188,6 +188,27 @@ void allocate() {
   cloudtoptemp     = real3d( "cloudtoptemp    "           , ny         , nx     , ncrms ); 
   crm_clear_rh_cnt = int2d(  "crm_clear_rh_cnt"                        , nzm    , ncrms );
 
+  // Scratch space for the per-step routines, allocated once per crm() call
+  int nzslab = max(1,nzm/nsubdomains);
+  int nypp   = RUN2D ? 1 : ny+2;
+  press_f          = real4d( "press_f        "     , nzslab, ny+2*YES3D, nx+2  , ncrms );
+  press_a          = real2d( "press_a        "                        , nzm    , ncrms );
+  press_c          = real2d( "press_c        "                        , nzm    , ncrms );
+  press_eign       = real2d( "press_eign     "                  , nypp   , nx+1         );
+  press_alfa       = real4d( "press_alfa     "     , nzm   , nypp      , nx+1  , ncrms );
+  press_e          = real4d( "press_e        "     , nzm   , nypp      , nx+1  , ncrms );
+  kurant_wm        = real2d( "kurant_wm      "                        , nz     , ncrms );
+  kurant_uhm       = real2d( "kurant_uhm     "                        , nz     , ncrms );
+  kurant_tmpmax    = real2d( "kurant_tmpmax  "                        , nzm    , ncrms );
+  adv_mx           = real4d( "adv_mx         "     , nzm , ny+2*YES3D , nx+2   , ncrms );
+  adv_mn           = real4d( "adv_mn         "     , nzm , ny+2*YES3D , nx+2   , ncrms );
+  adv_uuu          = real4d( "adv_uuu        "     , nzm , ny+4*YES3D , nx+5   , ncrms );
+  adv_vvv          = real4d( "adv_vvv        "     , nzm , ny+5*YES3D , nx+4   , ncrms );
+  adv_www          = real4d( "adv_www        "     , nz  , ny+4*YES3D , nx+4   , ncrms );
+  adv_iadz         = real2d( "adv_iadz       "                        , nzm    , ncrms );
+  adv_irho         = real2d( "adv_irho       "                        , nzm    , ncrms );
+  adv_irhow        = real2d( "adv_irhow      "                        , nzm    , ncrms );
+
   t_vt             = real2d( "t_vt           "                        , nzm    , ncrms ); 
   q_vt             = real2d( "q_vt           "                        , nzm    , ncrms ); 
   t_vt_tend        = real2d( "t_vt_tend      "                        , nzm    , ncrms ); 
@@ -652,6 +673,23 @@ void finalize() {
   echotopheight    = real3d();
   cloudtoptemp     = real3d();
   crm_clear_rh_cnt = int2d();
+  press_f          = real4d();
+  press_a          = real2d();
+  press_c          = real2d();
+  press_eign       = real2d();
+  press_alfa       = real4d();
+  press_e          = real4d();
+  kurant_wm        = real2d();
+  kurant_uhm       = real2d();
+  kurant_tmpmax    = real2d();
+  adv_mx           = real4d();
+  adv_mn           = real4d();
+  adv_uuu          = real4d();
+  adv_vvv          = real4d();
+  adv_www          = real4d();
+  adv_iadz         = real2d();
+  adv_irho         = real2d();
+  adv_irhow        = real2d();
 #ifdef MMF_ESMT
   u_esmt           = real4d();
   v_esmt           = real4d();
@@ -1859,6 +1897,23 @@ real2d crm_output_v_tend_esmt;
 #endif 
 real2d crm_clear_rh;
 int2d crm_clear_rh_cnt;
+real4d press_f;
+real2d press_a;
+real2d press_c;
+real2d press_eign;
+real4d press_alfa;
+real4d press_e;
+real2d kurant_wm;
+real2d kurant_uhm;
+real2d kurant_tmpmax;
+real4d adv_mx;
+real4d adv_mn;
+real4d adv_uuu;
+real4d adv_vvv;
+real4d adv_www;
+real2d adv_iadz;
+real2d adv_irho;
+real2d adv_irhow;
 real1d lat0; 
 real1d long0;
 int1d  gcolp;
@@ -546,6 +546,25 @@ extern real2d crm_output_v_tend_esmt;
 #endif
 extern real2d crm_clear_rh;
 extern int2d  crm_clear_rh_cnt;
+// Scratch space for pressure(), kurant() and advect_scalar*(), and the geometry
+// dependent factors of the pressure solver (set once per call in pressure_init())
+extern real4d press_f;
+extern real2d press_a;
+extern real2d press_c;
+extern real2d press_eign;
+extern real4d press_alfa;
+extern real4d press_e;
+extern real2d kurant_wm;
+extern real2d kurant_uhm;
+extern real2d kurant_tmpmax;
+extern real4d adv_mx;
+extern real4d adv_mn;
+extern real4d adv_uuu;
+extern real4d adv_vvv;
+extern real4d adv_www;
+extern real2d adv_iadz;
+extern real2d adv_irho;
+extern real2d adv_irhow;
 extern real1d lat0; 
 extern real1d long0;
 extern int1d  gcolp;
@@ -786,13 +786,42 @@ Int run_unit_and_randomized_tests (const Parallel::Ptr& p, const Input& in) {
                        (in.pseudorandom ?
                         tree::oned::Mesh::ParallelDecomp::pseudorandom :
                         tree::oned::Mesh::ParallelDecomp::contiguous));
-    Timer::init();
-    Timer::start(Timer::total); Timer::start(Timer::tree);
-    tree::Node::Ptr tree = make_tree(m, false);
-    Timer::stop(Timer::tree);
-    test::test_qlt(p, tree, in.ncells, in.nrepeat, false, false, false, in.verbose);
-    Timer::stop(Timer::total);
-    if (p->amroot()) Timer::print();
+    const bool node_aware = in.tree_fanin >= 2;
+    for (const bool use_node_aware : {false, true}) {
+      if (use_node_aware && ! node_aware) break;
+      if (p->amroot()) {
+        if (use_node_aware)
+          std::cout << "node-aware tree with fan-in " << in.tree_fanin << "\n";
+        else
+          std::cout << "tree over 1D mesh\n";
+      }
+      Timer::init();
+      MPI_Barrier(p->comm());
+      const double t0 = MPI_Wtime();
+      Timer::start(Timer::total); Timer::start(Timer::tree);
+      tree::Node::Ptr tree;
+      if (use_node_aware) {
+        std::vector<Int> rank_of_cell(m.ncell());
+        for (Int i = 0; i < m.ncell(); ++i) rank_of_cell[i] = m.rank(i);
+        tree = tree::make_node_aware_tree(p, m.ncell(), rank_of_cell.data(),
+                                          tree::get_node_of_rank(p), in.tree_fanin);
+      } else {
+        tree = make_tree(m, false);
+      }
+      Timer::stop(Timer::tree);
+      const Int ne = test::test_qlt(p, tree, in.ncells, in.nrepeat, false, false,
+                                    false, in.verbose);
+      Timer::stop(Timer::total);
+      const double t = MPI_Wtime() - t0;
+      double tmax;
+      mpi::all_reduce(*p, &t, &tmax, 1, MPI_MAX);
+      if (ne && p->amroot()) std::cerr << "FAIL: qlt::test::test_qlt()\n";
+      nerr += ne;
+      if (p->amroot()) {
+        Timer::print();
+        std::cout << "time (tree + " << in.nrepeat+1 << " runs) " << tmax << " s\n";
+      }
+    }
   }
   return nerr;
 }
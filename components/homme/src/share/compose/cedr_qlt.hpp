@@ -223,6 +223,9 @@ struct Input {
   bool unittest, perftest, write;
   Int ncells, ntracers, tracer_type, nrepeat;
   bool pseudorandom, verbose;
+  // Performance test: 0 to use the tree over the 1D mesh; >= 2 to use the
+  // node-aware tree with this fan-in, in which case both trees are timed.
+  Int tree_fanin = 0;
 };
 
 Int run_unit_and_randomized_tests(const Parallel::Ptr& p, const Input& in);
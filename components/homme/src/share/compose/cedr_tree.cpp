@@ -352,6 +352,84 @@ Node::Ptr make_tree_over_1d_mesh (const Parallel::Ptr& p, const Int& ncells,
   return oned::make_tree(oned::Mesh(ncells, p), imbalanced);
 }
 
+std::vector<Int> get_node_of_rank (const Parallel::Ptr& p) {
+  MPI_Comm shm;
+  MPI_Comm_split_type(p->comm(), MPI_COMM_TYPE_SHARED, p->rank(), MPI_INFO_NULL,
+                      &shm);
+  Int leader = p->rank(), node_leader;
+  MPI_Allreduce(&leader, &node_leader, 1, MPI_INT, MPI_MIN, shm);
+  MPI_Comm_free(&shm);
+  std::vector<Int> node_of_rank(p->size());
+  MPI_Allgather(&node_leader, 1, MPI_INT, node_of_rank.data(), 1, MPI_INT,
+                p->comm());
+  return node_of_rank;
+}
+
+namespace {
+// Combine the subtrees sts[b:e-1] in a balanced binary tree whose internal
+// nodes are owned by rank.
+Node::Ptr combine_subtrees (const std::vector<Node::Ptr>& sts, const Int b,
+                            const Int e, const Int rank) {
+  if (e - b == 1) return sts[b];
+  const Int mid = b + (e - b)/2;
+  const auto n = std::make_shared<Node>();
+  n->rank = rank;
+  n->nkids = 2;
+  n->kids[0] = combine_subtrees(sts, b, mid, rank);
+  n->kids[1] = combine_subtrees(sts, mid, e, rank);
+  for (Int k = 0; k < 2; ++k) n->kids[k]->parent = n.get();
+  n->level = 1 + std::max(n->kids[0]->level, n->kids[1]->level);
+  return n;
+}
+
+Node::Ptr combine_subtrees (const std::vector<Node::Ptr>& sts) {
+  return combine_subtrees(sts, 0, sts.size(), sts[0]->rank);
+}
+} // namespace
+
+Node::Ptr make_node_aware_tree (const Parallel::Ptr& p, const Int& ncells,
+                                const Int* rank_of_cell,
+                                const std::vector<Int>& node_of_rank,
+                                const Int& fanin) {
+  cedr_throw_if(fanin < 2, "make_node_aware_tree: fanin must be >= 2.");
+  cedr_throw_if(static_cast<Int>(node_of_rank.size()) != p->size(),
+                "make_node_aware_tree: node_of_rank must have size nrank.");
+  // 1. Leaves, grouped by rank in SFC order, then per-rank subtrees.
+  std::vector<std::vector<Node::Ptr> > rank_leaves(p->size());
+  for (Int i = 0; i < ncells; ++i) {
+    const Int rank = rank_of_cell[i];
+    cedr_assert(rank >= 0 && rank < p->size());
+    const auto n = std::make_shared<Node>();
+    n->rank = rank;
+    n->cellidx = i;
+    n->level = 0;
+    rank_leaves[rank].push_back(n);
+  }
+  // 2. Per-node subtrees. Ranks having no cells do not participate.
+  std::vector<std::vector<Node::Ptr> > node_sts(p->size());
+  for (Int r = 0; r < p->size(); ++r) {
+    if (rank_leaves[r].empty()) continue;
+    node_sts[node_of_rank[r]].push_back(combine_subtrees(rank_leaves[r]));
+  }
+  rank_leaves.clear();
+  std::vector<Node::Ptr> sts;
+  for (const auto& e : node_sts)
+    if ( ! e.empty()) sts.push_back(combine_subtrees(e));
+  node_sts.clear();
+  cedr_throw_if(sts.empty(), "make_node_aware_tree: no cells.");
+  // 3. Combine the node subtrees in groups of fanin.
+  while (sts.size() > 1) {
+    std::vector<Node::Ptr> next;
+    for (size_t i = 0; i < sts.size(); i += fanin) {
+      const std::vector<Node::Ptr> grp(sts.begin() + i,
+                                       sts.begin() + std::min(sts.size(), i + fanin));
+      next.push_back(combine_subtrees(grp));
+    }
+    sts.swap(next);
+  }
+  return sts[0];
+}
+
 // Tree for a 1-D periodic domain, for unit testing.
 namespace oned {
 void Mesh::init (const Int nc, const Parallel::Ptr& p,
@@ -478,6 +556,34 @@ Int unittest (const Parallel::Ptr& p) {
         tree = nullptr;
         nerr += unittest_NodeSets(p, nodesets, m.ncell());
       }
+  // Node-aware trees. Fake a machine with two, then three, ranks per node.
+  for (const Int rpn : {2, 3})
+    for (const Int fanin : {2, 4})
+      for (size_t id = 0; id < sizeof(dists)/sizeof(*dists); ++id) {
+        Mesh m(3*p->size(), p, dists[id]);
+        std::vector<Int> rank_of_cell(m.ncell()), node_of_rank(p->size());
+        for (Int i = 0; i < m.ncell(); ++i) rank_of_cell[i] = m.rank(i);
+        for (Int r = 0; r < p->size(); ++r) node_of_rank[r] = rpn*(r/rpn);
+        tree::Node::Ptr tree = make_node_aware_tree(p, m.ncell(), rank_of_cell.data(),
+                                                    node_of_rank, fanin);
+        std::vector<Int> cells(m.ncell(), 0);
+        oned::mark_cells(tree, cells);
+        for (Int i = 0; i < m.ncell(); ++i)
+          if (cells[i] != 1) ++nerr;
+        tree::NodeSets::ConstPtr nodesets = analyze(p, m.ncell(), tree);
+        tree = nullptr;
+        nerr += unittest_NodeSets(p, nodesets, m.ncell());
+      }
+  { // Also with the real machine topology.
+    Mesh m(3*p->size(), p, Mesh::ParallelDecomp::contiguous);
+    std::vector<Int> rank_of_cell(m.ncell());
+    for (Int i = 0; i < m.ncell(); ++i) rank_of_cell[i] = m.rank(i);
+    tree::Node::Ptr tree = make_node_aware_tree(p, m.ncell(), rank_of_cell.data(),
+                                                get_node_of_rank(p), 2);
+    tree::NodeSets::ConstPtr nodesets = analyze(p, m.ncell(), tree);
+    tree = nullptr;
+    nerr += unittest_NodeSets(p, nodesets, m.ncell());
+  }
   return nerr;
 }
 
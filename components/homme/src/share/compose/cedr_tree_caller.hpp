@@ -6,6 +6,8 @@
 
 #include "cedr_mpi.hpp"
 
+#include <vector>
+
 namespace cedr {
 namespace tree {
 // The caller builds a tree of these nodes to pass to QLT.
@@ -28,6 +30,28 @@ struct Node {
 Node::Ptr make_tree_over_1d_mesh(const mpi::Parallel::Ptr& p, const Int& ncells,
                                  const bool imbalanced = false);
 
+// Map each rank of p to the lowest rank on its shared-memory node, as
+// determined by MPI_Comm_split_type with MPI_COMM_TYPE_SHARED.
+std::vector<Int> get_node_of_rank(const mpi::Parallel::Ptr& p);
+
+// Make a tree that follows the machine topology. Cell i, 0 <= i < ncells, is
+// owned by rank_of_cell[i]; cells are ordered along a space-filling curve. The
+// tree is built in three stages:
+//   1. Each rank's cells are combined in a balanced subtree owned by that rank.
+//   2. The rank subtrees on a shared-memory node, as given by node_of_rank, are
+//      combined in a subtree whose internal nodes are owned by the node's
+//      lowest rank having cells. Thus each rank sends one message to this
+//      rank, and these messages stay on the node.
+//   3. The node subtrees are combined in groups of fanin. The internal nodes of
+//      a group are owned by the group's first rank, so a rank receives at most
+//      fanin-1 messages per stage. This repeats until one subtree remains.
+// As in make_tree_over_1d_mesh, leaf cellidx is the index i, and the full tree
+// is returned on each rank. Node levels are set. fanin must be >= 2.
+Node::Ptr make_node_aware_tree(const mpi::Parallel::Ptr& p, const Int& ncells,
+                               const Int* rank_of_cell,
+                               const std::vector<Int>& node_of_rank,
+                               const Int& fanin);
+
 } // namespace tree
 } // namespace cedr
 
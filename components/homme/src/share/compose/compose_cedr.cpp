@@ -212,6 +212,36 @@ make_tree_non_sgi (const cedr::mpi::Parallel::Ptr& p, const Int nelem,
   return tree;
 }
 
+// Tree that reduces within each shared-memory node first, then across nodes
+// with fan-in fanin. Unlike make_tree_sgi, each rank holds the full tree, even
+// if the SGI data are provided.
+tree::Node::Ptr
+make_tree_node_aware (const cedr::mpi::Parallel::Ptr& p, const Int nelem,
+                      const Int* gid_data, const Int* rank_data, const Int nsublev,
+                      const bool use_sgi, const Int fanin) {
+  const auto nrank = p->size(), my_rank = p->rank();
+  // Rank of each SFC index.
+  std::vector<Int> sc2rank(nelem);
+  if (use_sgi) {
+    for (Int sc = 0; sc < nelem; ++sc)
+      sc2rank[sc] = rank2sfc_search(rank_data, nrank, sc);
+  } else {
+    std::copy(rank_data, rank_data + nelem, sc2rank.begin());
+  }
+  auto tree = tree::make_node_aware_tree(p, nelem, sc2rank.data(),
+                                         tree::get_node_of_rank(p), fanin);
+  if (use_sgi)
+    renumber(nrank, nelem, my_rank, gid_data, rank_data, tree);
+  else
+    renumber(gid_data, rank_data, tree);
+  // The tree has levels, so the sublevel trees must shift them.
+  if (nsublev > 1) {
+    const Int level_offset = get_tree_height(nsublev) - 1;
+    add_sub_levels(my_rank, tree, nsublev, level_offset);
+  }
+  return tree;
+}
+
 tree::Node::Ptr
 clone (const tree::Node::Ptr& in, const tree::Node* parent = nullptr) {
   const auto out = std::make_shared<tree::Node>(*in);
@@ -310,10 +340,13 @@ tree::Node::Ptr
 make_tree (const cedr::mpi::Parallel::Ptr& p, const Int nelem,
            const Int* gid_data, const Int* rank_data, const Int nsublev,
            const bool use_sgi, const bool cdr_over_super_levels,
-           const Int nsuplev) {
-  auto tree = use_sgi ?
-    make_tree_sgi    (p, nelem, gid_data, rank_data, nsublev) :
-    make_tree_non_sgi(p, nelem, gid_data, rank_data, nsublev);
+           const Int nsuplev, const Int fanin = 0) {
+  auto tree = (fanin >= 2 ?
+               make_tree_node_aware(p, nelem, gid_data, rank_data, nsublev,
+                                    use_sgi, fanin) :
+               use_sgi ?
+               make_tree_sgi       (p, nelem, gid_data, rank_data, nsublev) :
+               make_tree_non_sgi   (p, nelem, gid_data, rank_data, nsublev));
   Int nleaf = nelem*nsublev;
   if (cdr_over_super_levels) {
     tree = combine_superlevels(tree, nleaf, nsuplev);
@@ -422,7 +455,8 @@ template <typename MT>
 CDR<MT>::CDR (Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int qsize_,
               bool use_sgi, bool independent_time_steps, const bool hard_zero_,
               const Int* gid_data, const Int* rank_data,
-              const cedr::mpi::Parallel::Ptr& p_, Int fcomm)
+              const cedr::mpi::Parallel::Ptr& p_, Int fcomm,
+              const Int tree_fanin)
   : alg(Alg::convert(cdr_alg_)),
     ncell(ngblcell_), nlclcell(nlclcell_), nlev(nlev_), qsize(qsize_),
     nsublev(Alg::is_suplev(alg) ? nsublev_per_suplev : 1),
@@ -434,9 +468,12 @@ CDR<MT>::CDR (Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int qsize_,
     p(p_), run(cdr_alg_ != 42), inited_tracers_(false)
 {
   const Int n_id_in_suplev = caas_in_suplev ? 1 : nsublev;
+  cedr_throw_if(tree_fanin < 0 || tree_fanin == 1,
+                "Invalid semi_lagrange_cdr_tree_fanin " << tree_fanin
+                << "; must be 0 or >= 2.");
   if (Alg::is_qlt(alg)) {
     tree = make_tree(p, ncell, gid_data, rank_data, n_id_in_suplev, use_sgi,
-                     cdr_over_super_levels, nsuplev);
+                     cdr_over_super_levels, nsuplev, tree_fanin);
     Int nleaf = ncell*n_id_in_suplev;
     if (cdr_over_super_levels) nleaf *= nsuplev;
     cedr::CDR::Options options;
@@ -616,6 +653,23 @@ int cedr_unittest (MPI_Comm mpi_comm) {
   return nerr;
 }
 
+int cedr_qlt_tree_perftest (MPI_Comm mpi_comm, const int ncells, const int tree_fanin,
+                            const int nrepeat) {
+  const auto p = cedr::mpi::make_parallel(mpi_comm);
+  cedr::qlt::test::Input in;
+  in.unittest = false;
+  in.perftest = true;
+  in.write = false;
+  in.ncells = ncells;
+  in.ntracers = 1;
+  in.tracer_type = 0;
+  in.nrepeat = nrepeat;
+  in.pseudorandom = false;
+  in.verbose = false;
+  in.tree_fanin = tree_fanin;
+  return cedr::qlt::test::run_unit_and_randomized_tests(p, in);
+}
+
 } // namespace test
 } // namespace compose
 
@@ -627,11 +681,12 @@ cedr_init_impl (const homme::Int fcomm, const homme::Int cdr_alg, const bool use
                 const homme::Int gbl_ncell, const homme::Int lcl_ncell,
                 const homme::Int nlev, const homme::Int qsize,
                 const bool independent_time_steps, const bool hard_zero,
-                const homme::Int, const homme::Int) {
+                const homme::Int tree_fanin, const homme::Int, const homme::Int) {
   const auto p = cedr::mpi::make_parallel(MPI_Comm_f2c(fcomm));
   g_cdr = std::make_shared<homme::CDR<ko::MachineTraits> >(
     cdr_alg, gbl_ncell, lcl_ncell, nlev, qsize, use_sgi,
-    independent_time_steps, hard_zero, gid_data, rank_data, p, fcomm);
+    independent_time_steps, hard_zero, gid_data, rank_data, p, fcomm,
+    tree_fanin);
 }
 
 extern "C" void cedr_query_bufsz (homme::Int* sendsz, homme::Int* recvsz) {
@@ -67,9 +67,12 @@ struct CDR {
   BoolsH nonneg_h;
   bool run; // for debugging, it can be useful not to run the CEDR.
 
+  // tree_fanin: 0 to use the binary tree over the space-filling curve for QLT,
+  // >= 2 to use the node-aware tree with this fan-in across nodes.
   CDR(Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int qsize_, bool use_sgi,
       bool independent_time_steps, const bool hard_zero_, const Int* gid_data,
-      const Int* rank_data, const cedr::mpi::Parallel::Ptr& p_, Int fcomm);
+      const Int* rank_data, const cedr::mpi::Parallel::Ptr& p_, Int fcomm,
+      const Int tree_fanin = 0);
 
   CDR(const CDR&) = delete;
   CDR& operator=(const CDR&) = delete;
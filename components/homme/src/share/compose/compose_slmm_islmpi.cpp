@@ -26,6 +26,17 @@ Request::~Request () {
 }
 #endif
 
+int start (Request* req) {
+#ifdef COMPOSE_DEBUG_MPI
+  req->unfreed++;
+#endif
+  return MPI_Start(&req->request);
+}
+
+int request_free (Request* req) {
+  return MPI_Request_free(&req->request);
+}
+
 int waitany (int count, Request* reqs, int* index, MPI_Status* stats) {
 #ifdef COMPOSE_DEBUG_MPI
   std::vector<MPI_Request> vreqs(count);
@@ -737,6 +748,15 @@ void alloc_mpi_buffers (IslMpi<MT>& cm, Real* sendbuf, Real* recvbuf) {
   cm.bla_h = cm.bla.mirror();
   cm.sendbuf.init(nrmtrank, cm.sendsz.data(), sendbuf);
   cm.recvbuf.init(nrmtrank, cm.recvsz.data(), recvbuf);
+  // The receive buffers are fixed for the whole run, so the receives are set
+  // up once here and just restarted at each step. The count is the number of
+  // slots available, which can be larger than what is actually received.
+  cm.recvreq_pers.reset_capacity(nrmtrank, true);
+  for (Int ri = 0; ri < nrmtrank; ++ri) {
+    auto&& buf = cm.recvbuf.get_h(ri);
+    mpi::recv_init(*cm.p, buf.data(), buf.n(), cm.ranks(ri), 42,
+                   &cm.recvreq_pers(ri));
+  }
   cm.nlid_per_rank.clear();
   cm.sendsz.clear();
   cm.recvsz.clear();
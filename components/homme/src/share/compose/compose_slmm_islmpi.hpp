@@ -82,6 +82,16 @@ int irecv (const Parallel& p, T* buf, int count, int src, int tag, Request* ireq
   return ret;
 }
 
+// Persistent receive. The request is activated by start, completed by the usual
+// wait calls, and must eventually be released with request_free.
+template <typename T>
+int recv_init (const Parallel& p, T* buf, int count, int src, int tag, Request* ireq) {
+  MPI_Datatype dt = get_type<T>();
+  return MPI_Recv_init(buf, count, dt, src, tag, p.comm(), &ireq->request);
+}
+
+int start(Request* req);
+int request_free(Request* req);
 int waitany(int count, Request* reqs, int* index, MPI_Status* stats = nullptr);
 int waitall(int count, Request* reqs, MPI_Status* stats = nullptr);
 int wait(Request* req, MPI_Status* stat = nullptr);
@@ -524,8 +534,10 @@ struct IslMpi {
   ListOfLists <Int, DDT> nx_in_lid, lid_on_rank;
   BufferLayoutArray<DDT> bla;
 
-  // MPI comm data.
-  FixedCapList<mpi::Request, HDT> sendreq, recvreq;
+  // MPI comm data. The receive buffers never change, so recvreq_pers holds one
+  // persistent receive per remote rank. recvreq holds copies of the handles
+  // that were started in the current phase of the step.
+  FixedCapList<mpi::Request, HDT> sendreq, recvreq, recvreq_pers;
   ListOfLists<Real, DDT> sendbuf, recvbuf;
   FixedCapList<Int, DDT> sendcount, x_bulkdata_offset;
   ListOfLists<Real, HDT> sendbuf_meta_h, recvbuf_meta_h; // not mirrors
@@ -565,6 +577,11 @@ struct IslMpi {
   IslMpi& operator=(const IslMpi&) = delete;
 
   ~IslMpi () {
+    int fin;
+    MPI_Finalized(&fin);
+    if ( ! fin)
+      for (Int ri = 0; ri < recvreq_pers.n(); ++ri)
+        mpi::request_free(&recvreq_pers(ri));
 #ifdef COMPOSE_HORIZ_OPENMP
     const Int nrmtrank = static_cast<Int>(ranks.n()) - 1;
     for (Int ri = 0; ri < nrmtrank; ++ri) {
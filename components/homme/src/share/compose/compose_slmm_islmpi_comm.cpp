@@ -47,12 +47,12 @@ void setup_irecv (IslMpi<MT>& cm, const bool skip_if_empty) {
     cm.recvreq.clear();
     for (Int ri = 0; ri < nrmtrank; ++ri) {
       if (skip_if_empty && cm.nx_in_rank_h(ri) == 0) continue;
-      auto&& recvbuf = cm.recvbuf.get_h(ri);
-      // The count is just the number of slots available, which can be larger
-      // than what is actually being received.
+      // Restart the persistent receive set up in alloc_mpi_buffers. A copy of
+      // an MPI handle refers to the same request, so we can start and wait on
+      // the copy.
       cm.recvreq.inc();
-      mpi::irecv(*cm.p, recvbuf.data(), recvbuf.n(), cm.ranks(ri), 42,
-                 &cm.recvreq.back());
+      cm.recvreq.back().request = cm.recvreq_pers(ri).request;
+      mpi::start(&cm.recvreq.back());
     }
   }
 }
@@ -13,6 +13,9 @@ namespace test {
 int slmm_unittest();
 int cedr_unittest();
 int cedr_unittest(MPI_Comm comm);
+// Time QLT on a 1D mesh with the default tree and, if tree_fanin >= 2, with
+// the node-aware tree of this fan-in. Returns the number of errors.
+int cedr_qlt_tree_perftest(MPI_Comm comm, int ncells, int tree_fanin, int nrepeat);
 
 typedef double Real;
 typedef int Int;
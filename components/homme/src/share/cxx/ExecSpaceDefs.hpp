@@ -192,6 +192,39 @@ static int get_num_concurrent_teams(const int num_parallel_iterations) {
       get_default_team_policy<ExecSpace, Tags...>(num_parallel_iterations));
 }
 
+// Element-batch execution mode, for 2D (i.e., single level) kernels.
+// With get_default_team_policy, each team processes one element, which is
+// fine for 3D kernels, but leaves 2D kernels with only NP*NP points of work
+// per team. On CPU, in this mode each thread processes a batch of consecutive
+// elements, looping over all the gll points of the batch with a simd loop,
+// so that the vectorization spans several elements. On GPU, each thread
+// processes a single gll point, to expose all the available parallelism.
+// The batch size on CPU can be changed at configure time.
+#ifndef HOMMEXX_ELEM_BATCH_SIZE
+# define HOMMEXX_ELEM_BATCH_SIZE 8
+#endif
+
+template<typename ExecSpaceType>
+struct ElemBatch {
+  // Number of gll points processed by each thread
+  enum : int { num_points = OnGpu<ExecSpaceType>::value ? 1 : HOMMEXX_ELEM_BATCH_SIZE*NP*NP };
+
+  static_assert (num_points>0, "Error! Element batch size must be positive.\n");
+
+  KOKKOS_INLINE_FUNCTION
+  static int num_batches (const int num_elems) {
+    return (num_elems*NP*NP + num_points - 1) / num_points;
+  }
+};
+
+// Return a RangePolicy over the element batches. Use it together with
+// ElemBatchVariables (in KernelVariables.hpp) inside the functor.
+template <typename ExecSpace, typename... Tags>
+Kokkos::RangePolicy<ExecSpace, Tags...>
+get_elem_batch_policy(const int num_elems) {
+  return Kokkos::RangePolicy<ExecSpace, Tags...>(0,ElemBatch<ExecSpace>::num_batches(num_elems));
+}
+
 // A templated typedef for MD range policy (used in RK stages)
 template<typename ExecutionSpace, int Rank>
 using MDRangePolicy = Kokkos::Experimental::MDRangePolicy
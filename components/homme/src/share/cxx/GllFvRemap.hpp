@@ -53,6 +53,10 @@ public:
                           const CPhys2T& T, const CPhys3T& uv, const CPhys3T& q);
   void run_fv_phys_to_dyn_dss();
 
+  // Access to the remap operators and metric data, for clients that need to
+  // remap fields other than the dynamics state.
+  const GllFvRemapImpl& get_impl () const { return *m_impl; }
+
 private:
   std::unique_ptr<GllFvRemapImpl> m_impl;
 };
@@ -154,6 +154,39 @@ public:
   const TeamUtils<ExecSpace>* team_utils;
 }; // KernelVariables
 
+// The analogue of KernelVariables for kernels dispatched with the element-batch
+// policy (see get_elem_batch_policy in ExecSpaceDefs.hpp). It stores the range
+// of gll points [pt_beg,pt_end), across all elements, handled by the current thread.
+struct ElemBatchVariables {
+
+  KOKKOS_INLINE_FUNCTION
+  ElemBatchVariables (const int ibatch, const int num_elems)
+   : pt_beg (ibatch*ElemBatch<ExecSpace>::num_points)
+   , pt_end ((pt_beg+ElemBatch<ExecSpace>::num_points)<num_elems*NP*NP ?
+             (pt_beg+ElemBatch<ExecSpace>::num_points) : num_elems*NP*NP)
+  {
+    // Nothing to be done here
+  }
+
+  // Calls f(ie,igp,jgp) on all gll points of the batch. The points are
+  // traversed with a single simd loop, so that, on CPU, the vectorization
+  // is across elements.
+  template<typename Lambda>
+  KOKKOS_FORCEINLINE_FUNCTION
+  void for_each_point (const Lambda& f) const {
+VECTOR_SIMD_LOOP
+    for (int idx=pt_beg; idx<pt_end; ++idx) {
+      const int ie  = idx / (NP*NP);
+      const int igp = (idx / NP) % NP;
+      const int jgp =  idx % NP;
+      f(ie,igp,jgp);
+    }
+  }
+
+  const int pt_beg;
+  const int pt_end;
+}; // ElemBatchVariables
+
 } // Homme
 
 #endif // KERNEL_VARIABLES_HPP
@@ -722,9 +722,9 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    vector_buf<NUM_LEV_REQUEST> grad_s(Homme::subview(vector_buf_ml, kv.team_idx, 0).data());
-    gradient_sphere<NUM_LEV_REQUEST,decltype(field),NUM_LEV_REQUEST>(kv, field, grad_s);
-    divergence_sphere_wk<NUM_LEV_OUT,NUM_LEV_REQUEST,NUM_LEV_REQUEST>(kv, grad_s, laplace);
+    // Same as gradient_sphere followed by divergence_sphere_wk, but fused (see laplace_wk_fused)
+    laplace_wk_fused<false,NUM_LEV_OUT,NUM_LEV_IN,NUM_LEV_REQUEST>(
+        kv, ExecViewUnmanaged<const Real [2][2][NP][NP]>(), field, laplace, 0);
   }//end of laplace_simple
 
   template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
@@ -741,28 +741,10 @@ public:
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
-    vector_buf<NUM_LEV_REQUEST> grad_s(Homme::subview(vector_buf_ml, kv.team_idx, 1).data());
-    vector_buf<NUM_LEV_REQUEST> sphere_buf(Homme::subview(vector_buf_ml, kv.team_idx, 2).data());
-
-    gradient_sphere<NUM_LEV_REQUEST,decltype(field),NUM_LEV_REQUEST>(kv, field, grad_s);
-    //now multiply tensorVisc(:,:,i,j)*grad_s(i,j) (matrix*vector, independent of i,j )
-    //but it requires a temp var to store a result. the result is then placed to grad_s,
-    //or should it be an extra temp var instead of an extra loop?
-    constexpr int num_iters = NP * NP;
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, num_iters),
-                       [&](const int loop_idx) {
-      const int igp = loop_idx / NP;
-      const int jgp = loop_idx % NP;
-      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
-        const auto& grad_s0 = grad_s(0,igp,jgp,ilev);
-        const auto& grad_s1 = grad_s(1,igp,jgp,ilev);
-        sphere_buf(0,igp,jgp,ilev) = tensorVisc(0,0,igp,jgp) * grad_s0 + tensorVisc(1,0,igp,jgp) * grad_s1;
-        sphere_buf(1,igp,jgp,ilev) = tensorVisc(0,1,igp,jgp) * grad_s0 + tensorVisc(1,1,igp,jgp) * grad_s1;
-      });
-    });
-    kv.team_barrier();
-
-    divergence_sphere_wk<NUM_LEV_OUT,NUM_LEV_REQUEST,NUM_LEV_REQUEST>(kv, sphere_buf, laplace);
+    // Same as gradient_sphere, followed by the multiplication by tensorVisc(:,:,i,j)
+    // at each gll point, followed by divergence_sphere_wk, but fused (see laplace_wk_fused)
+    laplace_wk_fused<true,NUM_LEV_OUT,NUM_LEV_IN,NUM_LEV_REQUEST>(
+        kv, tensorVisc, field, laplace, 1);
   }//end of laplace_tensor
 
   template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
@@ -977,18 +959,12 @@ public:
     vector_buf<NUM_LEV_REQUEST> grad_curl_cov(Homme::subview(vector_buf_ml,kv.team_idx,1).data());
     constexpr int np_squared = NP * NP;
 
-    // grad(div(v))
-    divergence_sphere<NUM_LEV_REQUEST>(kv,vector,div);
+    // grad(div(v)). The nu_ratio scaling is done while computing the divergence,
+    // to save a pass over div (and a barrier).
     if (nu_ratio>0 && nu_ratio!=1.0) {
-      Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
-                          [&](const int loop_idx) {
-        const int igp = loop_idx / NP; //slow
-        const int jgp = loop_idx % NP; //fast
-        Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
-          div(igp,jgp,ilev) *= nu_ratio;
-        });
-      });
-      kv.team_barrier();
+      divergence_sphere_cm<CombineMode::Scale>(kv,vector,div,nu_ratio);
+    } else {
+      divergence_sphere<NUM_LEV_REQUEST>(kv,vector,div);
     }
     grad_sphere_wk_testcov<NUM_LEV_REQUEST,NUM_LEV_REQUEST,NUM_LEV_REQUEST>(kv,div,grad_curl_cov);
 
@@ -1010,6 +986,115 @@ public:
      kv.team_barrier();
   }//end of vlaplace_sphere_wk_contra
 
+private:
+
+  // Contravariant flux of the laplacian at a gll point: the spherical gradient,
+  // optionally multiplied by the viscosity tensor, and then by D_inv^T, which is
+  // the first step of divergence_sphere_wk. The operations (and their order) are
+  // exactly those of the unfused operators, so results are BFB with those.
+  template<bool USE_TENSOR, typename FieldProvider>
+  KOKKOS_FORCEINLINE_FUNCTION void
+  laplace_wk_flux (const int igp, const int jgp, const int ilev,
+                   const FieldProvider& field,
+                   const ExecViewUnmanaged<const Real [2][2][NP][NP]>& D_inv,
+                   const ExecViewUnmanaged<const Real [2][2][NP][NP]>& tensorVisc,
+                   Scalar& w0, Scalar& w1) const
+  {
+    Scalar v0, v1;
+    for (int kgp = 0; kgp < NP; ++kgp) {
+      v0 += dvv(jgp, kgp) * field(igp, kgp, ilev);
+      v1 += dvv(igp, kgp) * field(kgp, jgp, ilev);
+    }
+    v0 *= PhysicalConstants::rrearth;
+    v1 *= PhysicalConstants::rrearth;
+    Scalar g0 = D_inv(0,0,igp,jgp) * v0 + D_inv(0,1,igp,jgp) * v1;
+    Scalar g1 = D_inv(1,0,igp,jgp) * v0 + D_inv(1,1,igp,jgp) * v1;
+    if (USE_TENSOR) {
+      const Scalar t0 = tensorVisc(0,0,igp,jgp) * g0 + tensorVisc(1,0,igp,jgp) * g1;
+      const Scalar t1 = tensorVisc(0,1,igp,jgp) * g0 + tensorVisc(1,1,igp,jgp) * g1;
+      g0 = t0;
+      g1 = t1;
+    }
+    w0 = D_inv(0,0,igp,jgp) * g0 + D_inv(1,0,igp,jgp) * g1;
+    w1 = D_inv(0,1,igp,jgp) * g0 + D_inv(1,1,igp,jgp) * g1;
+  }
+
+  // Weak laplacian, with the gradient, the tensor multiplication, and the weak
+  // divergence fused together. Compared to calling the three operators in sequence,
+  // this saves two passes over a [2][NP][NP][NUM_LEV] buffer and two team barriers.
+  //  - On CPU, teams are small, so we parallelize over levels only: each thread keeps
+  //    the whole NPxNP flux of a level pack in a local array (registers/L1), and no
+  //    scratch buffer nor intermediate barrier is needed. Since each level is read
+  //    entirely before being written, field and laplace can alias.
+  //  - On GPU, we need the NPxNP parallelism within a team, so the flux is stored
+  //    in the vector_buf_ml slot ibuf, and the contraction is done after a barrier.
+  template<bool USE_TENSOR, int NUM_LEV_OUT, int NUM_LEV_IN, int NUM_LEV_REQUEST>
+  KOKKOS_INLINE_FUNCTION void
+  laplace_wk_fused (const KernelVariables &kv,
+                    const ExecViewUnmanaged<const Real [2][2][NP][NP]>& tensorVisc,
+                    const typename ViewConst<ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_IN]>>::type& field,
+                    const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& laplace,
+                    const int ibuf) const
+  {
+    const ExecViewUnmanaged<const Real [2][2][NP][NP]> D_inv = Homme::subview(m_dinv, kv.ie);
+    const auto& spheremp = Homme::subview(m_spheremp, kv.ie);
+
+    if (OnGpu<ExecSpace>::value) {
+      vector_buf<NUM_LEV_REQUEST> w(Homme::subview(vector_buf_ml, kv.team_idx, ibuf).data());
+      constexpr int np_squared = NP * NP;
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
+                           [&](const int loop_idx) {
+        const int igp = loop_idx / NP;
+        const int jgp = loop_idx % NP;
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+          laplace_wk_flux<USE_TENSOR>(igp, jgp, ilev, field, D_inv, tensorVisc,
+                                      w(0,igp,jgp,ilev), w(1,igp,jgp,ilev));
+        });
+      });
+      kv.team_barrier();
+
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
+                           [&](const int loop_idx) {
+        const int mgp = loop_idx % NP;
+        const int ngp = loop_idx / NP;
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+          Scalar dd;
+          for (int jgp = 0; jgp < NP; ++jgp) {
+            dd -= (spheremp(ngp, jgp) * w(0, ngp, jgp, ilev) * dvv(jgp, mgp) +
+                   spheremp(jgp, mgp) * w(1, jgp, mgp, ilev) * dvv(jgp, ngp)) *
+                  PhysicalConstants::rrearth;
+          }
+          laplace(ngp, mgp, ilev) = dd;
+        });
+      });
+    } else {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NUM_LEV_REQUEST),
+                           [&](const int ilev) {
+        Scalar w[2][NP][NP];
+        for (int igp = 0; igp < NP; ++igp) {
+          for (int jgp = 0; jgp < NP; ++jgp) {
+            laplace_wk_flux<USE_TENSOR>(igp, jgp, ilev, field, D_inv, tensorVisc,
+                                        w[0][igp][jgp], w[1][igp][jgp]);
+          }
+        }
+        for (int ngp = 0; ngp < NP; ++ngp) {
+          for (int mgp = 0; mgp < NP; ++mgp) {
+            Scalar dd;
+            for (int jgp = 0; jgp < NP; ++jgp) {
+              dd -= (spheremp(ngp, jgp) * w[0][ngp][jgp] * dvv(jgp, mgp) +
+                     spheremp(jgp, mgp) * w[1][jgp][mgp] * dvv(jgp, ngp)) *
+                    PhysicalConstants::rrearth;
+            }
+            laplace(ngp, mgp, ilev) = dd;
+          }
+        }
+      });
+    }
+    kv.team_barrier();
+  }
+
+public:
+
   // The buffers should be enough to handle any single call to any
   // single sphere operator.
   // One might prefer them to be private, but they are handy for
@@ -20,6 +20,14 @@ namespace Homme
 
 // ======================== IMPLEMENTATION ======================== //
 
+// Whether a connection should be skipped when packing only the shared
+// connections, or only the non-shared (local or missing) ones
+KOKKOS_INLINE_FUNCTION
+static bool skip_connection (const ConnectionInfo& info, const bool pack_shared, const bool pack_not_shared)
+{
+  return info.sharing==etoi(ConnectionSharing::SHARED) ? !pack_shared : !pack_not_shared;
+}
+
 // Separating these allocations into a small routine works around a Cuda 10/GCC
 // 7/C++14 internal error.
 template <typename A, typename B>
@@ -268,6 +276,57 @@ void BoundaryExchange::exchange (const ExecViewUnmanaged<const Real * [NP][NP]>*
   recv_and_unpack (rspheremp);
 }
 
+void BoundaryExchange::exchange_begin ()
+{
+  // Check that the registration has completed first
+  assert (m_registration_completed);
+
+  // Check that this object is setup to perform exchange and not exchange_min_max
+  assert (m_exchange_type==MPI_EXCHANGE);
+
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  if (!m_buffer_views_and_requests_built) {
+    build_buffer_views_and_requests();
+  }
+
+  if ( ! m_recv_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+  m_recv_pending = true;
+
+  // Only pack the connections shared with other ranks, and send them right away.
+  // The local connections are packed in exchange_end, so that, in between, the
+  // fields on elements with no shared connection can still be computed.
+  pack_and_send (true, false);
+}
+
+void BoundaryExchange::exchange_end () {
+  exchange_end(nullptr);
+}
+
+void BoundaryExchange::exchange_end (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  exchange_end(&rspheremp);
+}
+
+void BoundaryExchange::exchange_end (const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+{
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  // exchange_begin must have been called first
+  assert (m_send_pending && m_recv_pending);
+
+  // Pack the local connections (they do not go through MPI), then wait for the
+  // remote data and unpack everything
+  pack (false, true);
+
+  recv_and_unpack (rspheremp);
+}
+
 void BoundaryExchange::exchange_min_max ()
 {
   // Check that the registration has completed first
@@ -301,6 +360,11 @@ void BoundaryExchange::exchange_min_max ()
 }
 
 void BoundaryExchange::pack_and_send ()
+{
+  pack_and_send(true, true);
+}
+
+void BoundaryExchange::pack_and_send (const bool pack_shared, const bool pack_not_shared)
 {
   tstart("be pack_and_send");
   // The registration MUST be completed by now
@@ -329,6 +393,25 @@ void BoundaryExchange::pack_and_send ()
   }
 
   // ---- Pack ---- //
+  pack (pack_shared, pack_not_shared);
+  ExecSpace::impl_static_fence();
+
+  // ---- Send ---- //
+  tstart("be sync_send_buffer");
+  m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
+  tstop("be sync_send_buffer");
+  tstart("be send");
+  if ( ! m_send_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+
+  // Notify a send is ongoing
+  m_send_pending = true;
+  tstop("be pack_and_send");
+}
+
+void BoundaryExchange::pack (const bool pack_shared, const bool pack_not_shared)
+{
   // First, pack 2d fields (if any)...
   auto connections = m_connectivity->get_connections<ExecMemSpace>();
   if (m_num_2d_fields>0) {
@@ -338,6 +421,7 @@ void BoundaryExchange::pack_and_send ()
     Kokkos::parallel_for(MDRangePolicy<ExecSpace, 3>({0, 0, 0}, {m_num_elems, NUM_CONNECTIONS, m_num_2d_fields}, {1, 1, 1}),
                          KOKKOS_LAMBDA(const int ie, const int iconn, const int ifield) {
       const ConnectionInfo& info = connections(ie, iconn);
+      if (skip_connection(info, pack_shared, pack_not_shared)) return;
       const LidGidPos& field_lidpos  = info.local;
       // For the buffer, in case of local connection, use remote info. In fact, while with shared connections the
       // mpi call will take care of "copying" data to the remote recv buffer in the correct remote element lid,
@@ -366,6 +450,7 @@ void BoundaryExchange::pack_and_send ()
           const int iconn = (it / NUM_LEV) % NUM_CONNECTIONS;
           const int ilev = it % NUM_LEV;
           const ConnectionInfo& info = connections(ie, iconn);
+          if (skip_connection(info, pack_shared, pack_not_shared)) return;
           const LidGidPos& field_lidpos = info.local;
           // For the buffer, in case of local connection, use remote info. In fact, while with shared connections the
           // mpi call will take care of "copying" data to the remote recv buffer in the correct remote element lid,
@@ -400,6 +485,7 @@ void BoundaryExchange::pack_and_send ()
           for (int iconn = 0; iconn < 8; ++iconn) {
             const ConnectionInfo& info = connections(ie, iconn);
             if (info.kind == etoi(ConnectionSharing::MISSING)) continue;
+            if (skip_connection(info, pack_shared, pack_not_shared)) continue;
             const LidGidPos& field_lidpos = info.local;
             const LidGidPos& buffer_lidpos = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                               info.remote :
@@ -439,6 +525,7 @@ void BoundaryExchange::pack_and_send ()
           const int iconn = (it / NUM_LEV_P) % NUM_CONNECTIONS;
           const int ilev = it % NUM_LEV_P;
           const ConnectionInfo& info = connections(ie, iconn);
+          if (skip_connection(info, pack_shared, pack_not_shared)) return;
           const LidGidPos& field_lidpos = info.local;
           // For the buffer, in case of local connection, use remote info. In fact, while with shared connections the
           // mpi call will take care of "copying" data to the remote recv buffer in the correct remote element lid,
@@ -473,6 +560,7 @@ void BoundaryExchange::pack_and_send ()
           for (int iconn = 0; iconn < 8; ++iconn) {
             const ConnectionInfo& info = connections(ie, iconn);
             if (info.kind == etoi(ConnectionSharing::MISSING)) continue;
+            if (skip_connection(info, pack_shared, pack_not_shared)) continue;
             const LidGidPos& field_lidpos = info.local;
             const LidGidPos& buffer_lidpos = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                               info.remote :
@@ -497,20 +585,6 @@ void BoundaryExchange::pack_and_send ()
         });
     }
   }
-  ExecSpace::impl_static_fence();
-
-  // ---- Send ---- //
-  tstart("be sync_send_buffer");
-  m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
-  tstop("be sync_send_buffer");
-  tstart("be send");
-  if ( ! m_send_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
-
-  // Notify a send is ongoing
-  m_send_pending = true;
-  tstop("be pack_and_send");
 }
 
 void BoundaryExchange::recv_and_unpack () {
@@ -190,6 +190,14 @@ public:
   void exchange ();
   void exchange (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
 
+  // Same as exchange, but split in two calls, to overlap the MPI messages with
+  // computations: exchange_begin packs and sends the connections shared with other
+  // ranks, while exchange_end packs the local connections, then receives and unpacks.
+  // In between, the fields can only be modified on elements with no shared connection.
+  void exchange_begin ();
+  void exchange_end ();
+  void exchange_end (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+
   // Exchange all registered 1d fields, performing min/max operations with neighbors
   void exchange_min_max ();
 
@@ -296,8 +304,11 @@ private:
   void free_requests();
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void exchange_end(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void pack_and_send (const bool pack_shared, const bool pack_not_shared);
 public: // This is semantically private but must be public for nvcc.
   void recv_and_unpack(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void pack (const bool pack_shared, const bool pack_not_shared);
 };
 
 // ============================ REGISTER METHODS ========================= //
@@ -112,6 +112,8 @@ struct CaarFunctorImpl {
 #endif
 
   TeamPolicyType<TagPreExchange>   m_policy_pre;
+  // The post-exchange kernel only touches the surface, so use element batches
+  // (on GPU, this is one gll point per thread)
   Kokkos::RangePolicy<ExecSpace, TagPostExchange> m_policy_post;
   TeamPolicyType<TagDp3dLimiter>   m_policy_dp3d_lim;
 
@@ -133,7 +135,7 @@ struct CaarFunctorImpl {
       , m_deriv(ref_FE.get_deriv())
       , m_sphere_ops(sphere_ops)
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
-      , m_policy_post (0,m_num_elems*NP*NP)
+      , m_policy_post (Homme::get_elem_batch_policy<ExecSpace,TagPostExchange>(m_num_elems))
       , m_policy_dp3d_lim (Homme::get_default_team_policy<ExecSpace,TagDp3dLimiter>(m_num_elems))
       , m_tu(m_policy_pre)
   {
@@ -150,7 +152,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
-      , m_policy_post (0,num_elems*NP*NP)
+      , m_policy_post (Homme::get_elem_batch_policy<ExecSpace,TagPostExchange>(m_num_elems))
       , m_policy_dp3d_lim (Homme::get_default_team_policy<ExecSpace,TagDp3dLimiter>(m_num_elems))
       , m_tu(m_policy_pre)
   {}
@@ -415,7 +417,17 @@ struct CaarFunctorImpl {
   }
 
   KOKKOS_INLINE_FUNCTION
-  void operator()(const TagPostExchange&, const int idx) const {
+  void operator()(const TagPostExchange&, const int ibatch) const {
+    // Note: make sure you run this only in non-hydro mode
+    // This is a 2D kernel, so, on CPU, process a batch of elements per thread
+    ElemBatchVariables bv(ibatch,m_num_elems);
+    bv.for_each_point([&](const int ie, const int igp, const int jgp) {
+      apply_surface_bc(ie,igp,jgp);
+    });
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void apply_surface_bc (const int ie, const int igp, const int jgp) const {
     // For g
     using namespace PhysicalConstants;
 
@@ -426,12 +438,6 @@ struct CaarFunctorImpl {
     constexpr int LAST_INT_PACK     = InfoI::LastPack;
     constexpr int LAST_INT_PACK_END = InfoI::LastPackEnd;
 
-    // Note: make sure you run this only in non-hydro mode
-    // KernelVariables kv(team);
-    const int ie  = idx / (NP*NP);
-    const int igp = (idx / NP) % NP;
-    const int jgp =  idx % NP;
-
     auto& u = m_state.m_v(ie,m_data.np1,0,igp,jgp,LAST_MID_PACK)[LAST_MID_PACK_END];
     auto& v = m_state.m_v(ie,m_data.np1,1,igp,jgp,LAST_MID_PACK)[LAST_MID_PACK_END];
     auto& w = m_state.m_w_i(ie,m_data.np1,igp,jgp,LAST_INT_PACK)[LAST_INT_PACK_END];
@@ -709,12 +709,25 @@ void zoltan2_print_metrics(
       &(weighted_hops),
       &(total_weighted_hops));
 
+  //part_vertex_weights is computed from the whole graph, which each rank has,
+  //so no reduction is needed for the load imbalance.
+  double total_part_weight = 0;
+  double max_part_weight = 0;
+  for (int i = 0; i < np; ++i){
+    total_part_weight += part_vertex_weights[i];
+    max_part_weight = std::max(max_part_weight, part_vertex_weights[i]);
+  }
+  const double avg_part_weight = total_part_weight / np;
+
   if (myRank == 0){
     std::cout << "\tGLOBAL NUM MESSAGES:" << global_num_messages << std::endl
               << "\tMAX MESSAGES:       " << global_max_messages << std::endl
               << "\tGLOBAL EDGE CUT:    " << global_edge_cut << std::endl
               << "\tMAX EDGE CUT:       " << global_max_edge_cut << std::endl
-              << "\tTOTAL WEIGHTED HOPS:" << total_weighted_hops << std::endl;
+              << "\tTOTAL WEIGHTED HOPS:" << total_weighted_hops << std::endl
+              << "\tMAX PART WEIGHT:    " << max_part_weight << std::endl
+              << "\tAVG PART WEIGHT:    " << avg_part_weight << std::endl
+              << "\tLOAD IMBALANCE:     " << max_part_weight / avg_part_weight << std::endl;
 
   }
   delete [] machine_extent_wrap_around;
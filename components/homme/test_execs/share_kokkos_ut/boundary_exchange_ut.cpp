@@ -301,6 +301,46 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
     }}}}}}
   }
 
+  // Split exchange: exchange_begin packs and sends only the connections shared
+  // with other ranks, and exchange_end packs the local ones before unpacking.
+  // The result must match the one of exchange bit for bit.
+  // Note: this is checked here rather than in a separate test case, since the
+  //       f90 mpi and geometry initialization cannot be repeated.
+  {
+    genRandArray(field_3d_cxx,engine,dreal);
+    genRandArray(field_3d_int_cxx,engine,dreal);
+
+    decltype(field_3d_cxx_host)     field_3d_in     ("", num_elements), field_3d_ref     ("", num_elements);
+    decltype(field_3d_int_cxx_host) field_3d_int_in ("", num_elements), field_3d_int_ref ("", num_elements);
+    Kokkos::deep_copy(field_3d_in,     field_3d_cxx);
+    Kokkos::deep_copy(field_3d_int_in, field_3d_int_cxx);
+
+    be2->exchange();
+    Kokkos::deep_copy(field_3d_ref,     field_3d_cxx);
+    Kokkos::deep_copy(field_3d_int_ref, field_3d_int_cxx);
+
+    Kokkos::deep_copy(field_3d_cxx,     field_3d_in);
+    Kokkos::deep_copy(field_3d_int_cxx, field_3d_int_in);
+    be2->exchange_begin();
+    be2->exchange_end();
+    Kokkos::deep_copy(field_3d_cxx_host,     field_3d_cxx);
+    Kokkos::deep_copy(field_3d_int_cxx_host, field_3d_int_cxx);
+
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int itl=0; itl<NUM_TIME_LEVELS; ++itl) {
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+              for (int ivec=0; ivec<VECTOR_SIZE; ++ivec) {
+                REQUIRE(field_3d_cxx_host(ie,itl,igp,jgp,ilev)[ivec]==field_3d_ref(ie,itl,igp,jgp,ilev)[ivec]);
+            }}
+            for (int ilev=0; ilev<NUM_LEV_P; ++ilev) {
+              for (int ivec=0; ivec<VECTOR_SIZE; ++ivec) {
+                REQUIRE(field_3d_int_cxx_host(ie,itl,igp,jgp,ilev)[ivec]==field_3d_int_ref(ie,itl,igp,jgp,ilev)[ivec]);
+            }}
+    }}}}
+  }
+
   // Cleanup
   cleanup_f90();  // Deallocate stuff in the F90 module
   be1->clean_up();
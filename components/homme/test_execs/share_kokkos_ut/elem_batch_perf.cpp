@@ -0,0 +1,175 @@
+#include <catch2/catch.hpp>
+
+#include "Dimensions.hpp"
+#include "ExecSpaceDefs.hpp"
+#include "KernelVariables.hpp"
+#include "PhysicalConstants.hpp"
+#include "Types.hpp"
+#include "utilities/TestUtils.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+
+using namespace Homme;
+
+using rngAlg = std::mt19937_64;
+
+// Micro-benchmark for the element-batch execution mode of 2D kernels.
+// It runs the surface w_i b.c. of the CAAR post-exchange kernel with a flat
+// range policy over all gll points and with get_elem_batch_policy, checks
+// that they give the same answer, and prints the time per call of both.
+// On GPU the two policies are the same, so only the CPU timings are of interest.
+
+extern int hommexx_catch2_argc;
+extern char** hommexx_catch2_argv;
+
+namespace {
+
+// The problem size can be changed from the command line, as in
+//   elem_batch_perf hommexx -nelems NELEMS -nreps NREPS
+// The defaults are 1000 elements and 100 repetitions.
+void parse_command_line (int& nelems, int& nreps) {
+  nelems = 1000;
+  nreps = 100;
+  for (int i = 0; i < hommexx_catch2_argc; ++i) {
+    const std::string tok(hommexx_catch2_argv[i]);
+    if (i+1 == hommexx_catch2_argc) break;
+    if (tok == "-nelems") nelems = std::atoi(hommexx_catch2_argv[++i]);
+    else if (tok == "-nreps") nreps = std::atoi(hommexx_catch2_argv[++i]);
+  }
+}
+
+class ElemBatchPerf {
+public:
+
+  struct TagFlat {};
+  struct TagBatch {};
+
+  ElemBatchPerf (const int num_elems)
+   : m_num_elems(num_elems)
+   , m_np1(1)
+   , m_v("v",num_elems)
+   , m_gradphis("gradphis",num_elems)
+   , m_w_flat("w flat",num_elems)
+   , m_w_batch("w batch",num_elems)
+  {
+    std::random_device rd;
+    const unsigned int catchRngSeed = Catch::rngSeed();
+    const unsigned int seed = catchRngSeed==0 ? rd() : catchRngSeed;
+    std::cout << "seed: " << seed << (catchRngSeed==0 ? " (catch rng seed was 0)\n" : "\n");
+    rngAlg engine(seed);
+
+    std::uniform_real_distribution<Real> pdf(-1.0, 1.0);
+    genRandArray(m_v, engine, pdf);
+    genRandArray(m_gradphis, engine, pdf);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void surface_bc (const ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV_P]>& w_i,
+                   const int ie, const int igp, const int jgp) const {
+    constexpr int LAST_MID_PACK     = ColInfo<NUM_PHYSICAL_LEV>::LastPack;
+    constexpr int LAST_MID_PACK_END = ColInfo<NUM_PHYSICAL_LEV>::LastPackEnd;
+    constexpr int LAST_INT_PACK     = ColInfo<NUM_INTERFACE_LEV>::LastPack;
+    constexpr int LAST_INT_PACK_END = ColInfo<NUM_INTERFACE_LEV>::LastPackEnd;
+
+    w_i(ie,m_np1,igp,jgp,LAST_INT_PACK)[LAST_INT_PACK_END] =
+      (m_v(ie,m_np1,0,igp,jgp,LAST_MID_PACK)[LAST_MID_PACK_END]*m_gradphis(ie,0,igp,jgp) +
+       m_v(ie,m_np1,1,igp,jgp,LAST_MID_PACK)[LAST_MID_PACK_END]*m_gradphis(ie,1,igp,jgp)) / PhysicalConstants::g;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagFlat&, const int idx) const {
+    const int ie  = idx / (NP*NP);
+    const int igp = (idx / NP) % NP;
+    const int jgp =  idx % NP;
+    surface_bc(m_w_flat,ie,igp,jgp);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagBatch&, const int ibatch) const {
+    ElemBatchVariables bv(ibatch,m_num_elems);
+    bv.for_each_point([&](const int ie, const int igp, const int jgp) {
+      surface_bc(m_w_batch,ie,igp,jgp);
+    });
+  }
+
+  // Runs the kernel nreps times, and returns the average time per call (in seconds)
+  template<typename Policy>
+  double run (const Policy& policy, const int nreps) {
+    // Warm up
+    Kokkos::parallel_for(policy, *this);
+    Kokkos::fence();
+
+    Kokkos::Timer timer;
+    for (int i=0; i<nreps; ++i) {
+      Kokkos::parallel_for(policy, *this);
+    }
+    Kokkos::fence();
+    return timer.seconds() / nreps;
+  }
+
+  double run_flat (const int nreps) {
+    return run(Kokkos::RangePolicy<ExecSpace,TagFlat>(0,m_num_elems*NP*NP),nreps);
+  }
+
+  double run_batch (const int nreps) {
+    return run(Homme::get_elem_batch_policy<ExecSpace,TagBatch>(m_num_elems),nreps);
+  }
+
+  // Both versions perform the same operations, so they must match exactly
+  bool compare () const {
+    auto w_flat  = Kokkos::create_mirror_view(m_w_flat);
+    auto w_batch = Kokkos::create_mirror_view(m_w_batch);
+    Kokkos::deep_copy(w_flat,m_w_flat);
+    Kokkos::deep_copy(w_batch,m_w_batch);
+
+    constexpr int LAST_INT_PACK     = ColInfo<NUM_INTERFACE_LEV>::LastPack;
+    constexpr int LAST_INT_PACK_END = ColInfo<NUM_INTERFACE_LEV>::LastPackEnd;
+    for (int ie=0; ie<m_num_elems; ++ie) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          const Real f = w_flat(ie,m_np1,igp,jgp,LAST_INT_PACK)[LAST_INT_PACK_END];
+          const Real b = w_batch(ie,m_np1,igp,jgp,LAST_INT_PACK)[LAST_INT_PACK_END];
+          if (f!=b) {
+            return false;
+          }
+        }
+      }
+    }
+    return true;
+  }
+
+private:
+
+  const int m_num_elems;
+  const int m_np1;
+
+  ExecViewManaged<Scalar*[NUM_TIME_LEVELS][2][NP][NP][NUM_LEV]>  m_v;
+  ExecViewManaged<Real*[2][NP][NP]>                               m_gradphis;
+  ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV_P]>   m_w_flat;
+  ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV_P]>   m_w_batch;
+};
+
+} // anonymous namespace
+
+TEST_CASE("elem_batch_perf", "surface_bc") {
+  int nelems, nreps;
+  parse_command_line(nelems,nreps);
+  REQUIRE (nelems>0);
+  REQUIRE (nreps>0);
+
+  std::cout << "elem_batch_perf: nelems=" << nelems << ", nreps=" << nreps
+            << ", points per batch=" << ElemBatch<ExecSpace>::num_points << "\n";
+
+  ElemBatchPerf perf(nelems);
+
+  const double t_flat  = perf.run_flat(nreps);
+  const double t_batch = perf.run_batch(nreps);
+  REQUIRE (perf.compare());
+
+  std::cout << "  time per call (flat):  " << t_flat << " s\n"
+            << "  time per call (batch): " << t_batch << " s\n"
+            << "  speedup: " << (t_batch>0 ? t_flat/t_batch : 0) << "\n";
+}
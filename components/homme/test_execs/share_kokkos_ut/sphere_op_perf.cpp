@@ -0,0 +1,230 @@
+#include <catch2/catch.hpp>
+
+#include "Dimensions.hpp"
+#include "KernelVariables.hpp"
+#include "SphereOperators.hpp"
+#include "Types.hpp"
+#include "utilities/TestUtils.hpp"
+#include "utilities/SubviewUtils.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+
+using namespace Homme;
+
+using rngAlg = std::mt19937_64;
+
+// Micro-benchmark for the fused laplace operators of SphereOperators.
+// It checks that laplace_simple and laplace_tensor match the sequence of
+// unfused operators (gradient_sphere, tensor multiplication, divergence_sphere_wk)
+// they replace, and prints the time per call of both versions.
+
+extern int hommexx_catch2_argc;
+extern char** hommexx_catch2_argv;
+
+namespace {
+
+// The problem size can be changed from the command line, as in
+//   sphere_op_perf hommexx -nelems NELEMS -nreps NREPS
+// The defaults are 100 elements and 10 repetitions.
+void parse_command_line (int& nelems, int& nreps) {
+  nelems = 100;
+  nreps = 10;
+  for (int i = 0; i < hommexx_catch2_argc; ++i) {
+    const std::string tok(hommexx_catch2_argv[i]);
+    if (i+1 == hommexx_catch2_argc) break;
+    if (tok == "-nelems") nelems = std::atoi(hommexx_catch2_argv[++i]);
+    else if (tok == "-nreps") nreps = std::atoi(hommexx_catch2_argv[++i]);
+  }
+}
+
+class SphereOpPerf {
+public:
+
+  struct TagLaplaceFused {};
+  struct TagLaplaceUnfused {};
+  struct TagTensorFused {};
+  struct TagTensorUnfused {};
+
+  SphereOpPerf (const int num_elems)
+   : m_num_elems(num_elems)
+   , m_field("field",num_elems)
+   , m_tensor("tensor",num_elems)
+   , m_grad("grad",num_elems)
+   , m_out_fused("out fused",num_elems)
+   , m_out_unfused("out unfused",num_elems)
+  {
+    std::random_device rd;
+    const unsigned int catchRngSeed = Catch::rngSeed();
+    const unsigned int seed = catchRngSeed==0 ? rd() : catchRngSeed;
+    std::cout << "seed: " << seed << (catchRngSeed==0 ? " (catch rng seed was 0)\n" : "\n");
+    rngAlg engine(seed);
+
+    std::uniform_real_distribution<Real> pdf(-1.0, 1.0);
+    std::uniform_real_distribution<Real> pos_pdf(0.1, 1.0);
+
+    genRandArray(m_field, engine, pdf);
+    genRandArray(m_tensor, engine, pdf);
+
+    ExecViewManaged<Real [NP][NP]> dvv("dvv"), mp("mp");
+    ExecViewManaged<Real * [2][2][NP][NP]> d("d",num_elems), dinv("dinv",num_elems), metinv("metinv",num_elems);
+    ExecViewManaged<Real * [NP][NP]> metdet("metdet",num_elems), spheremp("spheremp",num_elems);
+    genRandArray(dvv, engine, pdf);
+    genRandArray(mp, engine, pos_pdf);
+    genRandArray(d, engine, pdf);
+    genRandArray(dinv, engine, pdf);
+    genRandArray(metinv, engine, pdf);
+    genRandArray(metdet, engine, pos_pdf);
+    genRandArray(spheremp, engine, pos_pdf);
+
+    m_sphere_ops.set_views(dvv,d,dinv,metinv,metdet,spheremp,mp);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagLaplaceFused&, const TeamMember& team) const {
+    KernelVariables kv(team);
+    m_sphere_ops.laplace_simple(kv,
+                                Homme::subview(m_field,kv.ie),
+                                Homme::subview(m_out_fused,kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagLaplaceUnfused&, const TeamMember& team) const {
+    KernelVariables kv(team);
+    const auto grad = Homme::subview(m_grad,kv.ie);
+    m_sphere_ops.gradient_sphere(kv, Homme::subview(m_field,kv.ie), grad);
+    m_sphere_ops.divergence_sphere_wk(kv, grad, Homme::subview(m_out_unfused,kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagTensorFused&, const TeamMember& team) const {
+    KernelVariables kv(team);
+    m_sphere_ops.laplace_tensor(kv,
+                                Homme::subview(m_tensor,kv.ie),
+                                Homme::subview(m_field,kv.ie),
+                                Homme::subview(m_out_fused,kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagTensorUnfused&, const TeamMember& team) const {
+    KernelVariables kv(team);
+    const auto grad = Homme::subview(m_grad,kv.ie);
+    const auto tensor = Homme::subview(m_tensor,kv.ie);
+    m_sphere_ops.gradient_sphere(kv, Homme::subview(m_field,kv.ie), grad);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP*NP),
+                         [&](const int loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV), [&] (const int& ilev) {
+        const Scalar g0 = grad(0,igp,jgp,ilev);
+        const Scalar g1 = grad(1,igp,jgp,ilev);
+        grad(0,igp,jgp,ilev) = tensor(0,0,igp,jgp) * g0 + tensor(1,0,igp,jgp) * g1;
+        grad(1,igp,jgp,ilev) = tensor(0,1,igp,jgp) * g0 + tensor(1,1,igp,jgp) * g1;
+      });
+    });
+    kv.team_barrier();
+    m_sphere_ops.divergence_sphere_wk(kv, grad, Homme::subview(m_out_unfused,kv.ie));
+  }
+
+  // Runs the kernel nreps times, and returns the average time per call (in seconds)
+  template<typename Tag>
+  double run (const int nreps) {
+    auto policy = Homme::get_default_team_policy<ExecSpace,Tag>(m_num_elems);
+    m_sphere_ops.allocate_buffers(policy);
+
+    // Warm up
+    Kokkos::parallel_for(policy, *this);
+    Kokkos::fence();
+
+    Kokkos::Timer timer;
+    for (int i=0; i<nreps; ++i) {
+      Kokkos::parallel_for(policy, *this);
+    }
+    Kokkos::fence();
+    return timer.seconds() / nreps;
+  }
+
+  // Returns max|fused-unfused| / max|unfused|
+  Real compare () const {
+    auto fused = Kokkos::create_mirror_view(m_out_fused);
+    auto unfused = Kokkos::create_mirror_view(m_out_unfused);
+    Kokkos::deep_copy(fused,m_out_fused);
+    Kokkos::deep_copy(unfused,m_out_unfused);
+
+    Real max_diff = 0, max_val = 0;
+    for (int ie=0; ie<m_num_elems; ++ie) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
+            const int ilev = k / VECTOR_SIZE;
+            const int ivec = k % VECTOR_SIZE;
+            const Real f = fused(ie,igp,jgp,ilev)[ivec];
+            const Real u = unfused(ie,igp,jgp,ilev)[ivec];
+            REQUIRE (!std::isnan(f));
+            max_diff = std::max(max_diff,std::fabs(f-u));
+            max_val  = std::max(max_val,std::fabs(u));
+          }
+        }
+      }
+    }
+    return max_val>0 ? max_diff/max_val : max_diff;
+  }
+
+private:
+
+  const int m_num_elems;
+
+  SphereOperators m_sphere_ops;
+
+  ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>     m_field;
+  ExecViewManaged<Real   * [2][2][NP][NP]>        m_tensor;
+  ExecViewManaged<Scalar * [2][NP][NP][NUM_LEV]>  m_grad;
+  ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>     m_out_fused;
+  ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>     m_out_unfused;
+};
+
+void check_and_report (const std::string& name, const Real rel_diff,
+                       const double t_fused, const double t_unfused) {
+  std::cout << "  " << name << ":\n"
+            << "    rel diff (fused vs unfused): " << rel_diff << "\n"
+            << "    time per call (unfused): " << t_unfused << " s\n"
+            << "    time per call (fused):   " << t_fused << " s\n"
+            << "    speedup: " << (t_fused>0 ? t_unfused/t_fused : 0) << "\n";
+
+#ifdef HOMMEXX_BFB_TESTING
+  // The fused operators perform exactly the same operations, in the same order.
+  REQUIRE (rel_diff==0);
+#else
+  // Without BFB flags, the compiler may contract the two versions differently.
+  REQUIRE (rel_diff<=1e-12);
+#endif
+}
+
+} // anonymous namespace
+
+TEST_CASE("sphere_op_perf", "fused_laplace") {
+  int nelems, nreps;
+  parse_command_line(nelems,nreps);
+  REQUIRE (nelems>0);
+  REQUIRE (nreps>0);
+
+  std::cout << "sphere_op_perf: nelems=" << nelems << ", nreps=" << nreps
+            << ", np=" << NP << ", nlev=" << NUM_PHYSICAL_LEV << "\n";
+
+  SphereOpPerf perf(nelems);
+
+  SECTION ("laplace_simple") {
+    const double t_unfused = perf.run<SphereOpPerf::TagLaplaceUnfused>(nreps);
+    const double t_fused   = perf.run<SphereOpPerf::TagLaplaceFused>(nreps);
+    check_and_report("laplace_simple",perf.compare(),t_fused,t_unfused);
+  }
+
+  SECTION ("laplace_tensor") {
+    const double t_unfused = perf.run<SphereOpPerf::TagTensorUnfused>(nreps);
+    const double t_fused   = perf.run<SphereOpPerf::TagTensorFused>(nreps);
+    check_and_report("laplace_tensor",perf.compare(),t_fused,t_unfused);
+  }
+}
@@ -0,0 +1,168 @@
+#include "compose_slmm_islmpi.hpp"
+
+#include "Context.hpp"
+#include "mpi/Comm.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+extern int hommexx_catch2_argc;
+extern char** hommexx_catch2_argv;
+
+// Benchmark for the communication pattern of the SL transport (islmpi). Each
+// step has the two phases of islmpi::step: departure points are sent to the
+// remote ranks, and q (plus q extrema) for qsize tracers come back. In both
+// phases there is one aggregated message per neighbor rank. We compare
+//   - per-step: irecv/isend/waitall at each phase, as islmpi used to do,
+//   - persistent: receives set up once with recv_init and restarted with start
+//     at each phase, as islmpi::setup_irecv does now,
+// for qsize ranging from 4 to 100, and print the time per step.
+//
+// Usage: compose_comm_perf hommexx -nelem NELEM -nlev NLEV -nstep NSTEP
+//   NELEM: number of elements on the boundary with each neighbor (default 16)
+//   NLEV:  number of levels (default 72)
+//   NSTEP: number of time steps (default 50)
+
+namespace {
+
+using homme::Real;
+namespace mpi = homme::mpi;
+
+struct Params {
+  int nelem = 16, nlev = 72, nstep = 50;
+  static constexpr int np2 = 16;
+
+  void parse_command_line () {
+    for (int i = 0; i < hommexx_catch2_argc; ++i) {
+      const std::string tok(hommexx_catch2_argv[i]);
+      if (i+1 == hommexx_catch2_argc) break;
+      if (tok == "-nelem") nelem = std::atoi(hommexx_catch2_argv[++i]);
+      else if (tok == "-nlev") nlev = std::atoi(hommexx_catch2_argv[++i]);
+      else if (tok == "-nstep") nstep = std::atoi(hommexx_catch2_argv[++i]);
+    }
+    nelem = std::max(1, nelem);
+    nlev = std::max(1, nlev);
+    nstep = std::max(1, nstep);
+  }
+
+  // Number of reals for departure points and for q, as in size_mpi_buffers.
+  int xcount () const { return 3*np2*nlev*nelem; }
+  int qcount (const int qsize) const { return (2 + np2)*qsize*nlev*nelem; }
+};
+
+class CommPattern {
+public:
+  CommPattern (const mpi::Parallel& p, const Params& prm, const int qsize)
+    : m_p(p), m_prm(prm), m_qsize(qsize)
+  {
+    // Ring of ranks: each rank talks to its left and right neighbors.
+    const int rank = p.rank(), size = p.size();
+    m_nbrs.push_back((rank + 1) % size);
+    const int left = (rank - 1 + size) % size;
+    if (left != m_nbrs[0]) m_nbrs.push_back(left);
+
+    const int n = std::max(prm.xcount(), prm.qcount(qsize));
+    const int nnbr = m_nbrs.size();
+    m_sendbuf.resize(nnbr, std::vector<Real>(n));
+    m_recvbuf.resize(nnbr, std::vector<Real>(n));
+    m_sendreq.resize(nnbr);
+    m_recvreq.resize(nnbr);
+    m_recvreq_pers.resize(nnbr);
+  }
+
+  double run (const bool persistent) {
+    const int nnbr = m_nbrs.size();
+    if (persistent)
+      for (int i = 0; i < nnbr; ++i)
+        mpi::recv_init(m_p, m_recvbuf[i].data(), m_recvbuf[i].size(), m_nbrs[i],
+                       42, &m_recvreq_pers[i]);
+
+    MPI_Barrier(m_p.comm());
+    const double t0 = MPI_Wtime();
+    for (int step = 0; step < m_prm.nstep; ++step) {
+      exchange(persistent, m_prm.xcount(), step);
+      exchange(persistent, m_prm.qcount(m_qsize), step);
+    }
+    const double t1 = MPI_Wtime();
+
+    if (persistent)
+      for (int i = 0; i < nnbr; ++i)
+        mpi::request_free(&m_recvreq_pers[i]);
+
+    double t = (t1 - t0)/m_prm.nstep, tmax;
+    MPI_Allreduce(&t, &tmax, 1, MPI_DOUBLE, MPI_MAX, m_p.comm());
+    return tmax;
+  }
+
+  int nerr () const { return m_nerr; }
+
+private:
+  const mpi::Parallel& m_p;
+  const Params& m_prm;
+  const int m_qsize;
+  std::vector<int> m_nbrs;
+  std::vector<std::vector<Real> > m_sendbuf, m_recvbuf;
+  std::vector<mpi::Request> m_sendreq, m_recvreq, m_recvreq_pers;
+  int m_nerr = 0;
+
+  static Real value (const int rank, const int step, const int i) {
+    return rank + 1e-3*step + 1e-9*i;
+  }
+
+  void exchange (const bool persistent, const int count, const int step) {
+    const int nnbr = m_nbrs.size(), rank = m_p.rank();
+    for (int i = 0; i < nnbr; ++i) {
+      if (persistent) {
+        m_recvreq[i].request = m_recvreq_pers[i].request;
+        mpi::start(&m_recvreq[i]);
+      } else {
+        mpi::irecv(m_p, m_recvbuf[i].data(), m_recvbuf[i].size(), m_nbrs[i], 42,
+                   &m_recvreq[i]);
+      }
+    }
+    for (int i = 0; i < nnbr; ++i) {
+      auto& s = m_sendbuf[i];
+      s[0] = value(rank, step, 0);
+      s[count-1] = value(rank, step, count-1);
+      mpi::isend(m_p, s.data(), count, m_nbrs[i], 42, &m_sendreq[i]);
+    }
+    mpi::waitall(nnbr, m_recvreq.data());
+    mpi::waitall(nnbr, m_sendreq.data());
+    for (int i = 0; i < nnbr; ++i) {
+      const auto& r = m_recvbuf[i];
+      if (r[0] != value(m_nbrs[i], step, 0) ||
+          r[count-1] != value(m_nbrs[i], step, count-1))
+        ++m_nerr;
+    }
+  }
+};
+
+} // namespace anon
+
+TEST_CASE ("compose_comm_perf") {
+  const auto& comm = Homme::Context::singleton().get<Homme::Comm>();
+  const mpi::Parallel p(comm.mpi_comm());
+
+  Params prm;
+  prm.parse_command_line();
+  if (p.amroot())
+    printf("compose_comm_perf> nrank %d nelem %d nlev %d nstep %d\n",
+           p.size(), prm.nelem, prm.nlev, prm.nstep);
+
+  for (const int qsize : {4, 10, 25, 50, 100}) {
+    CommPattern cp(p, prm, qsize);
+    const double t_step = cp.run(false);
+    const double t_pers = cp.run(true);
+    REQUIRE(cp.nerr() == 0);
+    if (p.amroot())
+      printf("compose_comm_perf> qsize %3d q msg %9.3e MB time/step:"
+             " per-step %9.3e s persistent %9.3e s ratio %5.3f\n",
+             qsize, prm.qcount(qsize)*sizeof(Real)/1e6, t_step, t_pers,
+             t_pers > 0 ? t_step/t_pers : 0.0);
+  }
+}
@@ -0,0 +1,61 @@
+#include "compose.hpp"
+#include "compose_test.hpp"
+
+#include "Context.hpp"
+#include "mpi/Comm.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+extern int hommexx_catch2_argc;
+extern char** hommexx_catch2_argv;
+
+// Benchmark for the QLT trees. QLT is run on a 1D mesh with the binary tree
+// over the mesh (the default) and with the node-aware tree, which first
+// reduces over the ranks of each node, then over nodes with the given fan-in.
+// Both must pass the QLT checks, and the time of each is printed. The
+// node-aware tree only differs from the default one when several ranks share
+// a node, so run this with as many ranks per node as in production.
+//
+// Usage: compose_qlt_perf hommexx -ncell NCELL -fanin FANIN -nrepeat NREPEAT
+//   NCELL:   number of cells per rank (default 1000)
+//   FANIN:   fan-in of the node-aware tree, >= 2 (default 4)
+//   NREPEAT: number of QLT runs after the first one (default 10)
+
+namespace {
+
+struct Params {
+  int ncell = 1000, fanin = 4, nrepeat = 10;
+
+  void parse_command_line () {
+    for (int i = 0; i < hommexx_catch2_argc; ++i) {
+      const std::string tok(hommexx_catch2_argv[i]);
+      if (i+1 == hommexx_catch2_argc) break;
+      if (tok == "-ncell") ncell = std::atoi(hommexx_catch2_argv[++i]);
+      else if (tok == "-fanin") fanin = std::atoi(hommexx_catch2_argv[++i]);
+      else if (tok == "-nrepeat") nrepeat = std::atoi(hommexx_catch2_argv[++i]);
+    }
+    ncell = std::max(1, ncell);
+    fanin = std::max(2, fanin);
+    nrepeat = std::max(0, nrepeat);
+  }
+};
+
+} // namespace anon
+
+TEST_CASE ("compose_qlt_perf") {
+  const auto& comm = Homme::Context::singleton().get<Homme::Comm>();
+
+  Params prm;
+  prm.parse_command_line();
+  if (comm.root())
+    printf("compose_qlt_perf> nrank %d ncell/rank %d fanin %d nrepeat %d\n",
+           comm.size(), prm.ncell, prm.fanin, prm.nrepeat);
+
+  REQUIRE(compose::test::cedr_qlt_tree_perftest(comm.mpi_comm(), prm.ncell*comm.size(),
+                                                prm.fanin, prm.nrepeat) == 0);
+}
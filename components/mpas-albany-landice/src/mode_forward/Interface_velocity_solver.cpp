@@ -89,6 +89,13 @@ exchangeList_Type const *sendVerticesList_F = 0, *recvVerticesList_F = 0;
 exchangeList_Type sendVerticesListReversed, recvVerticesListReversed,
     sendCellsListReversed, recvCellsListReversed;
 
+// Data reused across calls to velocity_solver_compute_2d_grid.
+// proc ranks owning the MPAS cells and vertices. They only depend on the MPAS halos.
+std::vector<int> fCellsProcIds, fVerticesProcIds;
+// entities whose ownership moves to or from this proc, as (index, new proc rank) pairs.
+// The reversed exchange lists depend only on these (see createReverseExchangeLists).
+std::vector<int> reversedVerticesKey, reversedCellsKey;
+
 exchange::exchange(int _procID, int const* vec_first, int const* vec_last,
     int fieldDim) :
     procID(_procID), vec(vec_first, vec_last), buffer(
@@ -180,6 +187,16 @@ void velocity_solver_set_grid_data(int const* _nCells_F, int const* _nEdges_F,
 
   thicknessOnCells.resize(nCellsSolve_F);
 
+  // The grid is new, so nothing computed so far can be reused
+  fCellsProcIds.clear();
+  fVerticesProcIds.clear();
+  reversedVerticesKey.clear();
+  reversedCellsKey.clear();
+  sendVerticesListReversed.clear();
+  recvVerticesListReversed.clear();
+  sendCellsListReversed.clear();
+  recvCellsListReversed.clear();
+
   sendCellsList_F = new exchangeList_Type(unpackMpiArray(sendCellsArray_F));
   recvCellsList_F = new exchangeList_Type(unpackMpiArray(recvCellsArray_F));
   sendEdgesList_F = new exchangeList_Type(unpackMpiArray(sendEdgesArray_F));
@@ -351,6 +368,7 @@ void velocity_solver_finalize() {
  */
 
 void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cellsMask_F, int const* _dirichletCellsMask_F) {
+  double startTime = MPI_Wtime();
   int numProcs, me;
   verticesMask_F = _verticesMask_F;
   cellsMask_F = _cellsMask_F;
@@ -359,6 +377,11 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
 
   MPI_Comm_size(comm, &numProcs);
   MPI_Comm_rank(comm, &me);
+
+  // Note: MPAS only calls this function when the dynamic ice or Dirichlet masks changed
+  // (see anyDynamicVertexMaskChanged and dirichletMaskChanged in mpas_li_velocity_external.F),
+  // or if config_always_compute_fem_grid is set, so the FE grid is always rebuilt here.
+
   std::vector<int> partialOffset(numProcs + 1), globalOffsetTriangles(
       numProcs + 1), globalOffsetVertices(numProcs + 1), globalOffsetEdge(
       numProcs + 1);
@@ -378,12 +401,16 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
   //vector containing proc ranks for owned and shared FE triangles
   trianglesProcIds.assign(nVertices_F,NotAnId);
 
-  //vector containing proc ranks for owned and shared MPAS cells
-  std::vector<int> fCellsProcIds(nCells_F);
-  getProcIds(fCellsProcIds, recvCellsList_F);
+  //vector containing proc ranks for owned and shared MPAS cells (computed only once)
+  if (int(fCellsProcIds.size()) != nCells_F) {
+    fCellsProcIds.resize(nCells_F);
+    getProcIds(fCellsProcIds, recvCellsList_F);
+  }
 #ifdef changeTrianglesOwnership
-  std::vector<int> fVerticesProcIds(nVertices_F);
-  getProcIds(fVerticesProcIds, recvVerticesList_F);
+  if (int(fVerticesProcIds.size()) != nVertices_F) {
+    fVerticesProcIds.resize(nVertices_F);
+    getProcIds(fVerticesProcIds, recvVerticesList_F);
+  }
   for (int i(0); i < nVertices_F; i++) {
     int cellWithMinID=nCellsSolve_F;
     if ((verticesMask_F[i] & dynamic_ice_bit_value)) {
@@ -458,7 +485,10 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
   // the data of the newly owned triangles. We do this by defining "reversed" send and receive lists, communicate back using those lists, and
   // then communicate "forward" using the usual send and receive lists.
   // We could join these two step in one communication, but for the moment we do that separately
-  createReverseExchangeLists(sendVerticesListReversed, recvVerticesListReversed, trianglesProcIds, indexToVertexID_F, recvVerticesList_F);
+  // The reversed lists only need to be rebuilt if the set of triangles moving to or from this proc changed.
+  if (updateReverseExchangeKey(reversedVerticesKey, trianglesProcIds, fVerticesProcIds, me)) {
+    createReverseExchangeLists(sendVerticesListReversed, recvVerticesListReversed, trianglesProcIds, indexToVertexID_F, recvVerticesList_F);
+  }
   allToAll(fVertexToTriangleID, &sendVerticesListReversed, &recvVerticesListReversed);
   allToAll(fVertexToTriangle, &sendVerticesListReversed, &recvVerticesListReversed);
   allToAll(trianglesProcIds, sendVerticesList_F, recvVerticesList_F);
@@ -692,7 +722,9 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
   // We could join these two step in one communication, but for the moment we do that separately.
   // We need to communicate info about the vertices when we get the ice velocity on vertices form the velocity solver/
 
-  createReverseExchangeLists(sendCellsListReversed, recvCellsListReversed, verticesProcIds, indexToCellID_F, recvCellsList_F);
+  if (updateReverseExchangeKey(reversedCellsKey, verticesProcIds, fCellsProcIds, me)) {
+    createReverseExchangeLists(sendCellsListReversed, recvCellsListReversed, verticesProcIds, indexToCellID_F, recvCellsList_F);
+  }
 
   //construct the local vector vertices on triangles making sure the area is positive
   verticesOnTria.resize(nTriangles * 3);
@@ -722,10 +754,11 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
 
 
   //call the velocity solver only on procs owning some FE triangles
-  if (isDomainEmpty)
-    return;
+  if (!isDomainEmpty)
+    velocity_solver_compute_2d_grid__(reducedComm);
 
-  velocity_solver_compute_2d_grid__(reducedComm);
+  std::cout << "velocity_solver_compute_2d_grid: built the 2d grid ("
+      << MPI_Wtime() - startTime << " s)" << std::endl;
 }
 
 void velocity_solver_extrude_3d_grid(double const* levelsRatio_F) {
@@ -733,6 +766,8 @@ void velocity_solver_extrude_3d_grid(double const* levelsRatio_F) {
   if (isDomainEmpty)
     return;
 
+  double startTime = MPI_Wtime();
+
   layersRatio.resize(nLayers);
   // !!Indexing of layers is reversed
   for (int i = 0; i < nLayers; i++)
@@ -770,6 +805,9 @@ void velocity_solver_extrude_3d_grid(double const* levelsRatio_F) {
       verticesCoords, verticesOnTria, procsSharingVertices, isBoundaryEdge,
       trianglesOnEdge, verticesOnEdge, indexToEdgeID,
       indexToTriangleID, dirichletNodesIDs, iceMarginEdgesGIds);
+
+  std::cout << "velocity_solver_extrude_3d_grid: extruded the 3d grid ("
+      << MPI_Wtime() - startTime << " s)" << std::endl;
   }
 
 // Function to set up how the MPAS log file will be used by Albany
@@ -1348,6 +1386,25 @@ void exportBeta(double * beta_F) {
   allToAll (beta_F,  sendCellsList_F, recvCellsList_F, 1);
 }
 
+bool updateReverseExchangeKey(std::vector<int>& key,
+    const std::vector<int>& newProcIds, const std::vector<int>& procIds, int me) {
+  // Same selection as the send and receive maps in createReverseExchangeLists
+  std::vector<int> newKey;
+  int nFEntities = newProcIds.size();
+  for (int fEntity = 0; fEntity < nFEntities; fEntity++) {
+    bool toMe = (procIds[fEntity] != me) && (newProcIds[fEntity] == me);
+    bool fromMe = (procIds[fEntity] == me) && (newProcIds[fEntity] != NotAnId) && (newProcIds[fEntity] != me);
+    if (toMe || fromMe) {
+      newKey.push_back(fEntity);
+      newKey.push_back(newProcIds[fEntity]);
+    }
+  }
+  if (newKey == key)
+    return false;
+  key.swap(newKey);
+  return true;
+}
+
 void createReducedMPI(int nLocalEntities, MPI_Comm& reduced_comm_id) {
   int numProcs, me;
   if (reduced_comm_id != MPI_COMM_NULL)
@@ -238,6 +238,11 @@ void get_prism_velocity_on_FEdges(double* uNormal,
 
 int initialize_iceProblem(int nTriangles);
 
+// Stores in key the entities whose ownership moves to or from proc me (procIds are the MPAS
+// owners, newProcIds the FE owners), and returns true if they changed
+bool updateReverseExchangeKey(std::vector<int>& key,
+    const std::vector<int>& newProcIds, const std::vector<int>& procIds, int me);
+
 void createReverseExchangeLists(exchangeList_Type& sendListReverse_F,
     exchangeList_Type& receiveListReverse_F,
     const std::vector<int>& newProcIds, const int* indexToID_F, exchangeList_Type const * recvList_F);
@@ -7,6 +7,10 @@
 
 #include "ekat/ekat_assert.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
+#include "ekat/ekat_parse_yaml_file.hpp"
+
+#include <functional>
+#include <iostream>
 
 namespace scream {
 
@@ -147,6 +151,25 @@ void AtmosphereDriver::create_fields()
     m_field_mgrs[grid->name()]->registration_begins();
   }
 
+  // Set the memory placement of the fields (see MemoryPlacement). The 'Fields'
+  // entry sets the default, while the 'Groups' sublist can override it for
+  // the fields of specific groups, on all grids.
+  if (m_atm_params.isSublist("Memory Placement")) {
+    const auto& mp_pl = m_atm_params.sublist("Memory Placement");
+    for (auto it : m_field_mgrs) {
+      auto fm = it.second;
+      if (mp_pl.isParameter("Fields")) {
+        fm->set_memory_placement(str2memory_placement(mp_pl.get<std::string>("Fields")));
+      }
+      if (mp_pl.isSublist("Groups")) {
+        const auto& groups_pl = mp_pl.sublist("Groups");
+        for (auto g=groups_pl.params_names_cbegin(); g!=groups_pl.params_names_cend(); ++g) {
+          fm->set_memory_placement(*g,str2memory_placement(groups_pl.get<std::string>(*g)));
+        }
+      }
+    }
+  }
+
   // Register required/computed fields
   for (const auto& req : m_atm_process_group->get_required_field_requests()) {
     m_field_mgrs.at(req.fid.get_grid_name())->register_field(req);
@@ -208,12 +231,64 @@ void AtmosphereDriver::create_fields()
   process_imported_groups (m_atm_process_group->get_required_group_requests());
   process_imported_groups (m_atm_process_group->get_computed_group_requests());
 
+  // Let fields that only need to hold their value within the atm time step share
+  // memory, if their lifetimes do not overlap. The lifetimes are computed from the
+  // atm procs dag, created from the field requests only, since groups are not
+  // available until registration ends (fields in groups are never aliased).
+  // Fields in the output streams must hold their value until the end of the step.
+  // So do the surface coupling imports/exports, which are not known yet, and which need
+  // to be listed in 'Persistent Fields', together with any other field that
+  // should not be aliased. SurfaceCoupling errors out if one of them is aliased.
+  if (m_atm_params.isSublist("Field Memory Planner")) {
+    auto& fmp_pl = m_atm_params.sublist("Field Memory Planner");
+    if (fmp_pl.get<bool>("Enable",false)) {
+      using vos_t = std::vector<std::string>;
+      const auto& persistent_fields = fmp_pl.get<vos_t>("Persistent Fields",vos_t{});
+      std::set<std::string> persistent(persistent_fields.begin(),persistent_fields.end());
+
+      auto& io_params = m_atm_params.sublist("Scorpio");
+      const auto& output_yaml_files = io_params.get<vos_t>("Output YAML Files",vos_t{});
+      for (const auto& fname : output_yaml_files) {
+        ekat::ParameterList params;
+        ekat::parse_yaml_file(fname,params);
+        if (params.isParameter("Fields")) {
+          const auto& names = params.get<vos_t>("Fields");
+          persistent.insert(names.begin(),names.end());
+        } else if (params.isSublist("Fields")) {
+          const auto& fields_pl = params.sublist("Fields");
+          for (auto it=fields_pl.params_names_cbegin(); it!=fields_pl.params_names_cend(); ++it) {
+            const auto& names = fields_pl.get<vos_t>(*it);
+            persistent.insert(names.begin(),names.end());
+          }
+        }
+      }
+
+      AtmProcDAG dag;
+      dag.create_dag(*m_atm_process_group,{});
+
+      std::map<std::string,std::map<std::string,AtmProcDAG::lifetime_type>> lifetimes;
+      for (const auto& it : dag.compute_field_lifetimes(persistent)) {
+        lifetimes[it.first.get_grid_name()][it.first.name()] = it.second;
+      }
+      for (const auto& it : lifetimes) {
+        m_field_mgrs.at(it.first)->set_field_lifetimes(it.second);
+      }
+    }
+  }
+
   // Close the FM's, allocate all fields
   for (auto it : m_grids_manager->get_repo()) {
     auto grid = it.second;
     m_field_mgrs[grid->name()]->registration_ends();
   }
 
+  // Print how much memory the fields use, and how much was saved by aliasing
+  if (m_atm_params.isSublist("Field Memory Planner") && m_atm_comm.am_i_root()) {
+    for (const auto& it : m_field_mgrs) {
+      it.second->print_memory_report(std::cout);
+    }
+  }
+
   // Set all the fields/groups in the processes. Input fields/groups will be handed
   // to the processes with const scalar type (const Real), to prevent them from
   // overwriting them (though, they can always cast away const...).
@@ -265,6 +340,29 @@ void AtmosphereDriver::initialize_output_managers (const bool restarted_run) {
   // Check for model restart output
   if (io_params.isSublist("Model Restart")) {
     auto restart_pl = io_params.sublist("Model Restart");
+
+    // Processes that do not run at every step hold the tendencies of their last run,
+    // which are not saved in the restart files. So a restart must happen on a step
+    // where all these processes run, i.e., the restart frequency (in atm steps)
+    // must be a multiple of their run frequencies.
+    const int restart_freq = restart_pl.sublist("Output Control").get<int>("Frequency");
+    std::function<void(const AtmosphereProcessGroup&,const int)> check_run_freq;
+    check_run_freq = [&](const AtmosphereProcessGroup& group, const int group_freq) {
+      for (int i=0; i<group.get_num_processes(); ++i) {
+        const auto freq = group_freq*group.get_run_frequency(i);
+        const auto proc = group.get_process(i);
+        EKAT_REQUIRE_MSG (restart_freq % freq == 0,
+            "Error! The restart frequency is not a multiple of the run frequency of an atm process.\n"
+            "   atm process: " + proc->name() + "\n"
+            "   restart frequency: " + std::to_string(restart_freq) + "\n"
+            "   run frequency: " + std::to_string(freq) + "\n");
+        if (proc->type()==AtmosphereProcessType::Group) {
+          check_run_freq(*std::dynamic_pointer_cast<const AtmosphereProcessGroup>(proc),freq);
+        }
+      }
+    };
+    check_run_freq(*m_atm_process_group,1);
+
     // Signal that this is not a normal output, but the model restart one
     m_output_managers.emplace_back();
     auto& om = m_output_managers.back();
@@ -610,6 +708,14 @@ void AtmosphereDriver::initialize_atm_procs ()
 {
   // Initialize memory buffer for all atm processes
   m_memory_buffer = std::make_shared<ATMBufferManager>();
+  if (m_atm_params.isSublist("Memory Placement")) {
+    const auto& mp_pl = m_atm_params.sublist("Memory Placement");
+    if (mp_pl.isParameter("Buffer")) {
+      const int ncols = m_grids_manager->get_reference_grid()->get_num_local_dofs();
+      m_memory_buffer->set_memory_placement(str2memory_placement(mp_pl.get<std::string>("Buffer")),
+                                            std::max(ncols,1));
+    }
+  }
   m_atm_process_group->initialize_atm_memory_buffer(*m_memory_buffer);
 
   // Initialize the processes
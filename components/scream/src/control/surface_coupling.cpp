@@ -90,6 +90,11 @@ register_import(const std::string& fname,
 
     EKAT_REQUIRE_MSG (field.is_allocated(), "Error! Import field view has not been allocated yet.\n");
 
+    // Imports are set before the atm procs run, so the field must hold its value for the whole step
+    EKAT_REQUIRE_MSG (not m_field_mgr->is_aliased(fname),
+        "Error! Import field '" + fname + "' shares memory with other fields.\n"
+        "       Add it to 'Persistent Fields' in the 'Field Memory Planner' sublist.\n");
+
     EKAT_REQUIRE_MSG(cpl_idx>=0, "Error! Input cpl_idx is negative.\n");
 
     // Check that this cpl_idx wasn't already registered
@@ -160,6 +165,11 @@ register_export (const std::string& fname,
 
     EKAT_REQUIRE_MSG (field.is_allocated(), "Error! Export field view has not been allocated yet.\n");
 
+    // Exports are read after the atm procs run, so the field must hold its value for the whole step
+    EKAT_REQUIRE_MSG (not m_field_mgr->is_aliased(fname),
+        "Error! Export field '" + fname + "' shares memory with other fields.\n"
+        "       Add it to 'Persistent Fields' in the 'Field Memory Planner' sublist.\n");
+
     // Set view data ptr
     info.data = field.get_internal_view_data();
 
@@ -234,21 +244,32 @@ registration_ends (cpl_data_ptr_type cpl_imports_ptr,
     // Check input pointer
     EKAT_REQUIRE_MSG(cpl_imports_ptr!=nullptr, "Error! Data pointer for imports is null.\n");
 
-    // Setup the host and device 2d views
+    // Setup the host and device 2d views. If the device can access the cpl
+    // array, simply view it, otherwise create a buffer for the scream imports
     m_cpl_imports_view_h = decltype(m_cpl_imports_view_h)(cpl_imports_ptr,m_num_cols,m_num_cpl_imports);
-    m_cpl_imports_view_d = Kokkos::create_mirror_view(device_type(),m_cpl_imports_view_h);
+    if (cpl_data_on_device) {
+      m_cpl_imports_view_d = cpl_dview_type(cpl_imports_ptr,m_num_cols,m_num_cpl_imports);
+    } else {
+      m_cpl_imports_view_d = cpl_dview_type("cpl_imports",m_num_cols,m_num_scream_imports);
+      m_imports_buf_h = Kokkos::create_mirror_view(m_cpl_imports_view_d);
+    }
   }
 
   if (m_num_scream_exports>0) {
     // Check input pointer
     EKAT_REQUIRE_MSG(cpl_exports_ptr!=nullptr, "Error! Data pointer for exports is null.\n");
 
-    // Setup the host and device 2d views
-    m_cpl_exports_view_h = decltype(m_cpl_exports_view_h)(cpl_exports_ptr,m_num_cols,m_num_scream_exports);
-    m_cpl_exports_view_d = Kokkos::create_mirror_view(device_type(),m_cpl_exports_view_h);
-
-    // Deep copy to preserve any existing data in cpl_exports_ptr
-    Kokkos::deep_copy(m_cpl_exports_view_d,m_cpl_exports_view_h);
+    // Setup the host and device 2d views. If the device can access the cpl
+    // array, simply view it, otherwise create a buffer for the scream exports.
+    // Note: only the exported entries are written in the cpl array, so any
+    //       existing data in cpl_exports_ptr is preserved.
+    m_cpl_exports_view_h = decltype(m_cpl_exports_view_h)(cpl_exports_ptr,m_num_cols,m_num_cpl_exports);
+    if (cpl_data_on_device) {
+      m_cpl_exports_view_d = cpl_dview_type(cpl_exports_ptr,m_num_cols,m_num_cpl_exports);
+    } else {
+      m_cpl_exports_view_d = cpl_dview_type("cpl_exports",m_num_cols,m_num_scream_exports);
+      m_exports_buf_h = Kokkos::create_mirror_view(m_cpl_exports_view_d);
+    }
   }
 
   // Finally, mark registration as completed.
@@ -267,12 +288,25 @@ void SurfaceCoupling::do_import ()
   const auto scream_imports = m_scream_imports_dev;
   const auto cpl_imports_view_d = m_cpl_imports_view_d;
   const int num_cols = m_num_cols;
-
-  // Deep copy cpl host array to device
-  Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_view_h);
+  const int num_imports = m_num_scream_imports;
+  const bool in_place = cpl_data_on_device;
+
+  if (not in_place) {
+    // Gather the scream imports in the contiguous host buffer, then copy it to device
+    const auto cpl_imports_view_h = m_cpl_imports_view_h;
+    const auto scream_imports_h = m_scream_imports_host;
+    const auto imports_buf_h = m_imports_buf_h;
+    using host_policy_type = KokkosTypes<host_device_type>::RangePolicy;
+    Kokkos::parallel_for(host_policy_type(0,num_cols), [&](const int icol) {
+      for (int ifield=0; ifield<num_imports; ++ifield) {
+        imports_buf_h(icol,ifield) = cpl_imports_view_h(icol,scream_imports_h(ifield).cpl_idx);
+      }
+    });
+    Kokkos::deep_copy(m_cpl_imports_view_d,m_imports_buf_h);
+  }
 
   // Unpack the fields
-  auto unpack_policy = policy_type(0,m_num_scream_imports*num_cols);
+  auto unpack_policy = policy_type(0,num_imports*num_cols);
   Kokkos::parallel_for(unpack_policy, KOKKOS_LAMBDA(const int& i) {
     const int ifield = i / num_cols;
     const int icol   = i % num_cols;
@@ -280,7 +314,7 @@ void SurfaceCoupling::do_import ()
     const auto& info = scream_imports(ifield);
 
     auto offset = icol*info.col_stride + info.col_offset;
-    info.data[offset] = cpl_imports_view_d(icol,info.cpl_idx);
+    info.data[offset] = cpl_imports_view_d(icol,in_place ? info.cpl_idx : ifield);
   });
 }
 
@@ -157,11 +157,21 @@ protected:
   using cpl_dview_type = view_2d<device_type,double>;
   using cpl_hview_type = ekat::Unmanaged<view_2d<host_device_type,double>>;
 
-  cpl_dview_type       m_cpl_imports_view_d;
-  cpl_hview_type       m_cpl_imports_view_h;
-
-  cpl_dview_type       m_cpl_exports_view_d;
-  cpl_hview_type       m_cpl_exports_view_h;
+  // If the device can access host memory, the import/export kernels read/write
+  // the cpl arrays in place, and no copy is needed. Otherwise, only the scream
+  // imports/exports are packed in a contiguous (num_cols,num_scream_fields)
+  // buffer on host, which is moved to/from device with a single deep copy.
+  static constexpr bool cpl_data_on_device =
+    Kokkos::SpaceAccessibility<typename device_type::execution_space,Kokkos::HostSpace>::accessible;
+
+  // On device, the cpl array itself (if cpl_data_on_device=true), or the buffer
+  cpl_dview_type                   m_cpl_imports_view_d;
+  cpl_hview_type                   m_cpl_imports_view_h;
+  cpl_dview_type::HostMirror       m_imports_buf_h;
+
+  cpl_dview_type                   m_cpl_exports_view_d;
+  cpl_hview_type                   m_cpl_exports_view_h;
+  cpl_dview_type::HostMirror       m_exports_buf_h;
 
   // The following is only stored for debug/inspection routines
   std::set<FieldIdentifier>  m_imports_fids;
@@ -70,9 +70,12 @@ void SurfaceCoupling::do_export (const bool init_phase)
   const auto scream_exports = m_scream_exports_dev;
   const auto cpl_exports_view_d = m_cpl_exports_view_d;
   const int num_cols = m_num_cols;
+  const int num_exports = m_num_scream_exports;
+  const bool in_place = cpl_data_on_device;
 
-  // Pack the fields
-  auto pack_policy   = policy_type (0,m_num_scream_exports*num_cols);
+  // Pack the fields, directly in the cpl array if the device can access it,
+  // or in the contiguous device buffer otherwise
+  auto pack_policy   = policy_type (0,num_exports*num_cols);
   Kokkos::parallel_for(pack_policy, KOKKOS_LAMBDA(const int& i) {
     const int ifield = i / num_cols;
     const int icol   = i % num_cols;
@@ -83,12 +86,29 @@ void SurfaceCoupling::do_export (const bool init_phase)
     // since values have not been computed inside SCREAM at the time
     bool do_export = (!init_phase || info.do_initial_export);
     if (do_export) {
-      cpl_exports_view_d(icol,info.cpl_idx) = info.data[offset];
+      cpl_exports_view_d(icol,in_place ? info.cpl_idx : ifield) = info.data[offset];
     }
   });
 
-  // Deep copy fields from device to cpl host array
-  Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
+  if (not in_place) {
+    // Copy the buffer to host, then scatter the exported fields in the cpl array
+    Kokkos::deep_copy(m_exports_buf_h,m_cpl_exports_view_d);
+
+    const auto cpl_exports_view_h = m_cpl_exports_view_h;
+    const auto scream_exports_h = m_scream_exports_host;
+    const auto exports_buf_h = m_exports_buf_h;
+    using host_policy_type = KokkosTypes<host_device_type>::RangePolicy;
+    Kokkos::parallel_for(host_policy_type(0,num_cols), [&](const int icol) {
+      for (int ifield=0; ifield<num_exports; ++ifield) {
+        const auto& info = scream_exports_h(ifield);
+        if (!init_phase || info.do_initial_export) {
+          cpl_exports_view_h(icol,info.cpl_idx) = exports_buf_h(icol,ifield);
+        }
+      }
+    });
+  } else {
+    Kokkos::fence();
+  }
 }
 
 } // namespace control
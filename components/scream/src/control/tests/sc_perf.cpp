@@ -0,0 +1,110 @@
+#include "share/grid/point_grid.hpp"
+#include "control/surface_coupling.hpp"
+#include "share/util/scream_test_params.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// Microbenchmark for SurfaceCoupling::do_import/do_export.
+// It registers a number of 2d and 3d (at the surface) imports/exports, with
+// as many unused cpl imports as used ones (as in the mct coupling), and times
+// an import-export sequence. As a reference, it also times a deep copy of the
+// whole cpl arrays to/from a device mirror, which is what each coupling step
+// used to cost on top of the pack/unpack kernels. On host-only builds, the
+// import/export work in place on the cpl arrays, so no copy is done at all.
+// The problem size can be changed via the test params, e.g.
+//   ./sc_perf --ekat-test-params ncols=4096,nlevs=72,nfields=64,nreps=10
+// where nfields is the number of scream imports/exports.
+// The defaults are ncols=2048, nlevs=128, nfields=32, nreps=100.
+
+TEST_CASE ("surface_coupling_perf")
+{
+  using namespace scream;
+  using namespace ShortFieldTagsNames;
+  using namespace ekat::units;
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using device_type = control::SurfaceCoupling::device_type;
+
+  const int ncols   = get_test_param("ncols",2048);
+  const int nlevs   = get_test_param("nlevs",128);
+  const int nfields = get_test_param("nfields",32);
+  const int nreps   = get_test_param("nreps",100);
+  REQUIRE (ncols>0);
+  REQUIRE (nlevs>0);
+  REQUIRE (nfields>0);
+  REQUIRE (nreps>0);
+
+  ekat::Comm comm (MPI_COMM_WORLD);
+  auto grid = create_point_grid("my grid",ncols*comm.size(),nlevs,comm);
+
+  // Half the fields are 2d, half are 3d
+  auto fm = std::make_shared<FieldManager<Real>>(grid);
+  fm->registration_begins();
+  std::vector<std::string> names;
+  for (int i=0; i<nfields; ++i) {
+    names.push_back("f" + std::to_string(i));
+    const auto layout = i%2==0 ? FL{{COL},{ncols}} : FL{{COL,LEV},{ncols,nlevs}};
+    fm->register_field(FID(names.back(),layout,Pa,grid->name()));
+  }
+  fm->registration_ends();
+  for (const auto& n : names) {
+    fm->get_field(n).deep_copy(1.0);
+  }
+
+  // As in the mct coupling, not all cpl imports are used by scream
+  const int num_cpl_imports = 2*nfields;
+  control::SurfaceCoupling coupler(fm);
+  coupler.set_num_fields(num_cpl_imports,nfields,nfields);
+  for (int i=0; i<num_cpl_imports; ++i) {
+    coupler.register_import(i%2==0 ? names[i/2] : "unused",i);
+  }
+  for (int i=0; i<nfields; ++i) {
+    coupler.register_export(names[i],i);
+  }
+
+  std::vector<double> imports(ncols*num_cpl_imports,2.0);
+  std::vector<double> exports(ncols*nfields,0.0);
+  coupler.registration_ends(imports.data(),exports.data());
+
+  // Warm up, and check correctness
+  coupler.do_import();
+  coupler.do_export();
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int i=0; i<nfields; ++i) {
+      REQUIRE (exports[icol*nfields+i]==2.0);
+    }
+  }
+
+  Kokkos::Timer timer;
+  for (int i=0; i<nreps; ++i) {
+    coupler.do_import();
+    coupler.do_export();
+  }
+  Kokkos::fence();
+  const double t_sc = timer.seconds() / nreps;
+
+  // Reference: copy the whole cpl arrays to/from device mirrors
+  using hview_t = ekat::Unmanaged<KokkosTypes<HostDevice>::view_2d<double>>;
+  hview_t imports_h (imports.data(),ncols,num_cpl_imports);
+  hview_t exports_h (exports.data(),ncols,nfields);
+  auto imports_d = Kokkos::create_mirror(device_type(),imports_h);
+  auto exports_d = Kokkos::create_mirror(device_type(),exports_h);
+  timer.reset();
+  for (int i=0; i<nreps; ++i) {
+    Kokkos::deep_copy(imports_d,imports_h);
+    Kokkos::deep_copy(exports_h,exports_d);
+  }
+  Kokkos::fence();
+  const double t_copy = timer.seconds() / nreps;
+
+  if (comm.am_i_root()) {
+    std::cout << "surface_coupling_perf: ncols=" << ncols << ", nlevs=" << nlevs
+              << ", nfields=" << nfields << ", nreps=" << nreps << "\n"
+              << "  import+export:              " << t_sc*1e6 << " us\n"
+              << "  full cpl arrays copy (ref): " << t_copy*1e6 << " us\n";
+  }
+}
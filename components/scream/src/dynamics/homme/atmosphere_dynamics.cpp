@@ -10,6 +10,8 @@
 #include "Diagnostics.hpp"
 #include "DirkFunctor.hpp"
 #include "ForcingFunctor.hpp"
+#include "GllFvRemap.hpp"
+#include "GllFvRemapImpl.hpp"
 #include "CaarFunctor.hpp"
 #include "VerticalRemapManager.hpp"
 #include "HyperviscosityFunctor.hpp"
@@ -39,7 +41,11 @@ namespace scream
 HommeDynamics::HommeDynamics (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
 {
-  // Nothing to do here
+  // If > 0, measure the physics cost over this many steps, and write it as element weights
+  m_phys_cost_nsteps = m_params.get<int>("Partition Weights Spinup Steps",0);
+  m_phys_cost_file   = m_params.get<std::string>("Partition Weights File","homme_elem_weights.txt");
+  EKAT_REQUIRE_MSG (m_phys_cost_nsteps>=0,
+      "Error! 'Partition Weights Spinup Steps' must be non-negative.\n");
 }
 
 void HommeDynamics::set_grids (const std::shared_ptr<const GridsManager> grids_manager)
@@ -82,6 +88,9 @@ void HommeDynamics::set_grids (const std::shared_ptr<const GridsManager> grids_m
   const int ne = m_dyn_grid->get_num_local_dofs()/(NGP*NGP);
   const int ncols = m_ref_grid->get_num_local_dofs();
 
+  // On PGN physics grids, the phys-dyn coupling is done by Homme's GllFvRemap
+  m_fv_phys_active = rgn.find("Physics PG")==0;
+
   // Sanity check for the grid. This should *always* pass, since Homme builds the grids
   EKAT_REQUIRE_MSG(get_num_local_elems_f90()==ne,
       "Error! The number of elements computed from the Dynamics grid num_dof()\n"
@@ -163,12 +172,23 @@ void HommeDynamics::set_grids (const std::shared_ptr<const GridsManager> grids_m
   create_internal_field("FM",{COL,CMP,LEV},{ncols,3,NVL},m_ref_grid->name());
   create_internal_field("FT",{COL,    LEV},{ncols,  NVL},m_ref_grid->name());
 
+  if (m_fv_phys_active) {
+    // GllFvRemap also outputs phis and omega on the phys grid. Nobody
+    // needs them (yet), so we keep them as internal fields.
+    create_internal_field("phis", {COL    },{ncols    },m_ref_grid->name());
+    create_internal_field("omega",{COL,LEV},{ncols,NVL},m_ref_grid->name());
+  }
+
   // Dynamics backs out tendencies from the states, and passes those to Homme.
   // After Homme completes, we remap the updates state to the ref grid.
   // Thus, is more convenient to use two different remappers: the pd remapper
   // will remap into Homme's forcing views, while the dp remapper will remap
   // from Homme's states.
-  m_p2d_remapper = grids_manager->create_remapper_from_ref_grid(m_dyn_grid);
+  // Note: on PGN grids, GllFvRemap remaps forcings and states; the dp remapper
+  //       is only used for phi_int and w_int, which GllFvRemap does not handle.
+  if (not m_fv_phys_active) {
+    m_p2d_remapper = grids_manager->create_remapper_from_ref_grid(m_dyn_grid);
+  }
   m_d2p_remapper = grids_manager->create_remapper_to_ref_grid(m_dyn_grid);
 
   // Create separate remapper for Initial Conditions, since for those we
@@ -246,6 +266,12 @@ int HommeDynamics::requested_buffer_size_in_bytes() const
     const auto& dirk = c.get<DirkFunctor>();
     fbm.request_size(dirk.requested_buffer_size());
   }
+  if (m_fv_phys_active) {
+    // Note: the GllFvRemap object is created in initialize_impl, after scream's views
+    //       are set in Homme's structures, since it stores copies of those views.
+    //       A temporary object is enough to get the buffer size.
+    fbm.request_size(GllFvRemapImpl().requested_buffer_size());
+  }
 
   return fbm.allocated_size()*sizeof(Real);
 }
@@ -305,6 +331,21 @@ void HommeDynamics::initialize_impl ()
   // Sets the scream views into the hommexx internal data structures
   init_homme_views ();
 
+  auto& c = Homme::Context::singleton();
+  if (m_fv_phys_active) {
+    // Setup Homme's GllFvRemap, and load the remap operators computed in F90 (in phys_grids_init)
+    auto& params = c.get<Homme::SimulationParams>();
+    auto& gfr = c.create<Homme::GllFvRemap>();
+    gfr.reset(params);
+    gfr.init_buffers(c.get<Homme::FunctorsBuffersManager>());
+
+    // Note: gfr_init_hxx sets the forcing type in Homme's params from the F90 ftype,
+    //       following Homme's standalone conventions. Restore the one scream set.
+    const auto ftype = params.ftype;
+    gfr_init_hxx();
+    params.ftype = ftype;
+  }
+
   // Import I.C. from the ref grid to the dyn grid.
   import_initial_conditions ();
 
@@ -315,6 +356,11 @@ void HommeDynamics::initialize_impl ()
 
   // Complete homme model initialization
   prim_init_model_f90 ();
+
+  if (m_fv_phys_active) {
+    // GllFvRemap's boundary exchanges need Homme's MPI buffers, set in prim_init_model
+    c.get<Homme::GllFvRemap>().init_boundary_exchanges();
+  }
 }
 
 void HommeDynamics::run_impl (const int dt)
@@ -342,6 +388,26 @@ void HommeDynamics::run_impl (const int dt)
   }
 }
 
+bool HommeDynamics::measures_group_cost () const
+{
+  return m_phys_cost_step<m_phys_cost_nsteps;
+}
+
+void HommeDynamics::add_group_cost (const double seconds)
+{
+  // Note: this includes the time spent waiting in collectives, if any, so it
+  //       is an estimate of the physics cost of this rank.
+  m_phys_cost += seconds;
+  ++m_phys_cost_step;
+
+  if (m_phys_cost_step==m_phys_cost_nsteps) {
+    // Homme spreads the cost evenly over the elements of this rank.
+    const double rank_cost = m_phys_cost / m_phys_cost_nsteps;
+    const char* fname = m_phys_cost_file.c_str();
+    write_elem_weights_f90 (rank_cost, fname);
+  }
+}
+
 void HommeDynamics::finalize_impl (/* what inputs? */)
 {
   Homme::Context::singleton().finalize_singleton();
@@ -405,8 +471,13 @@ void HommeDynamics::homme_pre_process (const int dt) {
     }
   });
 
-  // Remap FT, FM, and Q
-  m_p2d_remapper->remap(true);
+  if (m_fv_phys_active) {
+    // Remap FT, FM, and Q with GllFvRemap
+    fv_phys_pre_process(dt);
+  } else {
+    // Remap FT, FM, and Q
+    m_p2d_remapper->remap(true);
+  }
 
   using namespace Homme;
   const auto& c = Context::singleton();
@@ -437,8 +508,12 @@ void HommeDynamics::homme_pre_process (const int dt) {
   // Depending on ftype, we are going to do different things:
   //  ftype=0: FQ = dp*(Qnew-Qold) / dt
   //  ftype=2: qdp = dp*Qnew
+  // Note: on PGN grids, with ftype=0 GllFvRemap already stores dp*(Qnew-Qold)/dt in FQ.
   switch(ftype) {
     case ForcingAlg::FORCING_DEBUG:
+      if (m_fv_phys_active) {
+        break;
+      }
       // Back out tracers tendency for Qdp
       Kokkos::parallel_for(Kokkos::RangePolicy<>(0,Q.size()),KOKKOS_LAMBDA(const int idx) {
         const int ie = idx / (qsize*NP*NP*NVL);
@@ -471,8 +546,13 @@ void HommeDynamics::homme_pre_process (const int dt) {
 void HommeDynamics::homme_post_process () {
   const auto& rgn = m_ref_grid->name();
 
-  // Remap outputs to ref grid
-  m_d2p_remapper->remap(true);
+  if (m_fv_phys_active) {
+    // Remap outputs to ref grid with GllFvRemap (this already produces T, rather than VTheta_dp)
+    fv_phys_post_process();
+  } else {
+    // Remap outputs to ref grid
+    m_d2p_remapper->remap(true);
+  }
 
   using KT = KokkosTypes<DefaultDevice>;
   constexpr int N = sizeof(Homme::Scalar) / sizeof(Real);
@@ -511,6 +591,7 @@ void HommeDynamics::homme_post_process () {
   const auto& hvcoord = c.get<Homme::HybridVCoord>();
   const auto ps0 = hvcoord.ps0 * hvcoord.hybrid_ai0;
 
+  const bool fv_phys = m_fv_phys_active;
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
     const int& icol = team.league_rank();
 
@@ -538,9 +619,11 @@ void HommeDynamics::homme_post_process () {
                          [&](const int ilev) {
       // VTheta_dp->VTheta->Theta->T
       auto& T_val = T(ilev);
-      T_val /= dp(ilev);
-      T_val = PF::calculate_temperature_from_virtual_temperature(T_val,qv(ilev));
-      T_val = PF::calculate_T_from_theta(T_val,p_mid(ilev));
+      if (not fv_phys) {
+        T_val /= dp(ilev);
+        T_val = PF::calculate_temperature_from_virtual_temperature(T_val,qv(ilev));
+        T_val = PF::calculate_T_from_theta(T_val,p_mid(ilev));
+      }
 
       // Store T, v (and possibly w) at end of the dyn timestep (to back out tendencies later)
       T_prev(ilev) = T_val;
@@ -551,6 +634,132 @@ void HommeDynamics::homme_post_process () {
       }
     });
   });
+
+  if (m_fv_phys_active) {
+    // Store Q at the end of the dyn timestep, to back out the tracers tendency later
+    const auto Q_prev_view = get_internal_field("Q_prev",rgn).get_view<Pack***>();
+    Kokkos::deep_copy(Q_prev_view,Q_view);
+  }
+}
+
+void HommeDynamics::fv_phys_pre_process (const int dt) {
+  using namespace Homme;
+  using KT = KokkosTypes<DefaultDevice>;
+  using GFR = GllFvRemap;
+
+  constexpr int N = sizeof(Homme::Scalar) / sizeof(Real);
+  using Pack = ekat::Pack<Real,N>;
+
+  const auto& rgn = m_ref_grid->name();
+  const auto& c = Context::singleton();
+  const auto& params = c.get<SimulationParams>();
+  auto& gfr = c.get<GllFvRemap>();
+
+  const int nelem = m_dyn_grid->get_num_local_dofs()/(NP*NP);
+  const int ncols = m_ref_grid->get_num_local_dofs();
+  const int nf2   = ncols / nelem;
+  const int nlevs = m_ref_grid->get_num_vertical_levels();
+  const int npacks = ekat::PackInfo<N>::num_packs(nlevs);
+  const int qsize = params.qsize;
+
+  // GllFvRemap views are (ie,col[,idx],lev), with lev a multiple of the pack size.
+  // Scream's fields on the phys grid are (col[,idx],lev), and col=ie*nf2+k,
+  // so we simply reshape the views.
+  const int nlevs_pad = npacks*N;
+
+  auto& Q = *get_group_out("Q",rgn).m_bundle;
+  const auto FT = get_field_out("T_mid_prev").get_view<Real**>();
+  const auto FM = get_field_out("horiz_winds_prev").get_view<Real***>();
+
+  // With ftype=2, GllFvRemap expects the new Q state (it does the qdp hard
+  // adjustment later); with ftype=0, it expects the tendency dp*(Qnew-Qold)/dt,
+  // which we back out (in place) in Q_prev.
+  auto q = Q.get_view<Real***>();
+  if (params.ftype==ForcingAlg::FORCING_DEBUG) {
+    auto& Q_prev = get_internal_field("Q_prev",rgn);
+    const auto dp     = get_field_out("pseudo_density").get_view<Pack**>();
+    const auto q_new  = Q.get_view<Pack***>();
+    const auto dq     = Q_prev.get_view<Pack***>();
+    Kokkos::parallel_for(KT::RangePolicy(0,ncols*qsize*npacks),
+                         KOKKOS_LAMBDA(const int& idx) {
+      const int icol =  idx / (qsize*npacks);
+      const int iq   = (idx / npacks) % qsize;
+      const int ilev =  idx % npacks;
+
+      // dq is currently storing q_prev
+      auto& dq_val = dq(icol,iq,ilev);
+      dq_val = dp(icol,ilev)*(q_new(icol,iq,ilev)-dq_val) / dt;
+    });
+    q = Q_prev.get_view<Real***>();
+  }
+  Kokkos::fence();
+
+  const int n0 = c.get<TimeLevel>().n0;
+  gfr.run_fv_phys_to_dyn(n0, dt,
+                         GFR::CPhys2T(FT.data(),nelem,nf2,nlevs_pad),
+                         GFR::CPhys3T(FM.data(),nelem,nf2,2,nlevs_pad),
+                         GFR::CPhys3T(q.data(),nelem,nf2,qsize,nlevs_pad));
+  Kokkos::fence();
+  gfr.run_fv_phys_to_dyn_dss();
+  Kokkos::fence();
+}
+
+void HommeDynamics::fv_phys_post_process () {
+  using namespace Homme;
+  using KT = KokkosTypes<DefaultDevice>;
+  using GFR = GllFvRemap;
+
+  constexpr int N = sizeof(Homme::Scalar) / sizeof(Real);
+
+  const auto& rgn = m_ref_grid->name();
+  const auto& c = Context::singleton();
+  const auto& params = c.get<SimulationParams>();
+  const auto& hvcoord = c.get<HybridVCoord>();
+  auto& gfr = c.get<GllFvRemap>();
+
+  const int nelem = m_dyn_grid->get_num_local_dofs()/(NP*NP);
+  const int ncols = m_ref_grid->get_num_local_dofs();
+  const int nf2   = ncols / nelem;
+  const int nlevs = m_ref_grid->get_num_vertical_levels();
+  const int npacks = ekat::PackInfo<N>::num_packs(nlevs);
+  const int nlevs_pad = npacks*N;
+  const int qsize = params.qsize;
+
+  const auto ps    = get_field_out("ps").get_view<Real*>();
+  const auto T     = get_field_out("T_mid").get_view<Real**>();
+  const auto uv    = get_field_out("horiz_winds").get_view<Real***>();
+  const auto q     = get_group_out("Q",rgn).m_bundle->get_view<Real***>();
+  const auto phis  = get_internal_field("phis",rgn).get_view<Real*>();
+  const auto omega = get_internal_field("omega",rgn).get_view<Real**>();
+
+  const int n0 = c.get<TimeLevel>().n0;
+  gfr.run_dyn_to_fv_phys(n0,
+                         GFR::Phys1T(ps.data(),nelem,nf2),
+                         GFR::Phys1T(phis.data(),nelem,nf2),
+                         GFR::Phys2T(T.data(),nelem,nf2,nlevs_pad),
+                         GFR::Phys2T(omega.data(),nelem,nf2,nlevs_pad),
+                         GFR::Phys3T(uv.data(),nelem,nf2,2,nlevs_pad),
+                         GFR::Phys3T(q.data(),nelem,nf2,qsize,nlevs_pad));
+  Kokkos::fence();
+
+  // GllFvRemap does not handle phi_int and w_int, so remap them with the dp remapper
+  m_d2p_remapper->remap(true);
+
+  // The pseudo density on the FV grid is the reference one from ps,
+  // consistently with what GllFvRemap uses internally.
+  const auto dp = get_field_out("pseudo_density").get_view<Real**>();
+  const ExecViewUnmanaged<const Real*> hyai_delta(
+      reinterpret_cast<const Real*>(hvcoord.hybrid_ai_delta.data()),nlevs_pad);
+  const ExecViewUnmanaged<const Real*> hybi_delta(
+      reinterpret_cast<const Real*>(hvcoord.hybrid_bi_delta.data()),nlevs_pad);
+  const Real ps0 = hvcoord.ps0;
+  Kokkos::parallel_for(KT::RangePolicy(0,ncols*nlevs),
+                       KOKKOS_LAMBDA(const int& idx) {
+    const int icol = idx / nlevs;
+    const int ilev = idx % nlevs;
+    dp(icol,ilev) = hyai_delta(ilev)*ps0 + hybi_delta(ilev)*ps(icol);
+  });
+  Kokkos::fence();
 }
 
 void HommeDynamics::
@@ -660,22 +869,25 @@ void HommeDynamics::import_initial_conditions () {
   const auto& rgn = m_ref_grid->name();
 
   // Setup the p2d and d2p remappers
-  m_p2d_remapper->registration_begins();
-  m_d2p_remapper->registration_begins();
-
-  m_p2d_remapper->register_field(get_field_out("T_mid_prev"),get_internal_field("FT",dgn));
-  m_p2d_remapper->register_field(get_field_out("horiz_winds_prev"),get_internal_field("FM",dgn));
-  m_p2d_remapper->register_field(*get_group_out("Q",rgn).m_bundle, get_internal_field("FQ",dgn));
+  // Note: on PGN grids, GllFvRemap handles all fields but phi_int and w_int.
+  if (not m_fv_phys_active) {
+    m_p2d_remapper->registration_begins();
+    m_p2d_remapper->register_field(get_field_out("T_mid_prev"),get_internal_field("FT",dgn));
+    m_p2d_remapper->register_field(get_field_out("horiz_winds_prev"),get_internal_field("FM",dgn));
+    m_p2d_remapper->register_field(*get_group_out("Q",rgn).m_bundle, get_internal_field("FQ",dgn));
+    m_p2d_remapper->registration_ends();
+  }
 
-  m_d2p_remapper->register_field(get_internal_field("vtheta_dp",dgn),get_field_out("T_mid"));
-  m_d2p_remapper->register_field(get_internal_field("v",dgn),get_field_out("horiz_winds"));
-  m_d2p_remapper->register_field(get_internal_field("dp3d",dgn), get_field_out("pseudo_density"));
+  m_d2p_remapper->registration_begins();
   m_d2p_remapper->register_field(get_internal_field("phinh_i",dgn), get_field_out("phi_int"));
   m_d2p_remapper->register_field(get_internal_field("w_i",dgn), get_field_out("w_int"));
-  m_d2p_remapper->register_field(get_internal_field("ps",dgn), get_field_out("ps"));
-  m_d2p_remapper->register_field(*get_group_out("Q",dgn).m_bundle,*get_group_out("Q",rgn).m_bundle);
-
-  m_p2d_remapper->registration_ends();
+  if (not m_fv_phys_active) {
+    m_d2p_remapper->register_field(get_internal_field("vtheta_dp",dgn),get_field_out("T_mid"));
+    m_d2p_remapper->register_field(get_internal_field("v",dgn),get_field_out("horiz_winds"));
+    m_d2p_remapper->register_field(get_internal_field("dp3d",dgn), get_field_out("pseudo_density"));
+    m_d2p_remapper->register_field(get_internal_field("ps",dgn), get_field_out("ps"));
+    m_d2p_remapper->register_field(*get_group_out("Q",dgn).m_bundle,*get_group_out("Q",rgn).m_bundle);
+  }
   m_d2p_remapper->registration_ends();
 
   // Setup, run, and destroy the IC remapper, to remap IC directly into Homme's states
@@ -697,11 +909,19 @@ void HommeDynamics::import_initial_conditions () {
   // It would be tempting to init Q_prev on ref grid with the value of Q on the
   // ref grid, but that's not necessarily the same (it depends on the atm procs
   // order in the atm DAG). So we just create a remapper dyn->ref on the fly
-  m_ic_remapper_bwd->registration_begins();
-  m_ic_remapper_bwd->register_field(get_internal_field("Q_prev",rgn),*get_group_out("Q",dgn).m_bundle);
-  m_ic_remapper_bwd->registration_ends();
-  m_ic_remapper_bwd->remap(false);
-  m_ic_remapper_bwd = nullptr;
+  // Note: on PGN grids, the tracers tendency is backed out on the ref grid, against
+  //       the value of Q that was remapped to the dyn grid, so we use the I.C. value.
+  if (m_fv_phys_active) {
+    Kokkos::deep_copy(get_internal_field("Q_prev",rgn).get_view<Real***>(),
+                      get_group_out("Q",rgn).m_bundle->get_view<Real***>());
+    m_ic_remapper_bwd = nullptr;
+  } else {
+    m_ic_remapper_bwd->registration_begins();
+    m_ic_remapper_bwd->register_field(get_internal_field("Q_prev",rgn),*get_group_out("Q",dgn).m_bundle);
+    m_ic_remapper_bwd->registration_ends();
+    m_ic_remapper_bwd->remap(false);
+    m_ic_remapper_bwd = nullptr;
+  }
 
   // Convert T->vtheta_dp (in place).
   constexpr int N = sizeof(Homme::Scalar) / sizeof(Real);
@@ -48,6 +48,13 @@ public:
   // Retrieves an internal field, given field name and grid name.
   const Field<Real>& get_internal_field (const std::string& name, const std::string& grid) const;
 
+  // The other processes in the group (i.e., physics) are timed over the first
+  // 'Partition Weights Spinup Steps' steps. Then their cost on this rank is written
+  // as element weights, which a later run can use for a zoltan2 partition (see
+  // Homme's partition_weights_file namelist option).
+  bool measures_group_cost () const;
+  void add_group_cost (const double seconds);
+
 #ifndef KOKKOS_ENABLE_CUDA
   // Cuda requires methods enclosing __device__ lambda's to be public
 protected:
@@ -55,6 +62,11 @@ protected:
   void homme_pre_process (const int dt);
   void homme_post_process ();
 
+  // Pre/post processing specific to finite volume (PGN) physics grids,
+  // where Homme's GllFvRemap takes care of the phys-dyn coupling.
+  void fv_phys_pre_process (const int dt);
+  void fv_phys_post_process ();
+
 #ifndef KOKKOS_ENABLE_CUDA
   // Cuda requires methods enclosing __device__ lambda's to be public
 protected:
@@ -105,6 +117,15 @@ protected:
   // The dynamics and reference grids
   std::shared_ptr<const AbstractGrid>  m_dyn_grid;
   std::shared_ptr<const AbstractGrid>  m_ref_grid;
+
+  // Whether the reference grid is a finite volume (PGN) physics grid
+  bool m_fv_phys_active = false;
+
+  // Physics cost measurement, for the element weights (see add_group_cost)
+  int         m_phys_cost_nsteps = 0;
+  int         m_phys_cost_step   = 0;
+  double      m_phys_cost        = 0;
+  std::string m_phys_cost_file;
 };
 
 } // namespace scream
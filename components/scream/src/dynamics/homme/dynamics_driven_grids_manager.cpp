@@ -1,6 +1,7 @@
 #include "dynamics/homme/dynamics_driven_grids_manager.hpp"
 #include "dynamics/homme/interface/scream_homme_interface.hpp"
 #include "dynamics/homme/physics_dynamics_remapper.hpp"
+#include "dynamics/homme/physics_dynamics_fv_remapper.hpp"
 
 #include "share/grid/se_grid.hpp"
 #include "share/grid/point_grid.hpp"
@@ -77,22 +78,28 @@ DynamicsDrivenGridsManager::do_create_remapper (const grid_ptr_type from_grid,
     "Error! Either source or target grid must be 'Dynamics'.\n");
 
   const bool p2d = to=="Dynamics";
+  const auto& phys = p2d ? from : to;
 
   auto dyn_grid = m_grids.at("Dynamics");
 
-  if (from=="Physics GLL" || to=="Physics GLL") {
+  remapper_ptr_type pd_remapper;
+  if (phys=="Physics GLL") {
     using PDR = PhysicsDynamicsRemapper<remapper_type::real_type>;
 
-    auto pd_remapper = std::make_shared<PDR>(m_grids.at("Physics GLL"),dyn_grid);
-    if (p2d) {
-      return pd_remapper;
-    } else {
-      return std::make_shared<InverseRemapper<Real>>(pd_remapper);
-    }
+    pd_remapper = std::make_shared<PDR>(m_grids.at(phys),dyn_grid);
+  } else if (phys=="Physics PG2" || phys=="Physics PG3" || phys=="Physics PG4") {
+    using PDFVR = PhysicsDynamicsFvRemapper<remapper_type::real_type>;
+
+    pd_remapper = std::make_shared<PDFVR>(m_grids.at(phys),dyn_grid);
+  } else {
+    ekat::error::runtime_abort("Error! P-D remapping not implemented for '" + phys + "' phys grid.\n");
+  }
+
+  if (p2d) {
+    return pd_remapper;
   } else {
-    ekat::error::runtime_abort("Error! P-D remapping only implemented for 'Physics GLL' phys grid.\n");
+    return std::make_shared<InverseRemapper<Real>>(pd_remapper);
   }
-  return nullptr;
 }
 
 void DynamicsDrivenGridsManager::
@@ -257,7 +264,7 @@ build_grid_codes () {
   constexpr int gll   =  0;  // Physics GLL
   constexpr int pg2   =  2;  // Physics PG2
   constexpr int pg3   =  3;  // Physics PG3
-  constexpr int pg4   =  3;  // Physics PG4
+  constexpr int pg4   =  4;  // Physics PG4
   constexpr int gll_t = 10;  // Physics GLL Twin
   constexpr int pg2_t = 12;  // Physics PG2 Twin
   constexpr int pg3_t = 13;  // Physics PG3 Twin
@@ -48,6 +48,12 @@ void prim_init_model_f90 ();
 void prim_run_f90 ();
 void prim_finalize_f90 ();
 
+// Write per-element weights for a rebalanced zoltan2 partition (see Homme's zoltan_mod)
+void write_elem_weights_f90 (const double& rank_cost, const char*& fname);
+
+// Phys-dyn remap on FV phys grids (defined in Homme's gllfvremap_mod)
+void gfr_init_hxx ();
+
 // Grids specs
 int get_nlev_f90 ();
 int get_np_f90 ();
@@ -0,0 +1,333 @@
+#ifndef SCREAM_PHYSICS_DYNAMICS_FV_REMAPPER_HPP
+#define SCREAM_PHYSICS_DYNAMICS_FV_REMAPPER_HPP
+
+#include "dynamics/homme/physics_dynamics_remapper.hpp"
+
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+// Homme includes
+#include "GllFvRemap.hpp"
+#include "GllFvRemapImpl.hpp"
+#include "ElementsGeometry.hpp"
+
+namespace scream
+{
+
+/*
+ * Remapper between a FV physics grid ("Physics PGN", with N*N columns
+ * per SE element) and the dynamics grid, built on the operators of
+ * Homme's GllFvRemap.
+ *
+ * The phys->dyn direction applies the f2g operator in each element, and
+ * then DSS-es the result; the dyn->phys direction applies the g2f operator.
+ * Both are linear, and do not enforce any property of the remapped field
+ * (e.g., positivity, or preservation of extrema). The dynamics state
+ * (T, uv, Q) should be remapped with GllFvRemap's run_dyn_to_fv_phys and
+ * run_fv_phys_to_dyn instead, which account for the vertical coordinate
+ * and limit the tracers. This class serves the remaining fields, the
+ * initial conditions, and the I/O on the FV grid.
+ *
+ * Note: vector fields (e.g., horiz_winds) are remapped component-wise.
+ *
+ * Note: the Homme GllFvRemap object must be created and initialized
+ *       (see HommeDynamics) before any remap is performed.
+ */
+
+template<typename RealType>
+class PhysicsDynamicsFvRemapper : public PhysicsDynamicsRemapper<RealType>
+{
+public:
+  using base_type       = PhysicsDynamicsRemapper<RealType>;
+  using field_type      = typename base_type::field_type;
+  using identifier_type = typename base_type::identifier_type;
+  using grid_ptr_type   = typename base_type::grid_ptr_type;
+
+  PhysicsDynamicsFvRemapper (const grid_ptr_type& phys_grid,
+                             const grid_ptr_type& dyn_grid);
+
+  ~PhysicsDynamicsFvRemapper () = default;
+
+protected:
+
+  void do_bind_field (const int ifield, const field_type& src, const field_type& tgt) override;
+  void do_registration_ends () override;
+
+  void do_remap_fwd () const override;
+  void do_remap_bwd () const override;
+
+  // Retrieve the remap operators from Homme's GllFvRemap
+  const Homme::GllFvRemapImpl::Data& get_gfr_data () const;
+
+#ifdef KOKKOS_ENABLE_CUDA
+public:
+#endif
+  // The fields are accessed as flat arrays of Real, with
+  //   phys(icol,is,k) = phys[icol*p_col + is*p_s + k]
+  //   dyn(ie,tl,is,igp,k) = dyn[ie*d_el + tl*d_tl + is*d_s + igp*d_gp + k]
+  // where is is the (flattened) index of all non-level dimensions other than
+  // the column/element ones, and igp is the gll point index within the element.
+  struct FvDims {
+    int ns, nlev;
+    int p_col, p_s;
+    int d_el, d_tl, d_s, d_gp;
+  };
+
+protected:
+
+  void setup_fv_dims ();
+
+  int m_num_elems;
+  int m_nf2;
+
+  KokkosTypes<DefaultDevice>::view_1d<FvDims>  fv_dims;
+};
+
+// ================= IMPLEMENTATION ================= //
+
+template<typename RealType>
+PhysicsDynamicsFvRemapper<RealType>::
+PhysicsDynamicsFvRemapper (const grid_ptr_type& phys_grid,
+                           const grid_ptr_type& dyn_grid)
+ : base_type(phys_grid,dyn_grid,typename base_type::NoP2DMapTag())
+{
+  m_num_elems = dyn_grid->get_num_local_dofs() / (HOMMEXX_NP*HOMMEXX_NP);
+  m_nf2 = phys_grid->get_num_local_dofs() / m_num_elems;
+
+  EKAT_REQUIRE_MSG (m_nf2*m_num_elems==phys_grid->get_num_local_dofs(),
+      "Error! The number of physics columns is not a multiple of the number of elements.\n"
+      "  - phys grid: " + phys_grid->name() + "\n"
+      "  - num phys cols: " + std::to_string(phys_grid->get_num_local_dofs()) + "\n"
+      "  - num elements : " + std::to_string(m_num_elems) + "\n");
+}
+
+template<typename RealType>
+void PhysicsDynamicsFvRemapper<RealType>::
+do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
+{
+  const bool last_field = this->m_state==RepoState::Closed &&
+                          (this->m_num_bound_fields+1)==this->m_num_registered_fields;
+
+  base_type::do_bind_field(ifield,src,tgt);
+
+  if (last_field) {
+    setup_fv_dims();
+  }
+}
+
+template<typename RealType>
+void PhysicsDynamicsFvRemapper<RealType>::
+do_registration_ends ()
+{
+  base_type::do_registration_ends();
+
+  if (this->m_num_bound_fields==this->m_num_registered_fields) {
+    setup_fv_dims();
+  }
+}
+
+template<typename RealType>
+void PhysicsDynamicsFvRemapper<RealType>::
+setup_fv_dims ()
+{
+  constexpr int NP2 = HOMMEXX_NP*HOMMEXX_NP;
+
+  fv_dims = decltype(fv_dims)("fv_dims",this->m_num_fields);
+  auto h_fv_dims = Kokkos::create_mirror_view(fv_dims);
+
+  for (int i=0; i<this->m_num_fields; ++i) {
+    const auto& ph = this->m_phys[i].get_header();
+    const auto& dh = this->m_dyn[i].get_header();
+    const auto& p_layout = ph.get_identifier().get_layout();
+    const auto& d_layout = dh.get_identifier().get_layout();
+    const auto& p_dims = p_layout.dims();
+
+    // Extent of the last dimension, including padding
+    auto last_extent = [](const FieldHeader& h) {
+      const auto& dims = h.get_identifier().get_layout().dims();
+      int n = h.get_alloc_properties().get_alloc_size() / sizeof(Real);
+      for (int j=0; j<static_cast<int>(dims.size())-1; ++j) {
+        n /= dims[j];
+      }
+      return n;
+    };
+    const int lp = last_extent(ph);
+    const int ld = last_extent(dh);
+
+    const auto lt = get_layout_type(p_layout.tags());
+    const bool is_3d = lt==LayoutType::Scalar3D || lt==LayoutType::Vector3D;
+    const int ntl = this->m_is_state_field[i] ? HOMMEXX_NUM_TIME_LEVELS : 1;
+
+    auto& d = h_fv_dims(i);
+    d.ns = 1;
+    for (int j=1; j<static_cast<int>(p_dims.size())-(is_3d ? 1 : 0); ++j) {
+      d.ns *= p_dims[j];
+    }
+    if (is_3d) {
+      d.nlev  = p_dims.back();
+      d.p_s   = lp;
+      d.p_col = d.ns*lp;
+      d.d_gp  = ld;
+    } else {
+      EKAT_REQUIRE_MSG (ld==HOMMEXX_NP,
+          "Error! Unexpected padding in the dynamics field '" + dh.get_identifier().name() + "'.\n");
+      d.nlev  = 1;
+      d.p_s   = 1;
+      d.p_col = lt==LayoutType::Scalar2D ? 1 : lp;
+      d.d_gp  = 1;
+    }
+    d.d_s  = NP2*d.d_gp;
+    d.d_tl = d.ns*d.d_s;
+    d.d_el = ntl*d.d_tl;
+
+    // Sanity check: dyn and phys fields must hold the same number of values per column
+    const int p_col_size = p_layout.size() / (m_num_elems*m_nf2);
+    const int d_col_size = d_layout.size() / (m_num_elems*ntl*NP2);
+    EKAT_REQUIRE_MSG (p_col_size==d_col_size,
+        "Error! Incompatible phys/dyn layouts for fields '" + ph.get_identifier().name() +
+        "' and '" + dh.get_identifier().name() + "'.\n");
+  }
+
+  Kokkos::deep_copy(fv_dims,h_fv_dims);
+}
+
+template<typename RealType>
+const Homme::GllFvRemapImpl::Data&
+PhysicsDynamicsFvRemapper<RealType>::get_gfr_data () const
+{
+  const auto& c = Homme::Context::singleton();
+  EKAT_REQUIRE_MSG (c.has<Homme::GllFvRemap>(),
+      "Error! Homme's GllFvRemap was not created. It must be set up before\n"
+      "       remapping fields between '" + this->m_phys_grid->name() + "' and '" +
+      this->m_dyn_grid->name() + "'.\n");
+
+  const auto& data = c.get<Homme::GllFvRemap>().get_impl().m_data;
+  EKAT_REQUIRE_MSG (data.nf2==m_nf2,
+      "Error! Homme's GllFvRemap was set up for a different physics grid.\n"
+      "  - GllFvRemap nf2: " + std::to_string(data.nf2) + "\n"
+      "  - phys grid nf2 : " + std::to_string(m_nf2) + "\n");
+  return data;
+}
+
+template<typename RealType>
+void PhysicsDynamicsFvRemapper<RealType>::
+do_remap_fwd() const
+{
+  using KT = KokkosTypes<DefaultDevice>;
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  constexpr int NP  = HOMMEXX_NP;
+  constexpr int NP2 = NP*NP;
+
+  const auto& c = Homme::Context::singleton();
+  const auto& tl = c.get<Homme::TimeLevel>();
+  const auto& geo = c.get<Homme::ElementsGeometry>();
+  const auto& gfr = get_gfr_data();
+
+  const int itl   = tl.n0;
+  const int nf2   = m_nf2;
+  const int nelem = m_num_elems;
+  const auto f2g        = gfr.f2g_remapd;
+  const auto fv_metdet  = gfr.fv_metdet;
+  const auto gll_metdet = geo.m_metdet;
+  const auto spheremp   = geo.m_spheremp;
+
+  const auto phys_ptrs  = this->phys_ptrs;
+  const auto dyn_ptrs   = this->dyn_ptrs;
+  const auto has_parent = this->has_parent;
+  const auto is_state   = this->is_state_field_dev;
+  const auto dims       = fv_dims;
+
+  // In each element, remap the FV values to the gll points, and multiply by
+  // spheremp, so that the BE can complete the DSS.
+  const auto policy = ESU::get_default_team_policy(this->m_num_fields*nelem,NP2);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int i  = team.league_rank() / nelem;
+    const int ie = team.league_rank() % nelem;
+    if (has_parent(i)) return;
+
+    const auto d = dims(i);
+    const int it = is_state(i) ? itl : 0;
+    const Real* x = phys_ptrs(i).ptr;
+          Real* y = dyn_ptrs(i).ptr + ie*d.d_el + it*d.d_tl;
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,d.ns*NP2),
+                         [&](const int idx) {
+      const int is = idx / NP2;
+      const int ig = idx % NP2;
+      const Real scale = spheremp(ie,ig/NP,ig%NP) / gll_metdet(ie,ig/NP,ig%NP);
+      Real* y_ig = y + is*d.d_s + ig*d.d_gp;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(team,d.nlev),
+                           [&](const int k) {
+        Real sum = 0;
+        for (int f=0; f<nf2; ++f) {
+          sum += f2g(ig,f)*fv_metdet(ie,f)*x[(ie*nf2+f)*d.p_col + is*d.p_s + k];
+        }
+        y_ig[k] = sum*scale;
+      });
+    });
+  });
+
+  // Exchange only the current time levels, and divide by the assembled spheremp.
+  // No need to fence before it, since the BE fences before sending.
+  this->m_be[tl.n0]->exchange(geo.m_rspheremp);
+}
+
+template<typename RealType>
+void PhysicsDynamicsFvRemapper<RealType>::
+do_remap_bwd() const
+{
+  using KT = KokkosTypes<DefaultDevice>;
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  constexpr int NP  = HOMMEXX_NP;
+  constexpr int NP2 = NP*NP;
+
+  const auto& c = Homme::Context::singleton();
+  const auto& tl = c.get<Homme::TimeLevel>();
+  const auto& geo = c.get<Homme::ElementsGeometry>();
+  const auto& gfr = get_gfr_data();
+
+  const int itl   = tl.n0;
+  const int nf2   = m_nf2;
+  const int nelem = m_num_elems;
+  const Real w_ff = gfr.w_ff;
+  const auto g2f        = gfr.g2f_remapd;
+  const auto fv_metdet  = gfr.fv_metdet;
+  const auto gll_metdet = geo.m_metdet;
+
+  const auto phys_ptrs  = this->phys_ptrs;
+  const auto dyn_ptrs   = this->dyn_ptrs;
+  const auto has_parent = this->has_parent;
+  const auto is_state   = this->is_state_field_dev;
+  const auto dims       = fv_dims;
+
+  const auto policy = ESU::get_default_team_policy(this->m_num_fields*nelem,nf2);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int i  = team.league_rank() / nelem;
+    const int ie = team.league_rank() % nelem;
+    if (has_parent(i)) return;
+
+    const auto d = dims(i);
+    const int it = is_state(i) ? itl : 0;
+    const Real* x = dyn_ptrs(i).ptr + ie*d.d_el + it*d.d_tl;
+          Real* y = phys_ptrs(i).ptr;
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,d.ns*nf2),
+                         [&](const int idx) {
+      const int is = idx / nf2;
+      const int f  = idx % nf2;
+      const Real scale = 1 / (w_ff*fv_metdet(ie,f));
+      Real* y_f = y + (ie*nf2+f)*d.p_col + is*d.p_s;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(team,d.nlev),
+                           [&](const int k) {
+        Real sum = 0;
+        for (int ig=0; ig<NP2; ++ig) {
+          sum += g2f(f,ig)*gll_metdet(ie,ig/NP,ig%NP)*x[is*d.d_s + ig*d.d_gp + k];
+        }
+        y_f[k] = sum*scale;
+      });
+    });
+  });
+}
+
+} // namespace scream
+
+#endif // SCREAM_PHYSICS_DYNAMICS_FV_REMAPPER_HPP
@@ -61,6 +61,13 @@ public:
 
 protected:
 
+  // Derived remappers that do not map phys columns onto dyn gll points
+  // (e.g., FV phys grids) skip the creation of the p2d map.
+  struct NoP2DMapTag {};
+  PhysicsDynamicsRemapper (const grid_ptr_type& phys_grid,
+                           const grid_ptr_type& dyn_grid,
+                           const NoP2DMapTag&);
+
   // Getters
   const identifier_type& do_get_src_field_id (const int ifield) const override {
     return m_phys[ifield].get_header().get_identifier();
@@ -129,8 +136,10 @@ public:
     Kokkos::Array<int,6> dims;
   };
 
-  struct RemapFwdTag {};
   struct RemapBwdTag {};
+  struct ZeroDynFlatTag {};
+  struct RemapFwdFlatTag {};
+  struct RemapBwdFlatTag {};
 
 protected:
 
@@ -145,7 +154,34 @@ protected:
   KokkosTypes<DefaultDevice>::view_1d<bool>     has_parent;
   KokkosTypes<DefaultDevice>::view_1d<Int>      pack_alloc_property;
   KokkosTypes<DefaultDevice>::view_1d<bool>     is_state_field_dev;
-  KokkosTypes<DefaultDevice>::view<int>         states_tl_idx;
+
+  // Time level of the states to remap. It is set at every remap, and the kernels
+  // get it as a member of their copy of this functor, so no copy to device is needed.
+  mutable int states_tl_idx;
+
+  // The fwd remap (and the bwd remap on CPU) use flat range policies over all the
+  // (field,column,level) entries. These are the offsets of each field in the entries
+  // of one element (for the zeroing of dyn) or of one column (for the remaps), and
+  // their totals. The index of an entry of field i in a kernel over N elements/columns
+  // is then in [N*offsets(i),N*offsets(i+1)). The total N*size can overflow int
+  // on large meshes, so the flat kernels use 64-bit indices.
+  KokkosTypes<DefaultDevice>::view_1d<int>      flat_zero_offsets;
+  KokkosTypes<DefaultDevice>::view_1d<int>      flat_fwd_offsets;
+  KokkosTypes<DefaultDevice>::view_1d<int>      flat_bwd_offsets;
+  int m_flat_zero_size;
+  int m_flat_fwd_size;
+  int m_flat_bwd_size;
+
+  // The fwd remap is done in two phases: first on the elements that have connections
+  // shared with other ranks, then on all the other elements. This way, the BE can send
+  // the former while the latter are remapped. These are the elements and the phys
+  // columns sorted by phase, the beginning of each phase in these lists, and the
+  // phase being remapped.
+  KokkosTypes<DefaultDevice>::view_1d<int>      phase_elems;
+  KokkosTypes<DefaultDevice>::view_1d<int>      phase_cols;
+  int phase_elems_beg[3];
+  int phase_cols_beg[3];
+  mutable int phase;
 
   void initialize_device_variables();
 
@@ -156,28 +192,27 @@ protected:
   void do_remap_fwd () const override;
   void do_remap_bwd () const override;
 
-  // phys->dyn requires a halo-exchange. Since not all entries in dyn
-  // are overwritten before the exchange, to avoid leftover garbage,
-  // we need to set all entries of dyn to zero.
-  template <typename ScalarT, typename MT>
-  KOKKOS_FUNCTION
-  void set_dyn_to_zero(const MT& team) const;
-
   template <typename MT>
   KOKKOS_FUNCTION
-  void local_remap_fwd_2d (const MT& team) const;
+  void local_remap_bwd_2d (const MT& team) const;
 
   template <typename ScalarT, typename MT>
   KOKKOS_FUNCTION
-  void local_remap_fwd_3d (const MT& team) const;
+  void local_remap_bwd_3d (const MT& team) const;
 
-  template <typename MT>
+  // Field owning entry idx of a flat kernel over num elements/columns
+  KOKKOS_INLINE_FUNCTION
+  int flat_field_idx (const KokkosTypes<DefaultDevice>::view_1d<int>& offsets,
+                      const int num, const long idx) const;
+
+  // Flat versions of the remaps: they remap entry j of column icol of field i
+  template <typename ScalarT>
   KOKKOS_FUNCTION
-  void local_remap_bwd_2d (const MT& team) const;
+  void flat_remap_fwd (const int i, const int icol, const int j) const;
 
-  template <typename ScalarT, typename MT>
+  template <typename ScalarT>
   KOKKOS_FUNCTION
-  void local_remap_bwd_3d (const MT& team) const;
+  void flat_remap_bwd (const int i, const int icol, const int j) const;
 
   template<typename ScalarT, int N>
   KOKKOS_FUNCTION
@@ -236,13 +271,17 @@ protected:
   }
 
 public:
-  template<typename MT>
-  KOKKOS_INLINE_FUNCTION
-  void operator()(const RemapFwdTag&, const MT &team) const;
   template<typename MT>
   KOKKOS_INLINE_FUNCTION
   void operator()(const RemapBwdTag&, const MT &team) const;
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ZeroDynFlatTag&, const long idx) const;
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const RemapFwdFlatTag&, const long idx) const;
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const RemapBwdFlatTag&, const long idx) const;
+
 };
 
 // ================= IMPLEMENTATION ================= //
@@ -250,7 +289,8 @@ public:
 template<typename RealType>
 PhysicsDynamicsRemapper<RealType>::
 PhysicsDynamicsRemapper (const grid_ptr_type& phys_grid,
-                         const grid_ptr_type& dyn_grid)
+                         const grid_ptr_type& dyn_grid,
+                         const NoP2DMapTag&)
  : base_type(phys_grid,dyn_grid)
 {
   EKAT_REQUIRE_MSG(dyn_grid->type()==GridType::SE,     "Error! Input dynamics grid is not a SE grid.\n");
@@ -261,7 +301,14 @@ PhysicsDynamicsRemapper (const grid_ptr_type& phys_grid,
 
   m_num_phys_cols = phys_grid->get_num_local_dofs();
   m_lid2elgp      = m_dyn_grid->get_lid_to_idx_map();
+}
 
+template<typename RealType>
+PhysicsDynamicsRemapper<RealType>::
+PhysicsDynamicsRemapper (const grid_ptr_type& phys_grid,
+                         const grid_ptr_type& dyn_grid)
+ : PhysicsDynamicsRemapper(phys_grid,dyn_grid,NoP2DMapTag())
+{
   // For each phys dofs, we find a corresponding dof in the dyn grid.
   // Notice that such dyn dof may not be unique (if phys dof is on an edge
   // of a SE element), but we don't care. We just need to find a match.
@@ -430,7 +477,10 @@ initialize_device_variables()
   has_parent          = decltype(has_parent)          ("has_parent",               this->m_num_fields);
   pack_alloc_property = decltype(pack_alloc_property) ("phys_pack_alloc_property", this->m_num_fields);
   is_state_field_dev  = decltype(is_state_field_dev)  ("is_state_field_dev",       this->m_num_fields);
-  states_tl_idx       = decltype(states_tl_idx)       ("states_time_level");
+
+  flat_zero_offsets = decltype(flat_zero_offsets) ("flat_zero_offsets", this->m_num_fields+1);
+  flat_fwd_offsets  = decltype(flat_fwd_offsets)  ("flat_fwd_offsets",  this->m_num_fields+1);
+  flat_bwd_offsets  = decltype(flat_bwd_offsets)  ("flat_bwd_offsets",  this->m_num_fields+1);
 
   auto h_phys_ptrs   = Kokkos::create_mirror_view(phys_ptrs);
   auto h_phys_layout = Kokkos::create_mirror_view(phys_layout);
@@ -444,6 +494,10 @@ initialize_device_variables()
   auto h_pack_alloc_property = Kokkos::create_mirror_view(pack_alloc_property);
   auto h_is_state_field_dev  = Kokkos::create_mirror_view(is_state_field_dev);
 
+  auto h_flat_zero_offsets = Kokkos::create_mirror_view(flat_zero_offsets);
+  auto h_flat_fwd_offsets  = Kokkos::create_mirror_view(flat_fwd_offsets);
+  auto h_flat_bwd_offsets  = Kokkos::create_mirror_view(flat_bwd_offsets);
+
   for (int i=0; i<this->m_num_fields; ++i) {
     const auto& phys = m_phys[i];
     const auto& dyn  = m_dyn[i];
@@ -515,6 +569,96 @@ initialize_device_variables()
     h_is_state_field_dev(i) = m_is_state_field[i];
   }
 
+  // Compute the offsets of each field in the flat index spaces. Fields with
+  // a parent are not remapped, so they have no entries.
+  h_flat_zero_offsets(0) = h_flat_fwd_offsets(0) = h_flat_bwd_offsets(0) = 0;
+  for (int i=0; i<this->m_num_fields; ++i) {
+    int num_zero = 0;
+    int num_fwd  = 0;
+    int num_bwd  = 0;
+    if (not h_has_parent(i)) {
+      const auto& dim_p = h_phys_dims(i);
+      const auto& dim_d = h_dyn_dims(i);
+
+      // dyn is zeroed as reals, and, for states, only at the remapped time level
+      // (so skip the time level dim too)
+      const int pack_size = h_pack_alloc_property(i)==AllocPropType::PackAlloc ? pack_type::n :
+                           (h_pack_alloc_property(i)==AllocPropType::SmallPackAlloc ? small_pack_type::n : 1);
+      num_zero = pack_size;
+      for (int k=(h_is_state_field_dev(i) ? 2 : 1); k<dim_d.size; ++k) {
+        num_zero *= dim_d.dims[k];
+      }
+
+      // The bwd remap loops over all the phys entries of a column, while the fwd
+      // remap of 3d fields loops over the dyn levels
+      num_bwd = 1;
+      for (int k=1; k<dim_p.size; ++k) {
+        num_bwd *= dim_p.dims[k];
+      }
+      const bool is_phys_field_3d = (h_phys_layout(i) == etoi(LayoutType::Scalar3D) ||
+                                     h_phys_layout(i) == etoi(LayoutType::Vector3D));
+      num_fwd = is_phys_field_3d ? num_bwd / dim_p.dims[dim_p.size-1] * dim_d.dims[dim_d.size-1]
+                                 : num_bwd;
+    }
+    h_flat_zero_offsets(i+1) = h_flat_zero_offsets(i) + num_zero;
+    h_flat_fwd_offsets(i+1)  = h_flat_fwd_offsets(i)  + num_fwd;
+    h_flat_bwd_offsets(i+1)  = h_flat_bwd_offsets(i)  + num_bwd;
+  }
+  m_flat_zero_size = h_flat_zero_offsets(this->m_num_fields);
+  m_flat_fwd_size  = h_flat_fwd_offsets(this->m_num_fields);
+  m_flat_bwd_size  = h_flat_bwd_offsets(this->m_num_fields);
+
+  // Sort elements by phase: first those with a connection shared with another rank.
+  // Each phys column goes in the phase of the element it is mapped to.
+  const auto& conn = Homme::Context::singleton().get<Homme::Connectivity>();
+  const auto h_connections = conn.get_connections<Homme::HostMemSpace>();
+  const int num_elems = conn.get_num_local_elements();
+  std::vector<int> elem_phase(num_elems,1);
+  for (int ie=0; ie<num_elems; ++ie) {
+    for (int iconn=0; iconn<Homme::NUM_CONNECTIONS; ++iconn) {
+      if (h_connections(ie,iconn).sharing==etoi(Homme::ConnectionSharing::SHARED)) {
+        elem_phase[ie] = 0;
+      }
+    }
+  }
+
+  phase_elems = decltype(phase_elems) ("phase_elems", num_elems);
+  auto h_phase_elems = Kokkos::create_mirror_view(phase_elems);
+  int n = 0;
+  for (int ip=0; ip<2; ++ip) {
+    phase_elems_beg[ip] = n;
+    for (int ie=0; ie<num_elems; ++ie) {
+      if (elem_phase[ie]==ip) {
+        h_phase_elems(n++) = ie;
+      }
+    }
+  }
+  phase_elems_beg[2] = n;
+  Kokkos::deep_copy(phase_elems, h_phase_elems);
+
+  // Remappers that do not create the p2d map (e.g., FV) have their own fwd remap
+  phase_cols_beg[0] = phase_cols_beg[1] = phase_cols_beg[2] = 0;
+  if (m_p2d.size()>0) {
+    auto h_p2d = Kokkos::create_mirror_view(m_p2d);
+    auto h_lid2elgp = Kokkos::create_mirror_view(m_lid2elgp);
+    Kokkos::deep_copy(h_p2d, m_p2d);
+    Kokkos::deep_copy(h_lid2elgp, m_lid2elgp);
+
+    phase_cols = decltype(phase_cols) ("phase_cols", m_num_phys_cols);
+    auto h_phase_cols = Kokkos::create_mirror_view(phase_cols);
+    n = 0;
+    for (int ip=0; ip<2; ++ip) {
+      phase_cols_beg[ip] = n;
+      for (int icol=0; icol<m_num_phys_cols; ++icol) {
+        if (elem_phase[h_lid2elgp(h_p2d(icol),0)]==ip) {
+          h_phase_cols(n++) = icol;
+        }
+      }
+    }
+    phase_cols_beg[2] = n;
+    Kokkos::deep_copy(phase_cols, h_phase_cols);
+  }
+
   Kokkos::deep_copy(phys_ptrs,   h_phys_ptrs);
   Kokkos::deep_copy(phys_layout, h_phys_layout);
   Kokkos::deep_copy(phys_dims,   h_phys_dims);
@@ -526,136 +670,10 @@ initialize_device_variables()
   Kokkos::deep_copy(has_parent,          h_has_parent);
   Kokkos::deep_copy(pack_alloc_property, h_pack_alloc_property);
   Kokkos::deep_copy(is_state_field_dev,  h_is_state_field_dev);
-}
-
-template<typename RealType>
-template <typename ScalarT, typename MT>
-KOKKOS_FUNCTION
-void PhysicsDynamicsRemapper<RealType>::
-set_dyn_to_zero(const MT& team) const
-{
-  const int i = team.league_rank();
-
-  const int itl = states_tl_idx();
-  const auto& dim_d = dyn_dims(i).dims;
-
-  switch (phys_layout(i)) {
-    case etoi(LayoutType::Scalar2D):
-      if (is_state_field_dev(i)) {
-        auto dyn = reshape<ScalarT,4> (dyn_ptrs(i), dyn_dims(i));
-        auto v = ekat::subview_1(dyn,itl);
-
-        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, v.size()), [&](const int& k) {
-          int k0   = k%dim_d[0];
-          int ktmp = k/dim_d[0];
-          int k1   = ktmp%dim_d[2];
-          int k2   = ktmp/dim_d[2];
-          v(k0, k1, k2) = 0;
-        });
-      } else {
-        auto dyn = reshape<ScalarT,3> (dyn_ptrs(i), dyn_dims(i));
-
-        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, dyn.size()), [&](const int& k) {
-          int k0   = k%dim_d[0];
-          int ktmp = k/dim_d[0];
-          int k1   = ktmp%dim_d[1];
-          int k2   = ktmp/dim_d[1];
-          dyn(k0, k1, k2) = 0;
-        });
-      }
-      break;
-    case etoi(LayoutType::Vector2D):
-      if (is_state_field_dev(i)) {
-        auto dyn = reshape<ScalarT,5> (dyn_ptrs(i), dyn_dims(i));
-        auto v = ekat::subview_1(dyn,itl);
-
-        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, v.size()), [&](const int& k) {
-          int k0   = k%dim_d[0];
-          int ktmp = k/dim_d[0];
-          int k1   = ktmp%dim_d[2];
-          ktmp     = ktmp/dim_d[2];
-          int k2   = ktmp%dim_d[3];
-          int k3   = ktmp/dim_d[3];
-          v(k0, k1, k2, k3) = 0;
-        });
-      } else {
-        auto dyn = reshape<ScalarT,4> (dyn_ptrs(i), dyn_dims(i));
-
-        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, dyn.size()), [&](const int& k) {
-          int k0   = k%dim_d[0];
-          int ktmp = k/dim_d[0];
-          int k1   = ktmp%dim_d[1];
-          ktmp     = ktmp/dim_d[1];
-          int k2   = ktmp%dim_d[2];
-          int k3   = ktmp/dim_d[2];
-          dyn(k0, k1, k2, k3) = 0;
-        });
-      }
-      break;
-    case etoi(LayoutType::Scalar3D):
-      if (is_state_field_dev(i)) {
-        auto dyn = reshape<ScalarT,5> (dyn_ptrs(i), dyn_dims(i));
-        auto v = ekat::subview_1(dyn,itl);
-
-        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, v.size()), [&](const int& k) {
-          int k0   = k%dim_d[0];
-          int ktmp = k/dim_d[0];
-          int k1   = ktmp%dim_d[2];
-          ktmp     = ktmp/dim_d[2];
-          int k2   = ktmp%dim_d[3];
-          int k3   = ktmp/dim_d[3];
-          v(k0, k1, k2, k3) = 0;
-        });
-
-      } else {
-        auto dyn = reshape<ScalarT,4> (dyn_ptrs(i), dyn_dims(i));
-
-        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, dyn.size()), [&](const int& k) {
-          int k0   = k%dim_d[0];
-          int ktmp = k/dim_d[0];
-          int k1   = ktmp%dim_d[1];
-          ktmp     = ktmp/dim_d[1];
-          int k2   = ktmp%dim_d[2];
-          int k3   = ktmp/dim_d[2];
-          dyn(k0, k1, k2, k3) = 0;
-        });
-      }
-      break;
-    case etoi(LayoutType::Vector3D):
-      if (is_state_field_dev(i)) {
-        auto dyn = reshape<ScalarT,6> (dyn_ptrs(i), dyn_dims(i));
-        auto v = ekat::subview_1(dyn,itl);
-
-        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, v.size()), [&](const int& k) {
-          int k0   = k%dim_d[0];
-          int ktmp = k/dim_d[0];
-          int k1   = ktmp%dim_d[2];
-          ktmp     = ktmp/dim_d[2];
-          int k2   = ktmp%dim_d[3];
-          ktmp     = ktmp/dim_d[3];
-          int k3   = ktmp%dim_d[4];
-          int k4   = ktmp/dim_d[4];
-          v(k0, k1, k2, k3, k4) = 0;
-        });
-      } else {
-        auto dyn = reshape<ScalarT,5> (dyn_ptrs(i), dyn_dims(i));
 
-        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, dyn.size()), [&](const int& k) {
-          int k0   = k%dim_d[0];
-          int ktmp = k/dim_d[0];
-          int k1   = ktmp%dim_d[1];
-          ktmp     = ktmp/dim_d[1];
-          int k2   = ktmp%dim_d[2];
-          ktmp     = ktmp/dim_d[2];
-          int k3   = ktmp%dim_d[3];
-          int k4   = ktmp/dim_d[3];
-          dyn(k0, k1, k2, k3, k4) = 0;
-        });
-      }
-      break;
-    default:
-      EKAT_KERNEL_ERROR_MSG("Error! Unhandled case in switch statement.\n");
-  }
+  Kokkos::deep_copy(flat_zero_offsets, h_flat_zero_offsets);
+  Kokkos::deep_copy(flat_fwd_offsets,  h_flat_fwd_offsets);
+  Kokkos::deep_copy(flat_bwd_offsets,  h_flat_bwd_offsets);
 }
 
 template<typename RealType>
@@ -664,29 +682,34 @@ do_remap_fwd() const
 {
   // Update time slice idx for states
   const auto& tl = Homme::Context::singleton().get<Homme::TimeLevel>();
-  Kokkos::deep_copy(states_tl_idx, tl.n0);
+  states_tl_idx = tl.n0;
 
   using KT = KokkosTypes<DefaultDevice>;
-  using TeamPolicy = typename KT::TeamTagPolicy<RemapFwdTag>;
-
-  const auto concurrency = KT::ExeSpace::concurrency();
-#ifdef KOKKOS_ENABLE_CUDA
-#ifdef KOKKOS_ENABLE_DEBUG
-  const int team_size = std::min(256, std::min(128*m_num_phys_cols,32*(concurrency/this->m_num_fields+31)/32));
-#else
-  const int team_size = std::min(1024, std::min(128*m_num_phys_cols,32*(concurrency/this->m_num_fields+31)/32));
-#endif
-#else
-  const int team_size = (concurrency<this->m_num_fields ? 1 : concurrency/this->m_num_fields);
-#endif
 
-  // TeamPolicy over this->m_num_fields
-  const TeamPolicy policy(this->m_num_fields,team_size);
-  Kokkos::parallel_for(policy, *this);
-  Kokkos::fence();
+  using ZeroPolicy  = Kokkos::RangePolicy<KT::ExeSpace,ZeroDynFlatTag,Kokkos::IndexType<long>>;
+  using RemapPolicy = Kokkos::RangePolicy<KT::ExeSpace,RemapFwdFlatTag,Kokkos::IndexType<long>>;
 
   // Exchange only the current time levels
-  m_be[tl.n0]->exchange();
+  auto& be = *m_be[tl.n0];
+
+  // Remap with flat policies over all (field,column,level) entries. phys->dyn
+  // requires a halo-exchange, and not all entries in dyn are overwritten before
+  // the exchange, so, to avoid leftover garbage, we need to zero out dyn first.
+  // We do so on the elements with shared connections first, so that the BE can
+  // send their halo while the other elements are remapped. No need to fence
+  // before the BE calls: it packs on the same execution space, and fences
+  // before sending.
+  for (int ip=0; ip<2; ++ip) {
+    phase = ip;
+    const int num_elems = phase_elems_beg[ip+1] - phase_elems_beg[ip];
+    const int num_cols  = phase_cols_beg[ip+1] - phase_cols_beg[ip];
+    Kokkos::parallel_for(ZeroPolicy(0,static_cast<long>(num_elems)*m_flat_zero_size), *this);
+    Kokkos::parallel_for(RemapPolicy(0,static_cast<long>(num_cols)*m_flat_fwd_size), *this);
+    if (ip==0) {
+      be.exchange_begin();
+    }
+  }
+  be.exchange_end();
 }
 
 template<typename RealType>
@@ -695,25 +718,28 @@ do_remap_bwd() const
 {
   // Update time slice idx for states
   const auto& tl = Homme::Context::singleton().get<Homme::TimeLevel>();
-  Kokkos::deep_copy(states_tl_idx, tl.n0);
+  states_tl_idx = tl.n0;
 
   using KT = KokkosTypes<DefaultDevice>;
-  using TeamPolicy = typename KT::TeamTagPolicy<RemapBwdTag>;
 
-  const auto concurrency = KT::ExeSpace::concurrency();
 #ifdef KOKKOS_ENABLE_CUDA
+  using TeamPolicy = typename KT::TeamTagPolicy<RemapBwdTag>;
+
   const int num_levs  = m_phys_grid->get_num_vertical_levels();
   const int team_size = std::min(128,32*(int)ceil(((Real)num_levs)/32));
-#else
-  const int team_size = (concurrency<this->m_num_fields*m_num_phys_cols ? 1 : concurrency/(this->m_num_fields*m_num_phys_cols));
-#endif
 
-  // TeamPolicy over m_num_phys_cols*this->m_num_fields. Unlike do_remap_fwd,
-  // here we do not require setting dyn=0, allowing us to extend
-  // the TeamPolicy
+  // TeamPolicy over m_num_phys_cols*this->m_num_fields
   const TeamPolicy policy(this->m_num_fields*m_num_phys_cols,team_size);
   Kokkos::parallel_for(policy, *this);
-  Kokkos::fence();
+#else
+  // On CPU there are usually more fields than threads, so use a flat
+  // policy over all (field,column,level) entries, as in do_remap_fwd
+  using RemapPolicy = Kokkos::RangePolicy<KT::ExeSpace,RemapBwdFlatTag,Kokkos::IndexType<long>>;
+  Kokkos::parallel_for(RemapPolicy(0,static_cast<long>(m_num_phys_cols)*m_flat_bwd_size), *this);
+#endif
+
+  // No fence: physics kernels using the remapped fields run on the same
+  // execution space, and host accesses go through a (fencing) deep copy.
 }
 
 template<typename RealType>
@@ -906,62 +932,49 @@ template<typename RealType>
 template <typename MT>
 KOKKOS_FUNCTION
 void PhysicsDynamicsRemapper<RealType>::
-local_remap_fwd_2d (const MT& team) const
+local_remap_bwd_2d (const MT& team) const
 {
-  const int i = team.league_rank();
+  const int rank = team.league_rank();
+  const int i    = rank % this->m_num_fields;
+  const int icol = rank / this->m_num_fields;
+
+  const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
 
   const auto& dim_p = phys_dims(i).dims;
 
-  switch (phys_layout(i)) {
-    case etoi(LayoutType::Scalar2D):
+  switch (phys_dims(i).size) {
+    case 1:
     {
       auto phys = reshape<RealType,1> (phys_ptrs(i), phys_dims(i));
 
-      const auto tr = Kokkos::TeamThreadRange(team, m_num_phys_cols);
       if (is_state_field_dev(i)) {
         auto dyn = reshape<RealType,4> (dyn_ptrs(i), dyn_dims(i));
 
-        const auto f = [&] (const int icol) {
-          const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-          dyn(elgp[0],states_tl_idx(),elgp[1],elgp[2]) = phys(icol);
-        };
-        Kokkos::parallel_for(tr, f);
+        phys(icol) = dyn(elgp[0],states_tl_idx,elgp[1],elgp[2]);
       } else {
         auto dyn = reshape<RealType,3> (dyn_ptrs(i), dyn_dims(i));
 
-        const auto f = [&] (const int icol) {
-          const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-          dyn(elgp[0],elgp[1],elgp[2]) = phys(icol);
-        };
-        Kokkos::parallel_for(tr, f);
+        phys(icol) = dyn(elgp[0],elgp[1],elgp[2]);
       }
       break;
     }
-    case etoi(LayoutType::Vector2D):
+    case 2:
     {
       auto phys = reshape<RealType,2> (phys_ptrs(i), phys_dims(i));
 
-      const auto tr = Kokkos::TeamThreadRange(team, m_num_phys_cols*dim_p[1]);
+      const auto tr = Kokkos::TeamThreadRange(team, dim_p[1]);
       if (is_state_field_dev(i)) {
         auto dyn = reshape<RealType,5> (dyn_ptrs(i), dyn_dims(i));
 
-        const auto f = [&] (const int idx) {
-          const int icol = idx/dim_p[1];
-          const int idim = idx%dim_p[1];
-
-          const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-          dyn(elgp[0],states_tl_idx(),idim,elgp[1],elgp[2]) = phys(icol,idim);
+        const auto f = [&] (const int idim) {
+          phys(icol,idim) = dyn(elgp[0],states_tl_idx,idim,elgp[1],elgp[2]);
         };
         Kokkos::parallel_for(tr, f);
       } else {
         auto dyn = reshape<RealType,4> (dyn_ptrs(i), dyn_dims(i));
 
-        const auto f = [&] (const int idx) {
-          const int icol = idx/dim_p[1];
-          const int idim = idx%dim_p[1];
-
-          const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-          dyn(elgp[0],idim,elgp[1],elgp[2]) = phys(icol,idim);
+        const auto f = [&] (const int idim) {
+          phys(icol,idim) = dyn(elgp[0],idim,elgp[1],elgp[2]);
         };
         Kokkos::parallel_for(tr, f);
       }
@@ -976,73 +989,61 @@ template<typename RealType>
 template <typename ScalarT, typename MT>
 KOKKOS_FUNCTION
 void PhysicsDynamicsRemapper<RealType>::
-local_remap_fwd_3d (const MT& team) const
+local_remap_bwd_3d (const MT& team) const
 {
-  const int i = team.league_rank();
+  const int rank = team.league_rank();
+  const int i    = rank % this->m_num_fields;
+  const int icol = rank / this->m_num_fields;
+
+  const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
 
   const auto& dim_p = phys_dims(i).dims;
-  const auto& dim_d = dyn_dims(i).dims;
 
-  switch (phys_layout(i)) {
-    case etoi(LayoutType::Scalar3D):
+  switch (phys_dims(i).size) {
+    case 2:
     {
       auto phys = reshape<ScalarT,2> (phys_ptrs(i), phys_dims(i));
 
+      const auto tr = Kokkos::TeamThreadRange(team, dim_p[1]);
       if (is_state_field_dev(i)) {
         auto dyn = reshape<ScalarT,5> (dyn_ptrs(i), dyn_dims(i));
 
-        const auto tr = Kokkos::TeamThreadRange(team, m_num_phys_cols*dim_d[4]);
-        const auto f = [&] (const int idx) {
-          const int icol = idx/dim_d[4];
-          const int ilev = idx%dim_d[4];
-
-          const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-          dyn(elgp[0],states_tl_idx(),elgp[1],elgp[2],ilev) = phys(icol,ilev);
+        const auto f = [&] (const int ilev) {
+          phys(icol,ilev) = dyn(elgp[0],states_tl_idx,elgp[1],elgp[2],ilev);
         };
         Kokkos::parallel_for(tr, f);
       } else {
         auto dyn = reshape<ScalarT,4> (dyn_ptrs(i), dyn_dims(i));
 
-        const auto tr = Kokkos::TeamThreadRange(team, m_num_phys_cols*dim_d[3]);
-        const auto f = [&] (const int idx) {
-          const int icol = idx/dim_d[3];
-          const int ilev = idx%dim_d[3];
-
-          const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-          dyn(elgp[0],elgp[1],elgp[2],ilev) = phys(icol,ilev);
+        const auto f = [&] (const int ilev) {
+          phys(icol,ilev) = dyn(elgp[0],elgp[1],elgp[2],ilev);
         };
         Kokkos::parallel_for(tr, f);
       }
       break;
     }
-    case etoi(LayoutType::Vector3D):
+    case 3:
     {
       auto phys = reshape<ScalarT,3> (phys_ptrs(i), phys_dims(i));
 
       if (is_state_field_dev(i)) {
         auto dyn = reshape<ScalarT,6> (dyn_ptrs(i), dyn_dims(i));
 
-        const auto tr = Kokkos::TeamThreadRange(team, m_num_phys_cols*dim_p[1]*dim_d[5]);
+        const auto tr = Kokkos::TeamThreadRange(team, dim_p[1]*dim_p[2]);
         const auto f = [&] (const int idx) {
-          const int icol =  idx/(dim_p[1]*dim_d[5]);
-          const int idim = (idx/dim_d[5])%dim_p[1];
-          const int ilev =  idx%dim_d[5];
-
-          const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-          dyn(elgp[0],states_tl_idx(),idim,elgp[1],elgp[2],ilev) = phys(icol,idim,ilev);
+          const int idim = idx%dim_p[1];
+          const int ilev = idx/dim_p[1];
+          phys(icol,idim,ilev) = dyn(elgp[0],states_tl_idx,idim,elgp[1],elgp[2],ilev);
         };
         Kokkos::parallel_for(tr, f);
       } else {
         auto dyn = reshape<ScalarT,5> (dyn_ptrs(i), dyn_dims(i));
 
-        const auto tr = Kokkos::TeamThreadRange(team, m_num_phys_cols*dim_p[1]*dim_d[4]);
+        const auto tr = Kokkos::TeamThreadRange(team, dim_p[1]*dim_p[2]);
         const auto f = [&] (const int idx) {
-          const int icol =  idx/(dim_p[1]*dim_d[4]);
-          const int idim = (idx/dim_d[4])%dim_p[1];
-          const int ilev =  idx%dim_d[4];
-
-          const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-          dyn(elgp[0],idim,elgp[1],elgp[2],ilev) = phys(icol,idim,ilev);
+          const int idim = idx%dim_p[1];
+          const int ilev = idx/dim_p[1];
+          phys(icol,idim,ilev) = dyn(elgp[0],idim,elgp[1],elgp[2],ilev);
         };
         Kokkos::parallel_for(tr, f);
       }
@@ -1054,54 +1055,88 @@ local_remap_fwd_3d (const MT& team) const
 }
 
 template<typename RealType>
-template <typename MT>
+KOKKOS_INLINE_FUNCTION
+int PhysicsDynamicsRemapper<RealType>::
+flat_field_idx (const KokkosTypes<DefaultDevice>::view_1d<int>& offsets,
+                const int num, const long idx) const
+{
+  // Bisection for the last field whose first entry is <= idx. Fields with no
+  // entries have the same offset as the next one, so they are never returned.
+  int lo = 0;
+  int hi = this->m_num_fields;
+  while (hi-lo>1) {
+    const int mid = (lo+hi)/2;
+    if (static_cast<long>(num)*offsets(mid)<=idx) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+template<typename RealType>
+template <typename ScalarT>
 KOKKOS_FUNCTION
 void PhysicsDynamicsRemapper<RealType>::
-local_remap_bwd_2d (const MT& team) const
+flat_remap_fwd (const int i, const int icol, const int j) const
 {
-  const int rank = team.league_rank();
-  const int i    = rank % this->m_num_fields;
-  const int icol = rank / this->m_num_fields;
-
+  const auto& dim_d = dyn_dims(i).dims;
+  const int itl = states_tl_idx;
   const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
 
-  const auto& dim_p = phys_dims(i).dims;
-
-  switch (phys_dims(i).size) {
-    case 1:
+  switch (phys_layout(i)) {
+    case etoi(LayoutType::Scalar2D):
     {
-      auto phys = reshape<RealType,1> (phys_ptrs(i), phys_dims(i));
-
+      auto phys = reshape<ScalarT,1> (phys_ptrs(i), phys_dims(i));
       if (is_state_field_dev(i)) {
-        auto dyn = reshape<RealType,4> (dyn_ptrs(i), dyn_dims(i));
-
-        phys(icol) = dyn(elgp[0],states_tl_idx(),elgp[1],elgp[2]);
+        auto dyn = reshape<ScalarT,4> (dyn_ptrs(i), dyn_dims(i));
+        dyn(elgp[0],itl,elgp[1],elgp[2]) = phys(icol);
       } else {
-        auto dyn = reshape<RealType,3> (dyn_ptrs(i), dyn_dims(i));
-
-        phys(icol) = dyn(elgp[0],elgp[1],elgp[2]);
+        auto dyn = reshape<ScalarT,3> (dyn_ptrs(i), dyn_dims(i));
+        dyn(elgp[0],elgp[1],elgp[2]) = phys(icol);
       }
       break;
     }
-    case 2:
+    case etoi(LayoutType::Vector2D):
     {
-      auto phys = reshape<RealType,2> (phys_ptrs(i), phys_dims(i));
-
-      const auto tr = Kokkos::TeamThreadRange(team, dim_p[1]);
+      const int idim = j;
+      auto phys = reshape<ScalarT,2> (phys_ptrs(i), phys_dims(i));
       if (is_state_field_dev(i)) {
-        auto dyn = reshape<RealType,5> (dyn_ptrs(i), dyn_dims(i));
-
-        const auto f = [&] (const int idim) {
-          phys(icol,idim) = dyn(elgp[0],states_tl_idx(),idim,elgp[1],elgp[2]);
-        };
-        Kokkos::parallel_for(tr, f);
+        auto dyn = reshape<ScalarT,5> (dyn_ptrs(i), dyn_dims(i));
+        dyn(elgp[0],itl,idim,elgp[1],elgp[2]) = phys(icol,idim);
       } else {
-        auto dyn = reshape<RealType,4> (dyn_ptrs(i), dyn_dims(i));
-
-        const auto f = [&] (const int idim) {
-          phys(icol,idim) = dyn(elgp[0],idim,elgp[1],elgp[2]);
-        };
-        Kokkos::parallel_for(tr, f);
+        auto dyn = reshape<ScalarT,4> (dyn_ptrs(i), dyn_dims(i));
+        dyn(elgp[0],idim,elgp[1],elgp[2]) = phys(icol,idim);
+      }
+      break;
+    }
+    case etoi(LayoutType::Scalar3D):
+    {
+      const int ilev = j;
+      auto phys = reshape<ScalarT,2> (phys_ptrs(i), phys_dims(i));
+      if (is_state_field_dev(i)) {
+        auto dyn = reshape<ScalarT,5> (dyn_ptrs(i), dyn_dims(i));
+        dyn(elgp[0],itl,elgp[1],elgp[2],ilev) = phys(icol,ilev);
+      } else {
+        auto dyn = reshape<ScalarT,4> (dyn_ptrs(i), dyn_dims(i));
+        dyn(elgp[0],elgp[1],elgp[2],ilev) = phys(icol,ilev);
+      }
+      break;
+    }
+    case etoi(LayoutType::Vector3D):
+    {
+      // The fwd remap loops over the dyn levels
+      const int nlev = dim_d[dyn_dims(i).size-1];
+      const int idim = j/nlev;
+      const int ilev = j%nlev;
+      auto phys = reshape<ScalarT,3> (phys_ptrs(i), phys_dims(i));
+      if (is_state_field_dev(i)) {
+        auto dyn = reshape<ScalarT,6> (dyn_ptrs(i), dyn_dims(i));
+        dyn(elgp[0],itl,idim,elgp[1],elgp[2],ilev) = phys(icol,idim,ilev);
+      } else {
+        auto dyn = reshape<ScalarT,5> (dyn_ptrs(i), dyn_dims(i));
+        dyn(elgp[0],idim,elgp[1],elgp[2],ilev) = phys(icol,idim,ilev);
       }
       break;
     }
@@ -1111,66 +1146,65 @@ local_remap_bwd_2d (const MT& team) const
 }
 
 template<typename RealType>
-template <typename ScalarT, typename MT>
+template <typename ScalarT>
 KOKKOS_FUNCTION
 void PhysicsDynamicsRemapper<RealType>::
-local_remap_bwd_3d (const MT& team) const
+flat_remap_bwd (const int i, const int icol, const int j) const
 {
-  const int rank = team.league_rank();
-  const int i    = rank % this->m_num_fields;
-  const int icol = rank / this->m_num_fields;
-
-  const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-
   const auto& dim_p = phys_dims(i).dims;
+  const int itl = states_tl_idx;
+  const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
 
-  switch (phys_dims(i).size) {
-    case 2:
+  switch (phys_layout(i)) {
+    case etoi(LayoutType::Scalar2D):
     {
+      auto phys = reshape<ScalarT,1> (phys_ptrs(i), phys_dims(i));
+      if (is_state_field_dev(i)) {
+        auto dyn = reshape<ScalarT,4> (dyn_ptrs(i), dyn_dims(i));
+        phys(icol) = dyn(elgp[0],itl,elgp[1],elgp[2]);
+      } else {
+        auto dyn = reshape<ScalarT,3> (dyn_ptrs(i), dyn_dims(i));
+        phys(icol) = dyn(elgp[0],elgp[1],elgp[2]);
+      }
+      break;
+    }
+    case etoi(LayoutType::Vector2D):
+    {
+      const int idim = j;
       auto phys = reshape<ScalarT,2> (phys_ptrs(i), phys_dims(i));
-
-      const auto tr = Kokkos::TeamThreadRange(team, dim_p[1]);
       if (is_state_field_dev(i)) {
         auto dyn = reshape<ScalarT,5> (dyn_ptrs(i), dyn_dims(i));
-
-        const auto f = [&] (const int ilev) {
-          phys(icol,ilev) = dyn(elgp[0],states_tl_idx(),elgp[1],elgp[2],ilev);
-        };
-        Kokkos::parallel_for(tr, f);
+        phys(icol,idim) = dyn(elgp[0],itl,idim,elgp[1],elgp[2]);
       } else {
         auto dyn = reshape<ScalarT,4> (dyn_ptrs(i), dyn_dims(i));
-
-        const auto f = [&] (const int ilev) {
-          phys(icol,ilev) = dyn(elgp[0],elgp[1],elgp[2],ilev);
-        };
-        Kokkos::parallel_for(tr, f);
+        phys(icol,idim) = dyn(elgp[0],idim,elgp[1],elgp[2]);
       }
       break;
     }
-    case 3:
+    case etoi(LayoutType::Scalar3D):
     {
+      const int ilev = j;
+      auto phys = reshape<ScalarT,2> (phys_ptrs(i), phys_dims(i));
+      if (is_state_field_dev(i)) {
+        auto dyn = reshape<ScalarT,5> (dyn_ptrs(i), dyn_dims(i));
+        phys(icol,ilev) = dyn(elgp[0],itl,elgp[1],elgp[2],ilev);
+      } else {
+        auto dyn = reshape<ScalarT,4> (dyn_ptrs(i), dyn_dims(i));
+        phys(icol,ilev) = dyn(elgp[0],elgp[1],elgp[2],ilev);
+      }
+      break;
+    }
+    case etoi(LayoutType::Vector3D):
+    {
+      const int idim = j/dim_p[2];
+      const int ilev = j%dim_p[2];
       auto phys = reshape<ScalarT,3> (phys_ptrs(i), phys_dims(i));
-
       if (is_state_field_dev(i)) {
         auto dyn = reshape<ScalarT,6> (dyn_ptrs(i), dyn_dims(i));
-
-        const auto tr = Kokkos::TeamThreadRange(team, dim_p[1]*dim_p[2]);
-        const auto f = [&] (const int idx) {
-          const int idim = idx%dim_p[1];
-          const int ilev = idx/dim_p[1];
-          phys(icol,idim,ilev) = dyn(elgp[0],states_tl_idx(),idim,elgp[1],elgp[2],ilev);
-        };
-        Kokkos::parallel_for(tr, f);
+        phys(icol,idim,ilev) = dyn(elgp[0],itl,idim,elgp[1],elgp[2],ilev);
       } else {
         auto dyn = reshape<ScalarT,5> (dyn_ptrs(i), dyn_dims(i));
-
-        const auto tr = Kokkos::TeamThreadRange(team, dim_p[1]*dim_p[2]);
-        const auto f = [&] (const int idx) {
-          const int idim = idx%dim_p[1];
-          const int ilev = idx/dim_p[1];
-          phys(icol,idim,ilev) = dyn(elgp[0],idim,elgp[1],elgp[2],ilev);
-        };
-        Kokkos::parallel_for(tr, f);
+        phys(icol,idim,ilev) = dyn(elgp[0],idim,elgp[1],elgp[2],ilev);
       }
       break;
     }
@@ -1211,37 +1245,26 @@ template<typename RealType>
 template<typename MT>
 KOKKOS_INLINE_FUNCTION
 void PhysicsDynamicsRemapper<RealType>::
-operator()(const RemapFwdTag&, const MT& team) const
+operator()(const RemapBwdTag&, const MT& team) const
 {
-  const int i = team.league_rank();
+  const int rank = team.league_rank();
+  const int i = rank % this->m_num_fields;
 
   if (has_parent(i)) return;
 
   switch (phys_layout(i)) {
     case etoi(LayoutType::Scalar2D):
     case etoi(LayoutType::Vector2D):
-      set_dyn_to_zero<Real>(team);
-      team.team_barrier();
-
-      local_remap_fwd_2d(team);
+      local_remap_bwd_2d(team);
       break;
     case etoi(LayoutType::Scalar3D):
     case etoi(LayoutType::Vector3D):
       if (pack_alloc_property(i) == AllocPropType::PackAlloc) {
-        set_dyn_to_zero<pack_type>(team);
-        team.team_barrier();
-
-        local_remap_fwd_3d<pack_type>(team);
+        local_remap_bwd_3d<pack_type>(team);
       } else if (pack_alloc_property(i) == AllocPropType::SmallPackAlloc) {
-        set_dyn_to_zero<small_pack_type>(team);
-        team.team_barrier();
-
-        local_remap_fwd_3d<small_pack_type>(team);
+        local_remap_bwd_3d<small_pack_type>(team);
       } else {
-        set_dyn_to_zero<Real>(team);
-        team.team_barrier();
-
-        local_remap_fwd_3d<Real>(team);
+        local_remap_bwd_3d<Real>(team);
       }
       break;
     default:
@@ -1250,33 +1273,61 @@ operator()(const RemapFwdTag&, const MT& team) const
 }
 
 template<typename RealType>
-template<typename MT>
 KOKKOS_INLINE_FUNCTION
 void PhysicsDynamicsRemapper<RealType>::
-operator()(const RemapBwdTag&, const MT& team) const
+operator()(const ZeroDynFlatTag&, const long idx) const
 {
-  const int rank = team.league_rank();
-  const int i = rank % this->m_num_fields;
+  const int num_elems = phase_elems_beg[phase+1] - phase_elems_beg[phase];
+  const int i = flat_field_idx(flat_zero_offsets,num_elems,idx);
+  const int n = flat_zero_offsets(i+1) - flat_zero_offsets(i);
+  const long k = idx - static_cast<long>(num_elems)*flat_zero_offsets(i);
+  const int ie = phase_elems(phase_elems_beg[phase] + k/n);
+
+  // Zero out dyn as an array of reals, n per element. For states, only
+  // zero out the remapped time level.
+  Real* dyn = dyn_ptrs(i).ptr;
+  if (is_state_field_dev(i)) {
+    dyn[(static_cast<long>(ie)*dyn_dims(i).dims[1] + states_tl_idx)*n + k%n] = 0;
+  } else {
+    dyn[static_cast<long>(ie)*n + k%n] = 0;
+  }
+}
 
-  if (has_parent(i)) return;
+template<typename RealType>
+KOKKOS_INLINE_FUNCTION
+void PhysicsDynamicsRemapper<RealType>::
+operator()(const RemapFwdFlatTag&, const long idx) const
+{
+  const int num_cols = phase_cols_beg[phase+1] - phase_cols_beg[phase];
+  const int i = flat_field_idx(flat_fwd_offsets,num_cols,idx);
+  const int n = flat_fwd_offsets(i+1) - flat_fwd_offsets(i);
+  const long k = idx - static_cast<long>(num_cols)*flat_fwd_offsets(i);
+  const int icol = phase_cols(phase_cols_beg[phase] + k/n);
+
+  if (pack_alloc_property(i) == AllocPropType::PackAlloc) {
+    flat_remap_fwd<pack_type>(i,icol,k%n);
+  } else if (pack_alloc_property(i) == AllocPropType::SmallPackAlloc) {
+    flat_remap_fwd<small_pack_type>(i,icol,k%n);
+  } else {
+    flat_remap_fwd<Real>(i,icol,k%n);
+  }
+}
 
-  switch (phys_layout(i)) {
-    case etoi(LayoutType::Scalar2D):
-    case etoi(LayoutType::Vector2D):
-      local_remap_bwd_2d(team);
-      break;
-    case etoi(LayoutType::Scalar3D):
-    case etoi(LayoutType::Vector3D):
-      if (pack_alloc_property(i) == AllocPropType::PackAlloc) {
-        local_remap_bwd_3d<pack_type>(team);
-      } else if (pack_alloc_property(i) == AllocPropType::SmallPackAlloc) {
-        local_remap_bwd_3d<small_pack_type>(team);
-      } else {
-        local_remap_bwd_3d<Real>(team);
-      }
-      break;
-    default:
-      EKAT_KERNEL_ERROR_MSG("Error! Unhandled case in switch statement.\n");
+template<typename RealType>
+KOKKOS_INLINE_FUNCTION
+void PhysicsDynamicsRemapper<RealType>::
+operator()(const RemapBwdFlatTag&, const long idx) const
+{
+  const int i = flat_field_idx(flat_bwd_offsets,m_num_phys_cols,idx);
+  const int n = flat_bwd_offsets(i+1) - flat_bwd_offsets(i);
+  const long k = idx - static_cast<long>(m_num_phys_cols)*flat_bwd_offsets(i);
+
+  if (pack_alloc_property(i) == AllocPropType::PackAlloc) {
+    flat_remap_bwd<pack_type>(i,k/n,k%n);
+  } else if (pack_alloc_property(i) == AllocPropType::SmallPackAlloc) {
+    flat_remap_bwd<small_pack_type>(i,k/n,k%n);
+  } else {
+    flat_remap_bwd<Real>(i,k/n,k%n);
   }
 }
 
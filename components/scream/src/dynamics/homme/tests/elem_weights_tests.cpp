@@ -0,0 +1,75 @@
+#include <catch2/catch.hpp>
+
+#include "dynamics/homme/dynamics_driven_grids_manager.hpp"
+#include "dynamics/homme/interface/scream_homme_interface.hpp"
+
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <set>
+#include <string>
+#include <vector>
+
+extern "C" {
+// These are specific C/F calls for these tests (i.e., not part of scream_homme_interface.hpp)
+void init_test_params_f90 ();
+void cleanup_test_f90 ();
+void read_local_elem_weights_f90 (const char*& fname, double* wgt);
+}
+
+namespace {
+
+TEST_CASE("elem_weights")
+{
+  using namespace scream;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Init homme context
+  if (!is_parallel_inited_f90()) {
+    auto comm_f = MPI_Comm_c2f(MPI_COMM_WORLD);
+    init_parallel_f90(comm_f);
+  }
+  init_test_params_f90 ();
+
+  // Set parameters
+  constexpr int ne = 2;
+  set_homme_param("ne",ne);
+
+  // Create the grids
+  ekat::ParameterList params;
+  params.set<std::string>("Reference Grid","Physics GLL");
+  auto gm = std::make_shared<DynamicsDrivenGridsManager>(comm,params);
+  std::set<std::string> grids_names = {"Physics GLL","Dynamics"};
+  gm->build_grids(grids_names);
+
+  const int nelems = get_num_local_elems_f90();
+  const int nelems_global = 6*ne*ne;
+
+  // Give each rank a different cost, and write it as element weights
+  const double rank_cost = comm.rank()+1;
+  const std::string fname_str = "elem_weights_np" + std::to_string(comm.size()) + ".txt";
+  const char* fname = fname_str.c_str();
+  write_elem_weights_f90 (rank_cost, fname);
+
+  // Read them back as Homme does before a zoltan2 partition. Each element of a rank
+  // gets the cost of the rank spread over its elements, and the weights are normalized
+  // to have mean 1 over all elements.
+  std::vector<double> wgt(nelems);
+  read_local_elem_weights_f90 (fname, wgt.data());
+
+  // Note: a rank without elements has nowhere to put its cost
+  const double spread_cost = nelems>0 ? rank_cost : 0;
+  double total_cost;
+  comm.all_reduce(&spread_cost,&total_cost,1,MPI_SUM);
+  const double mean = total_cost / nelems_global;
+  for (int ie=0; ie<nelems; ++ie) {
+    REQUIRE (wgt[ie]==Approx(rank_cost/nelems/mean).epsilon(1e-12));
+  }
+
+  // Cleanup
+  gm = nullptr;
+  cleanup_test_f90();
+}
+
+} // anonymous namespace
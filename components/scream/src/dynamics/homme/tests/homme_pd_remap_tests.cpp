@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include "dynamics/homme/physics_dynamics_remapper.hpp"
+#include "dynamics/homme/physics_dynamics_fv_remapper.hpp"
 #include "dynamics/homme/interface/scream_homme_interface.hpp"
 #include "share/field/field.hpp"
 #include "share/grid/se_grid.hpp"
@@ -8,6 +9,7 @@
 #include "share/util/scream_setup_random_test.hpp"
 
 #include "mpi/BoundaryExchange.hpp"
+#include "HybridVCoord.hpp"
 
 #include "dynamics/homme/homme_dimensions.hpp"
 #include "dynamics/homme/dynamics_driven_grids_manager.hpp"
@@ -23,6 +25,7 @@ extern "C" {
 // These are specific C/F calls for these tests (i.e., not part of scream_homme_interface.hpp)
 void init_test_params_f90 ();
 void cleanup_test_f90 ();
+void init_test_geometry_f90 ();
 }
 
 namespace {
@@ -560,6 +563,187 @@ TEST_CASE("remap", "") {
         }
       }
     }
+
+    // Time a few fwd and bwd remaps, to keep an eye on the remapper performance
+    constexpr int nreps = 10;
+    double t_fwd = 0;
+    double t_bwd = 0;
+    Kokkos::Timer timer;
+    for (int irep=0; irep<nreps; ++irep) {
+      timer.reset();
+      remapper->remap(true);
+      Kokkos::fence();
+      t_fwd += timer.seconds();
+
+      timer.reset();
+      remapper->remap(false);
+      Kokkos::fence();
+      t_bwd += timer.seconds();
+    }
+    if (comm.am_i_root()) {
+      std::cout << " -> Timing (" << nreps << " reps):\n"
+                << "      fwd remap: " << t_fwd/nreps*1e6 << " us\n"
+                << "      bwd remap: " << t_bwd/nreps*1e6 << " us\n";
+    }
+  }
+
+  // Delete remapper before finalizing the mpi context, since the remapper has some MPI stuff in it
+  remapper = nullptr;
+
+  // Finalize Homme::Context
+  Homme::Context::finalize_singleton();
+
+  // Cleanup f90 structures
+  cleanup_test_f90();
+}
+
+TEST_CASE("remap_unpacked_state", "") {
+
+  using namespace scream;
+  using namespace ShortFieldTagsNames;
+
+  // Some type defs
+  using PackType = ekat::Pack<Homme::Real,HOMMEXX_VECTOR_SIZE>;
+  using Remapper = PhysicsDynamicsRemapper<Homme::Real>;
+  using IPDF = std::uniform_int_distribution<int>;
+  using FID = FieldIdentifier;
+  using FL  = FieldLayout;
+
+  constexpr int pg_gll = 0;
+
+  // Create a comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto engine = setup_random_test(&comm);
+
+  // Init homme context
+  if (!is_parallel_inited_f90()) {
+    auto comm_f = MPI_Comm_c2f(MPI_COMM_WORLD);
+    init_parallel_f90(comm_f);
+  }
+  init_test_params_f90 ();
+
+  auto& c = Homme::Context::singleton();
+
+  // Set parameters
+  constexpr int ne = 2;
+  set_homme_param("ne",ne);
+
+  // Create the grids
+  ekat::ParameterList params;
+  params.set<std::string>("Reference Grid","Physics GLL");
+  DynamicsDrivenGridsManager gm(comm,params);
+  std::set<std::string> grids_names = {"Physics GLL","Dynamics"};
+  gm.build_grids(grids_names);
+
+  auto phys_grid = gm.get_grid("Physics GLL");
+  auto dyn_grid  = gm.get_grid("Dynamics");
+  auto h_p_dofs = Kokkos::create_mirror_view(phys_grid->get_dofs_gids());
+  auto h_d_dofs = Kokkos::create_mirror_view(dyn_grid->get_dofs_gids());
+  auto h_d_lid2idx = Kokkos::create_mirror_view(dyn_grid->get_lid_to_idx_map());
+  Kokkos::deep_copy(h_p_dofs,phys_grid->get_dofs_gids());
+  Kokkos::deep_copy(h_d_dofs,dyn_grid->get_dofs_gids());
+  Kokkos::deep_copy(h_d_lid2idx,dyn_grid->get_lid_to_idx_map());
+
+  constexpr int np  = HOMMEXX_NP;
+  constexpr int NVL = HOMMEXX_NUM_PHYSICAL_LEV;
+  constexpr int NTL = HOMMEXX_NUM_TIME_LEVELS;
+  const int nle = get_num_local_elems_f90();
+  const int nlc = get_num_local_columns_f90(pg_gll);
+  const auto units = ekat::units::m;  // Placeholder units (we don't care about units here)
+
+  const int np1 = IPDF(0,NTL-1)(engine);
+
+  c.create_if_not_there<Homme::TimeLevel>();
+  auto& tl = c.get<Homme::TimeLevel>();
+  tl.np1 = np1;
+  tl.nm1 = (np1+1) % NTL;
+  tl.n0  = (np1+2) % NTL;
+
+  // State fields whose dyn side is zeroed only at the remapped time level before the
+  // fwd remap. The scalar and vector states are not padded, so the per-element number
+  // of reals to zero is not a multiple of the number of time levels. A packed state is
+  // registered last, so that its zero offsets depend on the previous ones.
+  const auto dgn = dyn_grid->name();
+  const auto pgn = phys_grid->name();
+  FID ss_dyn_fid  ("ss_dyn",  FL({EL,TL,    GP,GP,LEV},{nle,NTL,  np,np,NVL}),units,dgn);
+  FID vs_dyn_fid  ("vs_dyn",  FL({EL,TL,CMP,GP,GP,LEV},{nle,NTL,2,np,np,NVL}),units,dgn);
+  FID ssp_dyn_fid ("ssp_dyn", FL({EL,TL,    GP,GP,LEV},{nle,NTL,  np,np,NVL}),units,dgn);
+  FID ss_phys_fid ("ss_phys", FL({COL,    LEV},{nlc,  NVL}),units,pgn);
+  FID vs_phys_fid ("vs_phys", FL({COL,CMP,LEV},{nlc,2,NVL}),units,pgn);
+  FID ssp_phys_fid("ssp_phys",FL({COL,    LEV},{nlc,  NVL}),units,pgn);
+
+  Field<Real> ss_phys (ss_phys_fid);
+  Field<Real> vs_phys (vs_phys_fid);
+  Field<Real> ssp_phys (ssp_phys_fid);
+  Field<Real> ss_dyn (ss_dyn_fid);
+  Field<Real> vs_dyn (vs_dyn_fid);
+  Field<Real> ssp_dyn (ssp_dyn_fid);
+
+  ssp_phys.get_header().get_alloc_properties().request_allocation<PackType>();
+  ssp_dyn.get_header().get_alloc_properties().request_allocation<PackType>();
+
+  for (auto f : {&ss_phys, &vs_phys, &ssp_phys, &ss_dyn, &vs_dyn, &ssp_dyn}) {
+    f->allocate_view();
+  }
+
+  std::shared_ptr<Remapper> remapper(new Remapper(phys_grid,dyn_grid));
+  remapper->registration_begins();
+  remapper->register_field(ss_phys, ss_dyn);
+  remapper->register_field(vs_phys, vs_dyn);
+  remapper->register_field(ssp_phys, ssp_dyn);
+  remapper->registration_ends();
+
+  // Fill all dyn time levels with garbage: the fwd remap must overwrite np1 only
+  constexpr Homme::Real garbage = -1;
+  auto h_ss_dyn  = ss_dyn.get_view<Homme::Real*****,Host>();
+  auto h_vs_dyn  = vs_dyn.get_view<Homme::Real******,Host>();
+  auto h_ssp_dyn = ssp_dyn.get_view<Homme::Real*****,Host>();
+  Kokkos::deep_copy(h_ss_dyn,garbage);
+  Kokkos::deep_copy(h_vs_dyn,garbage);
+  Kokkos::deep_copy(h_ssp_dyn,garbage);
+  for (auto f : {&ss_dyn, &vs_dyn, &ssp_dyn}) {
+    f->modify<Host>();
+    f->sync_to_dev();
+  }
+
+  // Set the phys fields to the column gid
+  auto h_ss_phys  = ss_phys.get_view<Homme::Real**,Host>();
+  auto h_vs_phys  = vs_phys.get_view<Homme::Real***,Host>();
+  auto h_ssp_phys = ssp_phys.get_view<Homme::Real**,Host>();
+  for (int icol=0; icol<nlc; ++icol) {
+    const Homme::Real gid = h_p_dofs(icol);
+    for (int il=0; il<NVL; ++il) {
+      h_ss_phys(icol,il)  = gid;
+      h_vs_phys(icol,0,il) = gid;
+      h_vs_phys(icol,1,il) = gid;
+      h_ssp_phys(icol,il) = gid;
+    }
+  }
+  for (auto f : {&ss_phys, &vs_phys, &ssp_phys}) {
+    f->modify<Host>();
+    f->sync_to_dev();
+  }
+
+  remapper->remap(true);
+
+  for (auto f : {&ss_dyn, &vs_dyn, &ssp_dyn}) {
+    f->sync_to_host();
+  }
+  for (int idof=0; idof<dyn_grid->get_num_local_dofs(); ++idof) {
+    const int ie = h_d_lid2idx(idof,0);
+    const int ip = h_d_lid2idx(idof,1);
+    const int jp = h_d_lid2idx(idof,2);
+    const Homme::Real gid = h_d_dofs(idof);
+    for (int itl=0; itl<NTL; ++itl) {
+      const Homme::Real expected = itl==np1 ? gid : garbage;
+      for (int il=0; il<NVL; ++il) {
+        REQUIRE (h_ss_dyn(ie,itl,ip,jp,il)==expected);
+        REQUIRE (h_vs_dyn(ie,itl,0,ip,jp,il)==expected);
+        REQUIRE (h_vs_dyn(ie,itl,1,ip,jp,il)==expected);
+        REQUIRE (h_ssp_dyn(ie,itl,ip,jp,il)==expected);
+      }
+    }
   }
 
   // Delete remapper before finalizing the mpi context, since the remapper has some MPI stuff in it
@@ -1140,4 +1324,353 @@ TEST_CASE("combo_remap", "") {
   cleanup_test_f90();
 }
 
+TEST_CASE("fv_remap", "") {
+
+  using namespace scream;
+  using namespace ShortFieldTagsNames;
+
+  // Some type defs
+  using PackType = ekat::Pack<Homme::Real,HOMMEXX_VECTOR_SIZE>;
+  using IPDF = std::uniform_int_distribution<int>;
+  using RPDF = std::uniform_real_distribution<Homme::Real>;
+  using FID = FieldIdentifier;
+  using FL  = FieldLayout;
+
+  constexpr int pg_type = 2;
+
+  // Create a comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto engine = setup_random_test(&comm);
+
+  // Init homme context
+  if (!is_parallel_inited_f90()) {
+    auto comm_f = MPI_Comm_c2f(MPI_COMM_WORLD);
+    init_parallel_f90(comm_f);
+  }
+  init_test_params_f90 ();
+
+  // We'll use this extensively, so let's use a short ref name
+  auto& c = Homme::Context::singleton();
+
+  // Set a value for qsize that is not the full qsize_d
+  auto& sp = c.create<Homme::SimulationParams>();
+  sp.qsize = std::max(HOMMEXX_QSIZE_D/2,1);
+
+  // Set parameters
+  constexpr int ne = 2;
+  set_homme_param("ne",ne);
+
+  // Create the grids. Building the PG2 grid also runs Homme's f90 gfr_init
+  ekat::ParameterList params;
+  params.set<std::string>("Reference Grid","Physics PG2");
+  DynamicsDrivenGridsManager gm(comm,params);
+  std::set<std::string> grids_names = {"Physics PG2","Dynamics"};
+  gm.build_grids(grids_names);
+
+  // The FV remapper needs the elements geometry and the operators of Homme's
+  // GllFvRemap. Set them up as HommeDynamics would, minus the model init.
+  c.create_if_not_there<Homme::HybridVCoord>();
+  init_test_geometry_f90 ();
+  auto& gfr = c.create<Homme::GllFvRemap>();
+  gfr.reset(sp);
+  gfr_init_hxx();
+
+  // Local counters
+  const int num_local_elems = get_num_local_elems_f90();
+  const int num_local_cols = get_num_local_columns_f90(pg_type);
+  EKAT_REQUIRE_MSG(num_local_cols>0, "Internal test error! Fix homme_pd_remap_tests, please.\n");
+
+  // Get physics and dynamics grids
+  auto phys_grid = gm.get_grid("Physics PG2");
+  auto dyn_grid  = gm.get_grid("Dynamics");
+
+  // Get some dimensions for Homme
+  constexpr int np  = HOMMEXX_NP;
+  constexpr int NVL = HOMMEXX_NUM_PHYSICAL_LEV;
+  constexpr int NTL = HOMMEXX_NUM_TIME_LEVELS;
+  const int nle = num_local_elems;
+  const int nlc = num_local_cols;
+  const int nf2 = nlc / nle;
+  const auto units = ekat::units::m;  // Placeholder units (we don't care about units here)
+  REQUIRE (nf2==pg_type*pg_type);
+
+  const int np1 = IPDF(0,NTL-1)(engine);
+
+  c.create_if_not_there<Homme::TimeLevel>();
+  auto& tl = c.get<Homme::TimeLevel>();
+  tl.np1 = np1;
+  tl.nm1 = (np1+1) % NTL;
+  tl.n0  = (np1+2) % NTL;
+
+  // Note on prefixes: s=scalar, v=vector, ss=scalar state
+
+  // Create identifiers
+  const auto dgn = dyn_grid->name();
+  const auto pgn = phys_grid->name();
+  FID s_2d_dyn_fid  ("s_2d_dyn",  FL({EL,         GP, GP    }, {nle,         np, np     }), units, dgn);
+  FID v_2d_dyn_fid  ("v_2d_dyn",  FL({EL,     CMP, GP, GP   }, {nle,      2, np, np     }), units, dgn);
+  FID s_3d_dyn_fid  ("s_3d_dyn",  FL({EL,         GP, GP, LEV}, {nle,         np, np, NVL}), units, dgn);
+  FID ss_3d_dyn_fid ("ss_3d_dyn", FL({EL, TL,     GP, GP, LEV}, {nle, NTL,    np, np, NVL}), units, dgn);
+
+  FID s_2d_phys_fid  ("s_2d_phys",  FL({COL        }, {nlc        }), units, pgn);
+  FID v_2d_phys_fid  ("v_2d_phys",  FL({COL, CMP   }, {nlc, 2     }), units, pgn);
+  FID s_3d_phys_fid  ("s_3d_phys",  FL({COL,    LEV}, {nlc,    NVL}), units, pgn);
+  FID ss_3d_phys_fid ("ss_3d_phys", FL({COL,    LEV}, {nlc,    NVL}), units, pgn);
+
+  // Create fields
+  Field<Real> s_2d_field_phys  (s_2d_phys_fid);
+  Field<Real> v_2d_field_phys  (v_2d_phys_fid);
+  Field<Real> s_3d_field_phys  (s_3d_phys_fid);
+  Field<Real> ss_3d_field_phys (ss_3d_phys_fid);
+
+  Field<Real> s_2d_field_dyn  (s_2d_dyn_fid);
+  Field<Real> v_2d_field_dyn  (v_2d_dyn_fid);
+  Field<Real> s_3d_field_dyn  (s_3d_dyn_fid);
+  Field<Real> ss_3d_field_dyn (ss_3d_dyn_fid);
+
+  // Request allocation to fit packs of reals for 3d views
+  s_3d_field_phys.get_header().get_alloc_properties().request_allocation<PackType>();
+  ss_3d_field_phys.get_header().get_alloc_properties().request_allocation<PackType>();
+  s_3d_field_dyn.get_header().get_alloc_properties().request_allocation<PackType>();
+  ss_3d_field_dyn.get_header().get_alloc_properties().request_allocation<PackType>();
+
+  // Allocate view
+  s_2d_field_phys.allocate_view();
+  v_2d_field_phys.allocate_view();
+  s_3d_field_phys.allocate_view();
+  ss_3d_field_phys.allocate_view();
+
+  s_2d_field_dyn.allocate_view();
+  v_2d_field_dyn.allocate_view();
+  s_3d_field_dyn.allocate_view();
+  ss_3d_field_dyn.allocate_view();
+
+  // Build the remapper through the grids manager, and register the fields
+  auto remapper = gm.create_remapper(phys_grid,dyn_grid);
+  remapper->registration_begins();
+  remapper->register_field(s_2d_field_phys,  s_2d_field_dyn);
+  remapper->register_field(v_2d_field_phys,  v_2d_field_dyn);
+  remapper->register_field(s_3d_field_phys,  s_3d_field_dyn);
+  remapper->register_field(ss_3d_field_phys, ss_3d_field_dyn);
+  remapper->registration_ends();
+
+  // Host views of all fields. On the dyn side, we only look at the current time level.
+  auto p_s_2d  = s_2d_field_phys.get_view<Homme::Real*,Host>();
+  auto p_v_2d  = v_2d_field_phys.get_view<Homme::Real**,Host>();
+  auto p_s_3d  = s_3d_field_phys.get_view<Homme::Real**,Host>();
+  auto p_ss_3d = ss_3d_field_phys.get_view<Homme::Real**,Host>();
+  auto d_s_2d  = s_2d_field_dyn.get_view<Homme::Real***,Host>();
+  auto d_v_2d  = v_2d_field_dyn.get_view<Homme::Real****,Host>();
+  auto d_s_3d  = s_3d_field_dyn.get_view<Homme::Real****,Host>();
+  auto d_ss_3d = ss_3d_field_dyn.get_view<Homme::Real*****,Host>();
+
+  // Note: since we write through cached host views, flag the host as modified before syncing
+  auto sync_phys = [&] (const bool to_dev) {
+    for (auto f : {&s_2d_field_phys, &v_2d_field_phys, &s_3d_field_phys, &ss_3d_field_phys}) {
+      if (to_dev) {
+        f->modify<Host>();
+        f->sync_to_dev();
+      } else {
+        f->sync_to_host();
+      }
+    }
+  };
+  auto sync_dyn_to_host = [&] () {
+    for (auto f : {&s_2d_field_dyn, &v_2d_field_dyn, &s_3d_field_dyn, &ss_3d_field_dyn}) {
+      f->sync_to_host();
+    }
+  };
+
+  // Relative tolerance: the remap is exact up to roundoff
+  const Homme::Real tol = 1e-12;
+  auto check_equal = [&] (const Homme::Real computed, const Homme::Real expected,
+                          const std::string& name) {
+    const bool ok = std::abs(computed-expected) <= tol*std::abs(expected);
+    if (!ok) {
+      printf(" ** %s ** \n",name.c_str());
+      printf("  computed: %2.16f\n",computed);
+      printf("  expected: %2.16f\n",expected);
+    }
+    REQUIRE (ok);
+  };
+
+  SECTION ("constant_round_trip") {
+    // Constant fields (possibly varying along the vertical/component dims)
+    // must be preserved by both f2g (plus DSS) and g2f.
+    auto s_2d_val  = [] ()       { return Homme::Real(2.5);       };
+    auto v_2d_val  = [] (int ic) { return Homme::Real(1.5 - 3*ic); };
+    auto s_3d_val  = [] (int il) { return Homme::Real(1 + il);     };
+    auto ss_3d_val = [] (int il) { return Homme::Real(300 - il);   };
+
+    for (int icol=0; icol<nlc; ++icol) {
+      p_s_2d(icol) = s_2d_val();
+      for (int ic=0; ic<2; ++ic) {
+        p_v_2d(icol,ic) = v_2d_val(ic);
+      }
+      for (int il=0; il<NVL; ++il) {
+        p_s_3d(icol,il)  = s_3d_val(il);
+        p_ss_3d(icol,il) = ss_3d_val(il);
+      }
+    }
+    sync_phys(true);
+
+    if (comm.am_i_root()) {
+      std::cout << " -> Remap forward\n";
+    }
+    remapper->remap(true);
+    sync_dyn_to_host();
+    for (int ie=0; ie<nle; ++ie) {
+      for (int ip=0; ip<np; ++ip) {
+        for (int jp=0; jp<np; ++jp) {
+          check_equal(d_s_2d(ie,ip,jp),s_2d_val(),"2D Scalar");
+          for (int ic=0; ic<2; ++ic) {
+            check_equal(d_v_2d(ie,ic,ip,jp),v_2d_val(ic),"2D Vector");
+          }
+          for (int il=0; il<NVL; ++il) {
+            check_equal(d_s_3d(ie,ip,jp,il),s_3d_val(il),"3D Scalar");
+            check_equal(d_ss_3d(ie,tl.n0,ip,jp,il),ss_3d_val(il),"3D Scalar State");
+          }
+        }
+      }
+    }
+
+    // Wipe the phys fields, and bring the values back from the dyn grid
+    s_2d_field_phys.deep_copy(0);
+    v_2d_field_phys.deep_copy(0);
+    s_3d_field_phys.deep_copy(0);
+    ss_3d_field_phys.deep_copy(0);
+
+    if (comm.am_i_root()) {
+      std::cout << " -> Remap backward\n";
+    }
+    remapper->remap(false);
+    sync_phys(false);
+    for (int icol=0; icol<nlc; ++icol) {
+      check_equal(p_s_2d(icol),s_2d_val(),"2D Scalar");
+      for (int ic=0; ic<2; ++ic) {
+        check_equal(p_v_2d(icol,ic),v_2d_val(ic),"2D Vector");
+      }
+      for (int il=0; il<NVL; ++il) {
+        check_equal(p_s_3d(icol,il),s_3d_val(il),"3D Scalar");
+        check_equal(p_ss_3d(icol,il),ss_3d_val(il),"3D Scalar State");
+      }
+    }
+  }
+
+  SECTION ("conservation") {
+    // The FV mass of a column is w_ff*fv_metdet, while the mass of a gll point
+    // is spheremp, whose assembled value is 1/rspheremp. Both remaps must
+    // preserve the global integral of the field.
+    const auto& gfr_data = gfr.get_impl().m_data;
+    const auto& geo = c.get<Homme::ElementsGeometry>();
+    auto fv_metdet = Kokkos::create_mirror_view(gfr_data.fv_metdet);
+    auto spheremp  = Kokkos::create_mirror_view(geo.m_spheremp);
+    auto rspheremp = Kokkos::create_mirror_view(geo.m_rspheremp);
+    Kokkos::deep_copy(fv_metdet,gfr_data.fv_metdet);
+    Kokkos::deep_copy(spheremp,geo.m_spheremp);
+    Kokkos::deep_copy(rspheremp,geo.m_rspheremp);
+    const Homme::Real w_ff = gfr_data.w_ff;
+
+    // Sanity check: the assembled mass is never smaller than the local one
+    Homme::Real local_area = 0, area;
+    for (int ie=0; ie<nle; ++ie) {
+      for (int ip=0; ip<np; ++ip) {
+        for (int jp=0; jp<np; ++jp) {
+          local_area += spheremp(ie,ip,jp);
+          REQUIRE (spheremp(ie,ip,jp)*rspheremp(ie,ip,jp)<=1+tol);
+        }
+      }
+    }
+    comm.all_reduce(&local_area,&area,1,MPI_SUM);
+
+    auto fv_mass = [&] (const int il) {
+      Homme::Real local_mass = 0, mass;
+      for (int ie=0; ie<nle; ++ie) {
+        for (int f=0; f<nf2; ++f) {
+          const int icol = ie*nf2 + f;
+          const auto x = il<0 ? p_s_2d(icol) : p_s_3d(icol,il);
+          local_mass += w_ff*fv_metdet(ie,f)*x;
+        }
+      }
+      comm.all_reduce(&local_mass,&mass,1,MPI_SUM);
+      return mass;
+    };
+    auto gll_mass = [&] (const int il) {
+      Homme::Real local_mass = 0, mass;
+      for (int ie=0; ie<nle; ++ie) {
+        for (int ip=0; ip<np; ++ip) {
+          for (int jp=0; jp<np; ++jp) {
+            const auto y = il<0 ? d_s_2d(ie,ip,jp) : d_s_3d(ie,ip,jp,il);
+            local_mass += spheremp(ie,ip,jp)*y;
+          }
+        }
+      }
+      comm.all_reduce(&local_mass,&mass,1,MPI_SUM);
+      return mass;
+    };
+
+    // Random positive fields on the FV grid
+    RPDF pdf(0.5,1.5);
+    for (int icol=0; icol<nlc; ++icol) {
+      p_s_2d(icol) = pdf(engine);
+      for (int ic=0; ic<2; ++ic) {
+        p_v_2d(icol,ic) = pdf(engine);
+      }
+      for (int il=0; il<NVL; ++il) {
+        p_s_3d(icol,il)  = pdf(engine);
+        p_ss_3d(icol,il) = pdf(engine);
+      }
+    }
+    sync_phys(true);
+
+    std::vector<Homme::Real> mass0(NVL+1);
+    for (int il=-1; il<NVL; ++il) {
+      mass0[il+1] = fv_mass(il);
+    }
+
+    // Phys->dyn: the FV mass must equal the GLL mass
+    if (comm.am_i_root()) {
+      std::cout << " -> Remap forward\n";
+    }
+    remapper->remap(true);
+    sync_dyn_to_host();
+    for (int il=-1; il<NVL; ++il) {
+      check_equal(gll_mass(il),mass0[il+1],"Mass (phys->dyn)");
+    }
+
+    // Dyn->phys: the dyn fields are now continuous, so the GLL mass is
+    // well defined, and must be preserved by g2f.
+    s_2d_field_phys.deep_copy(0);
+    s_3d_field_phys.deep_copy(0);
+    if (comm.am_i_root()) {
+      std::cout << " -> Remap backward\n";
+    }
+    remapper->remap(false);
+    sync_phys(false);
+    for (int il=-1; il<NVL; ++il) {
+      check_equal(fv_mass(il),mass0[il+1],"Mass (dyn->phys)");
+    }
+
+    // Finally, the total FV area must match the total GLL area
+    Homme::Real local_fv_area = 0, fv_area;
+    for (int ie=0; ie<nle; ++ie) {
+      for (int f=0; f<nf2; ++f) {
+        local_fv_area += w_ff*fv_metdet(ie,f);
+      }
+    }
+    comm.all_reduce(&local_fv_area,&fv_area,1,MPI_SUM);
+    check_equal(fv_area,area,"Area");
+  }
+
+  // Delete remapper before finalizing the mpi context, since the remapper has some MPI stuff in it
+  remapper = nullptr;
+
+  // Finalize Homme::Context
+  Homme::Context::finalize_singleton();
+
+  // Cleanup f90 structures
+  cleanup_test_f90();
+}
+
 } // anonymous namespace
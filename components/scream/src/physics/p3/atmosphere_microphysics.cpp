@@ -262,6 +262,9 @@ void P3Microphysics::initialize_impl ()
   infrastructure.kte = m_num_levs-1;
   infrastructure.predictNc = true;     // Hard-coded for now, TODO: make this a runtime option 
   infrastructure.prescribedCCN = true; // Hard-coded for now, TODO: make this a runtime option
+  // One pass implicit sedimentation instead of CFL substepping. Not BFB with the
+  // reference implementation, hence off by default.
+  infrastructure.implicitSed = m_params.get<bool>("Implicit Sedimentation",false);
   infrastructure.col_location = m_buffer.col_location; // TODO: Initialize this here and now when P3 has access to lat/lon for each column.
   // --History Only
   history_only.liq_ice_exchange = get_field_out("micro_liq_ice_exchange").get_view<Pack**>();
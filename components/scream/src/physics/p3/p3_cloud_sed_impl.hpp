@@ -32,7 +32,8 @@ void Functions<S,D>
     const uview_1d<Spack>& lamc,
     const uview_1d<Spack>& qc_tend,
     const uview_1d<Spack>& nc_tend,
-    Scalar& precip_liq_surf)
+    Scalar& precip_liq_surf,
+    const bool& do_implicit_sed)
 {
   // Get temporary workspaces needed for the cloud-sed calculation
   uview_1d<Spack> V_qc, V_nc, flux_qx, flux_nx;
@@ -70,21 +71,7 @@ void Functions<S,D>
       const Int kmin_scalar = ( kdir == 1 ? k_qxbot : k_qxtop);
       const Int kmax_scalar = ( kdir == 1 ? k_qxtop : k_qxbot);
 
-      Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, V_qc.extent(0)), [&] (Int k) {
-          V_qc(k) = 0;
-          if (do_predict_nc) {
-            V_nc(k) = 0;
-          }
-      });
-      team.team_barrier();
-
-      // Convert top/bot to pack indices
-      ekat::impl::set_min_max(k_qxbot, k_qxtop, kmin, kmax, Spack::n);
-
-      Kokkos::parallel_reduce(
-        Kokkos::TeamThreadRange(team, kmax-kmin+1), [&] (int pk_, Scalar& lmax) {
-          const int pk = kmin + pk_;
+      const auto compute_V = [&] (const int pk) {
           const auto range_pack = ekat::range<IntSmallPack>(pk*Spack::n);
           const auto range_mask = range_pack >= kmin_scalar && range_pack <= kmax_scalar;
           const auto qc_gt_small = range_mask && qc_incld(pk) > qsmall;
@@ -104,15 +91,55 @@ void Functions<S,D>
               V_nc(pk).set(qc_gt_small, acn(pk)*tgamma(1 + bcn + mu_c(pk)) * dum / tgamma(mu_c(pk)+1));
             }
           }
-
-          const auto Co_max_local = max(qc_gt_small, 0,
-                                        V_qc(pk) * dt_left * inv_dz(pk));
-          if (Co_max_local > lmax)
-            lmax = Co_max_local;
-      }, Kokkos::Max<Scalar>(Co_max));
+          return qc_gt_small;
+      };
+
+      if (do_implicit_sed) {
+        // The implicit step does not need Co_max, so zero and compute the
+        // fall speeds in one pass, and skip the reduction
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, V_qc.extent(0)), [&] (int pk) {
+            V_qc(pk) = 0;
+            if (do_predict_nc) {
+              V_nc(pk) = 0;
+            }
+            compute_V(pk);
+        });
+      }
+      else {
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, V_qc.extent(0)), [&] (Int k) {
+            V_qc(k) = 0;
+            if (do_predict_nc) {
+              V_nc(k) = 0;
+            }
+        });
+        team.team_barrier();
+
+        // Convert top/bot to pack indices
+        ekat::impl::set_min_max(k_qxbot, k_qxtop, kmin, kmax, Spack::n);
+
+        Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(team, kmax-kmin+1), [&] (int pk_, Scalar& lmax) {
+            const int pk = kmin + pk_;
+            const auto qc_gt_small = compute_V(pk);
+            const auto Co_max_local = max(qc_gt_small, 0,
+                                          V_qc(pk) * dt_left * inv_dz(pk));
+            if (Co_max_local > lmax)
+              lmax = Co_max_local;
+        }, Kokkos::Max<Scalar>(Co_max));
+      }
       team.team_barrier();
 
-      if (do_predict_nc) {
+      if (do_implicit_sed) {
+        if (do_predict_nc) {
+          implicit_sedimentation<2>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+        }
+        else {
+          implicit_sedimentation<1>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, dt_left, prt_accum, flux_ptr, v_ptr, qr_ptr);
+        }
+      }
+      else if (do_predict_nc) {
         generalized_sedimentation<2>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, Co_max, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
       }
       else {
@@ -34,6 +34,7 @@ FortranData::FortranData (Int ncol_, Int nlev_)
 {
   do_predict_nc = true;
   do_prescribed_CCN = true;
+  do_implicit_sed = false;
   dt = -1; // model time step, s; set to invalid -1
   it = 1;
   // In/out
@@ -127,6 +128,7 @@ void p3_init () {
 Int p3_main (const FortranData& d, bool use_fortran) {
   EKAT_REQUIRE_MSG(d.dt > 0, "invalid dt");
   if (use_fortran) {
+    EKAT_REQUIRE_MSG(!d.do_implicit_sed, "implicit sedimentation is not available in the fortran impl");
     Real elapsed_s;
     p3_main_c(d.qc.data(), d.nc.data(), d.qr.data(), d.nr.data(),
               d.th_atm.data(), d.qv.data(), d.dt, d.qi.data(),
@@ -150,7 +152,8 @@ Int p3_main (const FortranData& d, bool use_fortran) {
                      d.precip_liq_flux.data(), d.precip_ice_flux.data(),
                      d.cld_frac_r.data(), d.cld_frac_l.data(), d.cld_frac_i.data(),
                      d.liq_ice_exchange.data(), d.vap_liq_exchange.data(),
-                     d.vap_ice_exchange.data(),d.qv_prev.data(),d.t_prev.data() );
+                     d.vap_ice_exchange.data(),d.qv_prev.data(),d.t_prev.data(),
+                     d.do_implicit_sed);
 
   }
 }
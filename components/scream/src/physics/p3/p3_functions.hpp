@@ -186,6 +186,8 @@ struct Functions
     bool predictNc;
     // Set to true to use prescribed CCN
     bool prescribedCCN;
+    // Set to true to use one pass implicit sedimentation instead of CFL substepping
+    bool implicitSed;
     // Coordinates of columns, nj x 3
     view_2d<const Scalar> col_location;
   };
@@ -297,12 +299,30 @@ struct Functions
                                const TableIce& tab,
                                const Smask& context = Smask(true) );
 
+  // Apply TableIce data to the ice tables for the N quantities listed in idx
+  // at once, storing the result for idx[n] in proc[n]. The table offsets and
+  // interpolation weights are computed once and shared by all quantities, so
+  // this is much cheaper than N calls to the single-quantity version.
+  template <int N>
+  KOKKOS_FUNCTION
+  static void apply_table_ice(const int (&idx)[N], const view_ice_table& ice_table_vals,
+                              const TableIce& tab, Spack (&proc)[N],
+                              const Smask& context = Smask(true) );
+
   // Interpolates lookup table values for rain/ice collection processes
   KOKKOS_FUNCTION
   static Spack apply_table_coll(const int& index, const view_collect_table& collect_table_vals,
                                 const TableIce& ti, const TableRain& tr,
                                 const Smask& context = Smask(true) );
 
+  // Interpolates all the rain/ice collection quantities at once; proc[n]
+  // holds the value that apply_table_coll(n, ...) would return.
+  KOKKOS_FUNCTION
+  static void apply_table_coll(const view_collect_table& collect_table_vals,
+                               const TableIce& ti, const TableRain& tr,
+                               Spack (&proc)[P3C::collect_table_size],
+                               const Smask& context = Smask(true) );
+
   // -- Sedimentation time step
 
   // Calculate the first-order upwind step in the region [k_bot,
@@ -369,6 +389,23 @@ struct Functions
     const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
     const view_1d_ptr_array<Spack, nfield>& rs);
 
+  // One pass alternative to generalized_sedimentation: a backward Euler, first
+  // order upwind step over the full dt_left, from k_qxtop to kbot. It is stable
+  // and positive for any Courant number, so it needs no CFL substepping, at the
+  // cost of more numerical diffusion when the Courant number is large. On
+  // output, dt_left is 0 and k_qxbot is kbot.
+  template <int nfield>
+  KOKKOS_FUNCTION
+  static void implicit_sedimentation(
+    const uview_1d<const Spack>& rho,
+    const uview_1d<const Spack>& inv_rho,
+    const uview_1d<const Spack>& inv_dz,
+    const MemberType& team,
+    const Int& nk, const Int& k_qxtop, Int& k_qxbot, const Int& kbot, const Int& kdir, Scalar& dt_left, Scalar& prt_accum,
+    const view_1d_ptr_array<Spack, nfield>& fluxes,
+    const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
+    const view_1d_ptr_array<Spack, nfield>& rs);
+
   // Cloud sedimentation
   KOKKOS_FUNCTION
   static void cloud_sedimentation(
@@ -390,7 +427,8 @@ struct Functions
     const uview_1d<Spack>& lamc,
     const uview_1d<Spack>& qc_tend,
     const uview_1d<Spack>& nc_tend,
-    Scalar& precip_liq_surf);
+    Scalar& precip_liq_surf,
+    const bool& do_implicit_sed = false);
 
   // TODO: comment
   KOKKOS_FUNCTION
@@ -413,7 +451,8 @@ struct Functions
     const uview_1d<Spack>& precip_liq_flux,
     const uview_1d<Spack>& qr_tend,
     const uview_1d<Spack>& nr_tend,
-    Scalar& precip_liq_surf);
+    Scalar& precip_liq_surf,
+    const bool& do_implicit_sed = false);
 
   // TODO: comment
   KOKKOS_FUNCTION
@@ -437,7 +476,8 @@ struct Functions
     const uview_1d<Spack>& qi_tend,
     const uview_1d<Spack>& ni_tend,
     const view_ice_table& ice_table_vals,
-    Scalar& precip_ice_surf);
+    Scalar& precip_ice_surf,
+    const bool& do_implicit_sed = false);
 
   // homogeneous freezing of cloud and rain
   KOKKOS_FUNCTION
@@ -85,7 +85,8 @@ void Functions<S,D>
   const uview_1d<Spack>& qi_tend,
   const uview_1d<Spack>& ni_tend,
   const view_ice_table& ice_table_vals,
-  Scalar& precip_ice_surf)
+  Scalar& precip_ice_surf,
+  const bool& do_implicit_sed)
 {
   // Get temporary workspaces needed for the ice-sed calculation
   uview_1d<Spack> V_qit, V_nit, flux_nit, flux_bir, flux_qir, flux_qit;
@@ -118,21 +119,8 @@ void Functions<S,D>
       const Int kmin_scalar = ( kdir == 1 ? k_qxbot : k_qxtop);
       const Int kmax_scalar = ( kdir == 1 ? k_qxtop : k_qxbot);
 
-      Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, V_qit.extent(0)), [&] (Int k) {
-          V_qit(k) = 0;
-          V_nit(k) = 0;
-      });
-      team.team_barrier();
-
-      // Convert top/bot to pack indices
-      ekat::impl::set_min_max(k_qxbot, k_qxtop, kmin, kmax, Spack::n);
-
       // compute Vq, Vn (get values from lookup table)
-      Kokkos::parallel_reduce(
-        Kokkos::TeamThreadRange(team, kmax-kmin+1), [&] (int pk_, Scalar& lmax) {
-
-        const int pk = kmin + pk_;
+      const auto compute_V = [&] (const int pk) {
         const auto range_pack = ekat::range<IntSmallPack>(pk*Spack::n);
         const auto range_mask = range_pack >= kmin_scalar && range_pack <= kmax_scalar;
         const auto qi_gt_small = range_mask && qi_incld(pk) > qsmall;
@@ -147,10 +135,13 @@ void Functions<S,D>
           TableIce tab;
           lookup_ice(qi_incld(pk), ni_incld(pk), qm_incld(pk), rhop, tab, qi_gt_small);
 
-          const auto table_val_ni_fallspd = apply_table_ice(0, ice_table_vals, tab, qi_gt_small);
-          const auto table_val_qi_fallspd = apply_table_ice(1, ice_table_vals, tab, qi_gt_small);
-          const auto table_val_ni_lammax = apply_table_ice(6, ice_table_vals, tab, qi_gt_small);
-          const auto table_val_ni_lammin = apply_table_ice(7, ice_table_vals, tab, qi_gt_small);
+          const int table_idx[4] = {0, 1, 6, 7};
+          Spack table_vals[4];
+          apply_table_ice(table_idx, ice_table_vals, tab, table_vals, qi_gt_small);
+          const auto& table_val_ni_fallspd = table_vals[0];
+          const auto& table_val_qi_fallspd = table_vals[1];
+          const auto& table_val_ni_lammax  = table_vals[2];
+          const auto& table_val_ni_lammin  = table_vals[3];
 
           // impose mean ice size bounds (i.e. apply lambda limiters)
           // note that the Nmax and Nmin are normalized and thus need to be multiplied by existing N
@@ -161,13 +152,47 @@ void Functions<S,D>
           V_qit(pk).set(qi_gt_small, table_val_qi_fallspd * rhofaci(pk)); // mass-weighted   fall speed (with density factor)
           V_nit(pk).set(qi_gt_small, table_val_ni_fallspd * rhofaci(pk)); // number-weighted fall speed (with density factor)
         }
-        const auto Co_max_local = max(qi_gt_small, 0,
-                                      V_qit(pk) * dt_left * inv_dz(pk));
-        if (Co_max_local > lmax) lmax = Co_max_local;
-      }, Kokkos::Max<Scalar>(Co_max));
+        return qi_gt_small;
+      };
+
+      if (do_implicit_sed) {
+        // The implicit step does not need Co_max, so zero and compute the
+        // fall speeds in one pass, and skip the reduction
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, V_qit.extent(0)), [&] (int pk) {
+            V_qit(pk) = 0;
+            V_nit(pk) = 0;
+            compute_V(pk);
+        });
+      }
+      else {
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, V_qit.extent(0)), [&] (Int k) {
+            V_qit(k) = 0;
+            V_nit(k) = 0;
+        });
+        team.team_barrier();
+
+        // Convert top/bot to pack indices
+        ekat::impl::set_min_max(k_qxbot, k_qxtop, kmin, kmax, Spack::n);
+
+        Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(team, kmax-kmin+1), [&] (int pk_, Scalar& lmax) {
+          const int pk = kmin + pk_;
+          const auto qi_gt_small = compute_V(pk);
+          const auto Co_max_local = max(qi_gt_small, 0,
+                                        V_qit(pk) * dt_left * inv_dz(pk));
+          if (Co_max_local > lmax) lmax = Co_max_local;
+        }, Kokkos::Max<Scalar>(Co_max));
+      }
       team.team_barrier();
 
-      generalized_sedimentation<4>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, Co_max, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+      if (do_implicit_sed) {
+        implicit_sedimentation<4>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+      }
+      else {
+        generalized_sedimentation<4>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, Co_max, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+      }
 
       //Update _incld values with end-of-step cell-ave values
       //No prob w/ div by cld_frac_i because set to min of 1e-4 in interface.
@@ -272,27 +272,27 @@ Int Functions<S,D>
     // ==========================================================================================!
     // Sedimentation:
 
-    // Cloud sedimentation:  (adaptive substepping)
+    // Cloud sedimentation:  (adaptive substepping, or one implicit step)
 
     cloud_sedimentation(
       qc_incld, rho, inv_rho, ocld_frac_l, acn, inv_dz, dnu, team, workspace,
       nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, infrastructure.predictNc,
       oqc, onc, nc_incld, mu_c, lamc, qtend_ignore, ntend_ignore,
-      diagnostic_outputs.precip_liq_surf(i));
+      diagnostic_outputs.precip_liq_surf(i), infrastructure.implicitSed);
 
-    // Rain sedimentation:  (adaptive substepping)
+    // Rain sedimentation:  (adaptive substepping, or one implicit step)
     rain_sedimentation(
       rho, inv_rho, rhofacr, ocld_frac_r, inv_dz, qr_incld, team, workspace,
       vn_table_vals, vm_table_vals, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, oqr,
       onr, nr_incld, mu_r, lamr, oprecip_liq_flux, qtend_ignore, ntend_ignore,
-      diagnostic_outputs.precip_liq_surf(i));
+      diagnostic_outputs.precip_liq_surf(i), infrastructure.implicitSed);
 
-    // Ice sedimentation:  (adaptive substepping)
+    // Ice sedimentation:  (adaptive substepping, or one implicit step)
     ice_sedimentation(
       rho, inv_rho, rhofaci, ocld_frac_i, inv_dz, team, workspace, nk, ktop, kbot,
       kdir, infrastructure.dt, inv_dt, oqi, qi_incld, oni, ni_incld,
       oqm, qm_incld, obm, bm_incld, qtend_ignore, ntend_ignore,
-      ice_table_vals, diagnostic_outputs.precip_ice_surf(i));
+      ice_table_vals, diagnostic_outputs.precip_ice_surf(i), infrastructure.implicitSed);
 
     // homogeneous freezing of cloud and rain
     homogeneous_freezing(
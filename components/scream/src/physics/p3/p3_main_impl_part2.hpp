@@ -238,18 +238,23 @@ void Functions<S,D>
         lookup_rain(qr_incld(k), nr_incld(k), table_rain, qi_gt_small);
 
         // call to lookup table interpolation subroutines to get process rates
-        table_val_qi_fallspd.set(qi_gt_small, apply_table_ice(1, ice_table_vals, table_ice, qi_gt_small));
-        table_val_ni_self_collect.set(qi_gt_small, apply_table_ice(2, ice_table_vals, table_ice, qi_gt_small));
-        table_val_qc2qi_collect.set(qi_gt_small, apply_table_ice(3, ice_table_vals, table_ice, qi_gt_small));
-        table_val_qi2qr_melting.set(qi_gt_small, apply_table_ice(4, ice_table_vals, table_ice, qi_gt_small));
-        table_val_ni_lammax.set(qi_gt_small, apply_table_ice(6, ice_table_vals, table_ice, qi_gt_small));
-        table_val_ni_lammin.set(qi_gt_small, apply_table_ice(7, ice_table_vals, table_ice, qi_gt_small));
-        table_val_qi2qr_vent_melt.set(qi_gt_small, apply_table_ice(9, ice_table_vals, table_ice, qi_gt_small));
+        const int table_idx[7] = {1, 2, 3, 4, 6, 7, 9};
+        Spack table_vals[7];
+        apply_table_ice(table_idx, ice_table_vals, table_ice, table_vals, qi_gt_small);
+        table_val_qi_fallspd.set(qi_gt_small, table_vals[0]);
+        table_val_ni_self_collect.set(qi_gt_small, table_vals[1]);
+        table_val_qc2qi_collect.set(qi_gt_small, table_vals[2]);
+        table_val_qi2qr_melting.set(qi_gt_small, table_vals[3]);
+        table_val_ni_lammax.set(qi_gt_small, table_vals[4]);
+        table_val_ni_lammin.set(qi_gt_small, table_vals[5]);
+        table_val_qi2qr_vent_melt.set(qi_gt_small, table_vals[6]);
 
         // ice-rain collection processes
         const auto qr_gt_small = qr_incld(k) >= qsmall && qi_gt_small;
-        table_val_nr_collect.set(qr_gt_small, apply_table_coll(0, collect_table_vals, table_ice, table_rain, qi_gt_small));
-        table_val_qr2qi_collect.set(qr_gt_small, apply_table_coll(1, collect_table_vals, table_ice, table_rain, qi_gt_small));
+        Spack coll_vals[P3C::collect_table_size];
+        apply_table_coll(collect_table_vals, table_ice, table_rain, coll_vals, qi_gt_small);
+        table_val_nr_collect.set(qr_gt_small, coll_vals[0]);
+        table_val_qr2qi_collect.set(qr_gt_small, coll_vals[1]);
 
         // adjust Ni if needed to make sure mean size is in bounds (i.e. apply lambda limiters)
         // note that the Nmax and Nmin are normalized and thus need to be multiplied by existing N
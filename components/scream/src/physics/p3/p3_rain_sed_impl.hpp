@@ -55,7 +55,8 @@ void Functions<S,D>
   const uview_1d<Spack>& precip_liq_flux,
   const uview_1d<Spack>& qr_tend,
   const uview_1d<Spack>& nr_tend,
-  Scalar& precip_liq_surf)
+  Scalar& precip_liq_surf,
+  const bool& do_implicit_sed)
 {
   // Get temporary workspaces needed for the ice-sed calculation
   uview_1d<Spack> V_qr, V_nr, flux_qx, flux_nx;
@@ -89,21 +90,8 @@ void Functions<S,D>
       Int kmin_scalar = ( kdir == 1 ? k_qxbot : k_qxtop);
       Int kmax_scalar = ( kdir == 1 ? k_qxtop : k_qxbot);
 
-      Kokkos::parallel_for(
-       Kokkos::TeamThreadRange(team, V_qr.extent(0)), [&] (Int k) {
-        V_qr(k) = 0;
-        V_nr(k) = 0;
-      });
-      team.team_barrier();
-
-      // Convert top/bot to pack indices
-      ekat::impl::set_min_max(k_qxbot, k_qxtop, kmin, kmax, Spack::n);
-
       // compute Vq, Vn (get values from lookup table)
-      Kokkos::parallel_reduce(
-       Kokkos::TeamThreadRange(team, kmax-kmin+1), [&] (int pk_, Scalar& lmax) {
-
-        const int pk = kmin + pk_;
+      const auto compute_V = [&] (const int pk) {
         const auto range_pack = ekat::range<IntSmallPack>(pk*Spack::n);
         const auto range_mask = range_pack >= kmin_scalar && range_pack <= kmax_scalar;
         const auto qr_gt_small = range_mask && qr_incld(pk) > qsmall;
@@ -119,13 +107,47 @@ void Functions<S,D>
 	  nr(pk).set(qr_gt_small, nr_incld(pk)*cld_frac_r(pk));
 
         }
-        const auto Co_max_local = max(qr_gt_small, 0,
-                                      V_qr(pk) * dt_left * inv_dz(pk));
-        if (Co_max_local > lmax) lmax = Co_max_local;
-      }, Kokkos::Max<Scalar>(Co_max));
+        return qr_gt_small;
+      };
+
+      if (do_implicit_sed) {
+        // The implicit step does not need Co_max, so zero and compute the
+        // fall speeds in one pass, and skip the reduction
+        Kokkos::parallel_for(
+         Kokkos::TeamThreadRange(team, V_qr.extent(0)), [&] (int pk) {
+          V_qr(pk) = 0;
+          V_nr(pk) = 0;
+          compute_V(pk);
+        });
+      }
+      else {
+        Kokkos::parallel_for(
+         Kokkos::TeamThreadRange(team, V_qr.extent(0)), [&] (Int k) {
+          V_qr(k) = 0;
+          V_nr(k) = 0;
+        });
+        team.team_barrier();
+
+        // Convert top/bot to pack indices
+        ekat::impl::set_min_max(k_qxbot, k_qxtop, kmin, kmax, Spack::n);
+
+        Kokkos::parallel_reduce(
+         Kokkos::TeamThreadRange(team, kmax-kmin+1), [&] (int pk_, Scalar& lmax) {
+          const int pk = kmin + pk_;
+          const auto qr_gt_small = compute_V(pk);
+          const auto Co_max_local = max(qr_gt_small, 0,
+                                        V_qr(pk) * dt_left * inv_dz(pk));
+          if (Co_max_local > lmax) lmax = Co_max_local;
+        }, Kokkos::Max<Scalar>(Co_max));
+      }
       team.team_barrier();
 
-      generalized_sedimentation<2>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, Co_max, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+      if (do_implicit_sed) {
+        implicit_sedimentation<2>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+      }
+      else {
+        generalized_sedimentation<2>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, Co_max, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+      }
 
       //Update _incld values with end-of-step cell-ave values
       //No prob w/ div by cld_frac_r because set to min of 1e-4 in interface.
@@ -9,6 +9,15 @@ namespace p3 {
  * default device.
  */
 
+#define ETI_APPLY_TABLE_ICE(N)                                          \
+  template void Functions<Real,DefaultDevice>                           \
+  ::apply_table_ice<N>(                                                 \
+    const int (&idx)[N], const view_ice_table& ice_table_vals,          \
+    const TableIce& tab, Spack (&proc)[N], const Smask& context);
+ETI_APPLY_TABLE_ICE(4)
+ETI_APPLY_TABLE_ICE(7)
+#undef ETI_APPLY_TABLE_ICE
+
 template struct Functions<Real,DefaultDevice>;
 
 } // namespace p3
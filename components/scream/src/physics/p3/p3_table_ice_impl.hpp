@@ -216,6 +216,71 @@ typename Functions<S,D>::Spack Functions<S,D>
   return proc;
 }
 
+template <typename S, typename D>
+template <int N>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::apply_table_ice(const int (&idx)[N], const view_ice_table& ice_table_vals, const TableIce& tab,
+                  Spack (&proc)[N], const Smask& context)
+{
+  if (!context.any()) return;
+
+  // The ice_table_size quantities of a table cell are stored contiguously, so
+  // each of the 8 cells bracketing (dumjj, dumii, dumi) is located once per
+  // lane, and every quantity is then read at a fixed offset from it. The
+  // interpolation weights are likewise computed once for all quantities.
+  const Scalar* c000[Spack::n];
+  const Scalar* c001[Spack::n];
+  const Scalar* c010[Spack::n];
+  const Scalar* c011[Spack::n];
+  const Scalar* c100[Spack::n];
+  const Scalar* c101[Spack::n];
+  const Scalar* c110[Spack::n];
+  const Scalar* c111[Spack::n];
+  vector_simd for (int s = 0; s < Spack::n; ++s) {
+    const int jj = tab.dumjj[s], ii = tab.dumii[s], i = tab.dumi[s];
+    c000[s] = &ice_table_vals(jj,   ii,   i,   0);
+    c001[s] = &ice_table_vals(jj,   ii,   i+1, 0);
+    c010[s] = &ice_table_vals(jj,   ii+1, i,   0);
+    c011[s] = &ice_table_vals(jj,   ii+1, i+1, 0);
+    c100[s] = &ice_table_vals(jj+1, ii,   i,   0);
+    c101[s] = &ice_table_vals(jj+1, ii,   i+1, 0);
+    c110[s] = &ice_table_vals(jj+1, ii+1, i,   0);
+    c111[s] = &ice_table_vals(jj+1, ii+1, i+1, 0);
+  }
+
+  const auto w1 = tab.dum1 - Spack(tab.dumi)  - 1;
+  const auto w4 = tab.dum4 - Spack(tab.dumii) - 1;
+  const auto w5 = tab.dum5 - Spack(tab.dumjj) - 1;
+
+  for (int n = 0; n < N; ++n) {
+    const int q = idx[n];
+    Spack v000, v001, v010, v011, v100, v101, v110, v111;
+    vector_simd for (int s = 0; s < Spack::n; ++s) {
+      v000[s] = c000[s][q];
+      v001[s] = c001[s][q];
+      v010[s] = c010[s][q];
+      v011[s] = c011[s][q];
+      v100[s] = c100[s][q];
+      v101[s] = c101[s][q];
+      v110[s] = c110[s][q];
+      v111[s] = c111[s][q];
+    }
+
+    // Same sequence of operations as the single-quantity version, so results
+    // are BFB with it.
+    auto iproc1 = v000 + w1 * (v001 - v000);
+    auto gproc1 = v010 + w1 * (v011 - v010);
+    const auto tmp1 = iproc1 + w4 * (gproc1 - iproc1);
+
+    iproc1 = v100 + w1 * (v101 - v100);
+    gproc1 = v110 + w1 * (v111 - v110);
+    const auto tmp2 = iproc1 + w4 * (gproc1 - iproc1);
+
+    proc[n] = tmp1 + w5 * (tmp2 - tmp1);
+  }
+}
+
 template <typename S, typename D>
 KOKKOS_FUNCTION
 typename Functions<S,D>::Spack Functions<S,D>
@@ -296,6 +361,62 @@ typename Functions<S,D>::Spack Functions<S,D>
   return proc;
 }
 
+
+template <typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::apply_table_coll(const view_collect_table& collect_table_vals,
+                   const TableIce& ti, const TableRain& tr,
+                   Spack (&proc)[P3C::collect_table_size],
+                   const Smask& context)
+{
+  if (!context.any()) return;
+
+  // See apply_table_ice above: locate the 16 bracketing cells once per lane
+  // and interpolate all collection quantities from them.
+  constexpr int ncorner = 16;
+  const Scalar* c[ncorner][Spack::n];
+  vector_simd for (int s = 0; s < Spack::n; ++s) {
+    const int jj = ti.dumjj[s], ii = ti.dumii[s], i = ti.dumi[s], j = tr.dumj[s];
+    for (int corner = 0; corner < ncorner; ++corner) {
+      c[corner][s] = &collect_table_vals(jj + ((corner >> 3) & 1),
+                                         ii + ((corner >> 2) & 1),
+                                         i  + ((corner >> 1) & 1),
+                                         j  +  (corner       & 1), 0);
+    }
+  }
+
+  const auto w1 = ti.dum1 - Spack(ti.dumi)  - 1;
+  const auto w3 = tr.dum3 - Spack(tr.dumj)  - 1;
+  const auto w4 = ti.dum4 - Spack(ti.dumii) - 1;
+  const auto w5 = ti.dum5 - Spack(ti.dumjj) - 1;
+
+  for (int q = 0; q < P3C::collect_table_size; ++q) {
+    // v[corner] with corner = (djj, dii, di, dj) in binary
+    Spack v[ncorner];
+    for (int corner = 0; corner < ncorner; ++corner) {
+      vector_simd for (int s = 0; s < Spack::n; ++s) {
+        v[corner][s] = c[corner][s][q];
+      }
+    }
+
+    Spack tmp[2];
+    for (int djj = 0; djj < 2; ++djj) {
+      Spack rproc[2];
+      for (int dii = 0; dii < 2; ++dii) {
+        const int o = 8*djj + 4*dii;
+        const auto dproc1 = v[o]   + w1 * (v[o+2] - v[o]);
+        const auto dproc2 = v[o+1] + w1 * (v[o+3] - v[o+1]);
+        rproc[dii] = dproc1 + w3 * (dproc2 - dproc1);
+      }
+      tmp[djj] = rproc[0] + w4 * (rproc[1] - rproc[0]);
+    }
+
+    // interpolate over density to get final values
+    proc[q] = tmp[0] + w5 * (tmp[1] - tmp[0]);
+  }
+}
+
 } // namespace p3
 } // namespace scream
 
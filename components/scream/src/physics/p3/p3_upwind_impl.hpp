@@ -128,6 +128,63 @@ void Functions<S,D>
   dt_left -= dt_sub;
 }
 
+template <typename S, typename D>
+template <int nfield>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::implicit_sedimentation (
+  const uview_1d<const Spack>& rho,
+  const uview_1d<const Spack>& inv_rho,
+  const uview_1d<const Spack>& inv_dz,
+  const MemberType& team,
+  const Int& nk, const Int& k_qxtop, Int& k_qxbot, const Int& kbot, const Int& kdir, Scalar& dt_left, Scalar& prt_accum,
+  const view_1d_ptr_array<Spack, nfield>& fluxes,
+  const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
+  const view_1d_ptr_array<Spack, nfield>& rs)
+{
+  const auto srho     = scalarize(rho);
+  const auto sinv_rho = scalarize(inv_rho);
+  const auto sinv_dz  = scalarize(inv_dz);
+  const Scalar dt     = dt_left;
+
+  // Backward Euler upwind: the flux out of the bottom of a cell uses the end of
+  // step mixing ratio of that cell, so
+  //   r_new(k) * (1 + dt*V(k)/dz(k)) = r(k) + dt*flux_in(k)/(rho(k)*dz(k)),
+  // where flux_in(k) is the (new) flux out of the cell above. Sweeping down from
+  // k_qxtop, each cell only needs the flux of the cell above, so the whole step
+  // is one pass over the column, whatever the Courant number. Cells that are
+  // empty at the start of the step have no fall speed; they take the speed of
+  // the hydrometeors falling into them, which can then reach the surface within
+  // the step, as they would with the substepped scheme.
+  Kokkos::single(
+    Kokkos::PerTeam(team), [&] () {
+      for (int f = 0; f < nfield; ++f) {
+        const auto sflux = scalarize(*fluxes[f]);
+        const auto sV    = scalarize(*Vs[f]);
+        const auto sr    = scalarize(*rs[f]);
+        Scalar flux_in = 0;
+        Scalar V_in    = 0;
+        for (Int k = k_qxtop; k != kbot - kdir; k -= kdir) {
+          const Scalar V     = sV(k) > 0 ? sV(k) : V_in;
+          const Scalar dt_dz = dt * sinv_dz(k);
+          sr(k)    = (sr(k) + dt_dz * flux_in * sinv_rho(k)) / (1 + dt_dz * V);
+          sflux(k) = V * sr(k) * srho(k);
+          flux_in  = sflux(k);
+          V_in     = V;
+        }
+      }
+    });
+  team.team_barrier();
+
+  // accumulated precip during time step
+  const auto sflux0 = scalarize(*fluxes[0]);
+  prt_accum += sflux0(kbot) * dt;
+
+  // All the cells below k_qxtop have been updated, and there is no time left
+  k_qxbot = kbot;
+  dt_left = 0;
+}
+
 template <typename S, typename D>
 template <int nfield>
 KOKKOS_FUNCTION
@@ -0,0 +1,197 @@
+#include "share/scream_types.hpp"
+#include "share/scream_session.hpp"
+#include "physics/p3/p3_functions.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+
+namespace {
+
+using namespace scream;
+using namespace scream::p3;
+
+/*
+ * Micro-benchmark for the ice lookup table interpolation. It times the
+ * per-quantity apply_table_ice/apply_table_coll calls used before against the
+ * batched versions that share the table offsets and interpolation weights
+ * across quantities, for the set of 7 quantities p3_main_part2 looks up. The
+ * inputs are random but cover the whole table, so the gathers are scattered
+ * like in a real column.
+ */
+
+using P3F          = Functions<Real, DefaultDevice>;
+using Spack        = P3F::Spack;
+using Smask        = P3F::Smask;
+using TableIce     = P3F::TableIce;
+using TableRain    = P3F::TableRain;
+using KT           = P3F::KT;
+using RangePolicy  = KT::RangePolicy;
+
+template <typename S>
+using view_1d = P3F::view_1d<S>;
+
+struct Inputs {
+  view_1d<Spack> qi, ni, qm, rhop, qr, nr;
+};
+
+Inputs make_inputs (const Int npack) {
+  Inputs in;
+  in.qi   = view_1d<Spack>("qi",   npack);
+  in.ni   = view_1d<Spack>("ni",   npack);
+  in.qm   = view_1d<Spack>("qm",   npack);
+  in.rhop = view_1d<Spack>("rhop", npack);
+  in.qr   = view_1d<Spack>("qr",   npack);
+  in.nr   = view_1d<Spack>("nr",   npack);
+
+  auto qi   = Kokkos::create_mirror_view(in.qi);
+  auto ni   = Kokkos::create_mirror_view(in.ni);
+  auto qm   = Kokkos::create_mirror_view(in.qm);
+  auto rhop = Kokkos::create_mirror_view(in.rhop);
+  auto qr   = Kokkos::create_mirror_view(in.qr);
+  auto nr   = Kokkos::create_mirror_view(in.nr);
+
+  std::mt19937_64 engine(42);
+  std::uniform_real_distribution<Real> log_q(-10, -3), log_n(2, 7), frac(0, 1), dens(50, 900);
+  for (Int k = 0; k < npack; ++k) {
+    for (Int s = 0; s < Spack::n; ++s) {
+      qi(k)[s]   = std::pow(10, log_q(engine));
+      ni(k)[s]   = std::pow(10, log_n(engine));
+      qm(k)[s]   = frac(engine)*qi(k)[s];
+      rhop(k)[s] = dens(engine);
+      qr(k)[s]   = std::pow(10, log_q(engine));
+      nr(k)[s]   = std::pow(10, log_n(engine));
+    }
+  }
+
+  Kokkos::deep_copy(in.qi,   qi);
+  Kokkos::deep_copy(in.ni,   ni);
+  Kokkos::deep_copy(in.qm,   qm);
+  Kokkos::deep_copy(in.rhop, rhop);
+  Kokkos::deep_copy(in.qr,   qr);
+  Kokkos::deep_copy(in.nr,   nr);
+
+  return in;
+}
+
+template <bool Batched>
+double run (const Inputs& in, const view_1d<Spack>& out, const Int repeat,
+            const P3F::view_ice_table& ice_table_vals,
+            const P3F::view_collect_table& collect_table_vals)
+{
+  const Int npack = in.qi.extent(0);
+  const auto qi = in.qi; const auto ni = in.ni; const auto qm = in.qm;
+  const auto rhop = in.rhop; const auto qr = in.qr; const auto nr = in.nr;
+
+  auto kernel = KOKKOS_LAMBDA (const Int& k) {
+    const Smask context(true);
+    TableIce ti;
+    TableRain tr;
+    P3F::lookup_ice(qi(k), ni(k), qm(k), rhop(k), ti, context);
+    P3F::lookup_rain(qr(k), nr(k), tr, context);
+
+    Spack sum(0);
+    if (Batched) {
+      const int idx[7] = {1, 2, 3, 4, 6, 7, 9};
+      Spack vals[7];
+      P3F::apply_table_ice(idx, ice_table_vals, ti, vals, context);
+      Spack coll[P3F::P3C::collect_table_size];
+      P3F::apply_table_coll(collect_table_vals, ti, tr, coll, context);
+      for (int n = 0; n < 7; ++n) sum += vals[n];
+      sum += coll[0] + coll[1];
+    } else {
+      const int idx[7] = {1, 2, 3, 4, 6, 7, 9};
+      for (int n = 0; n < 7; ++n) sum += P3F::apply_table_ice(idx[n], ice_table_vals, ti, context);
+      sum += P3F::apply_table_coll(0, collect_table_vals, ti, tr, context);
+      sum += P3F::apply_table_coll(1, collect_table_vals, ti, tr, context);
+    }
+    out(k) = sum;
+  };
+
+  // Warm up
+  Kokkos::parallel_for(RangePolicy(0, npack), kernel);
+  Kokkos::fence();
+
+  auto start = std::chrono::steady_clock::now();
+  for (Int r = 0; r < repeat; ++r) {
+    Kokkos::parallel_for(RangePolicy(0, npack), kernel);
+  }
+  Kokkos::fence();
+  auto finish = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double>(finish - start).count();
+}
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  Int npts = 1 << 20;
+  Int repeat = 10;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-h", "--help")) {
+      std::cout <<
+        argv[0] << " [options]\n"
+        "Options:\n"
+        "  -n <npts>     Number of lookup points. Default=1048576.\n"
+        "  -r <repeat>   Number of timed repetitions. Default=10.\n";
+      return 0;
+    }
+    if (ekat::argv_matches(argv[i], "-n", "--npts")) {
+      expect_another_arg(i, argc);
+      ++i;
+      npts = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      ++i;
+      repeat = std::atoi(argv[i]);
+    }
+  }
+
+  int nerr = 0;
+  scream::initialize_scream_session(argc, argv); {
+    const Int npack = (npts + Spack::n - 1) / Spack::n;
+
+    P3F::view_ice_table ice_table_vals;
+    P3F::view_collect_table collect_table_vals;
+    P3F::init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals);
+
+    const auto in = make_inputs(npack);
+    view_1d<Spack> out_single("out_single", npack), out_batched("out_batched", npack);
+
+    const double t_single  = run<false>(in, out_single,  repeat, ice_table_vals, collect_table_vals);
+    const double t_batched = run<true> (in, out_batched, repeat, ice_table_vals, collect_table_vals);
+
+    // The two paths must agree exactly
+    const auto h_single  = Kokkos::create_mirror_view(out_single);
+    const auto h_batched = Kokkos::create_mirror_view(out_batched);
+    Kokkos::deep_copy(h_single, out_single);
+    Kokkos::deep_copy(h_batched, out_batched);
+    for (Int k = 0; k < npack; ++k) {
+      for (Int s = 0; s < Spack::n; ++s) {
+        if (h_single(k)[s] != h_batched(k)[s]) ++nerr;
+      }
+    }
+
+    const double nlookups = static_cast<double>(npack)*Spack::n*repeat;
+    printf("P3 ice table lookups: npts=%d, repeat=%d, small_packn=%d\n",
+           npack*Spack::n, repeat, SCREAM_SMALL_PACK_SIZE);
+    printf("  per-quantity: %1.3e s, %1.3e lookups/s\n", t_single,  nlookups/t_single);
+    printf("  batched:      %1.3e s, %1.3e lookups/s\n", t_batched, nlookups/t_batched);
+    printf("  speedup:      %1.2fx\n", t_single/t_batched);
+    if (nerr) {
+      printf("  ERROR: %d lookups differ between the two paths\n", nerr);
+    }
+  } scream::finalize_scream_session();
+
+  return nerr != 0 ? 1 : 0;
+}
@@ -219,7 +219,7 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
 
     // Run the lookup from a kernel and copy results back to host
     view_2d<Int>  int_results("int results", 5, max_pack_size);
-    view_2d<Real> real_results("real results", 7, max_pack_size);
+    view_2d<Real> real_results("real results", 9, max_pack_size);
     Kokkos::parallel_for(num_test_itrs, KOKKOS_LAMBDA(const Int& i) {
       const Int offset = i * Spack::n;
 
@@ -242,6 +242,13 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
       Spack ice_result = Functions::apply_table_ice(access_table_index-1, ice_table_vals, ti, qiti_gt_small);
       Spack rain_result = Functions::apply_table_coll(access_table_index-1, collect_table_vals, ti, tr, qiti_gt_small);
 
+      // The multi-quantity versions must match the single-quantity ones
+      const int ice_idx[4] = {0, access_table_index-1, 6, 7};
+      Spack ice_results[4];
+      Functions::apply_table_ice(ice_idx, ice_table_vals, ti, ice_results, qiti_gt_small);
+      Spack rain_results[Functions::P3C::collect_table_size];
+      Functions::apply_table_coll(collect_table_vals, ti, tr, rain_results, qiti_gt_small);
+
       for (Int s = 0, vs = offset; s < Spack::n; ++s, ++vs) {
         int_results(0, vs) = ti.dumi[s];
         int_results(1, vs) = ti.dumjj[s];
@@ -260,6 +267,10 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
         real_results(5, vs) = ice_result[s];
 
         real_results(6, vs) = rain_result[s];
+
+        real_results(7, vs) = ice_results[1][s];
+
+        real_results(8, vs) = rain_results[access_table_index-1][s];
       }
     });
 
@@ -292,6 +303,15 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
         REQUIRE(real_results_mirror(6, s) == altcd[s].proc);
       }
     }
+
+    // Batched lookups are BFB with the single-quantity ones regardless of
+    // SCREAM_BFB_TESTING, since they do the same operations.
+    for(int s = 0; s < max_pack_size; ++s) {
+      if (lid[s].qi > qsmall) {
+        REQUIRE(real_results_mirror(7, s) == real_results_mirror(5, s));
+        REQUIRE(real_results_mirror(8, s) == real_results_mirror(6, s));
+      }
+    }
   }
 
   static void run_phys()
@@ -93,7 +93,8 @@ static Int compare (const std::string& label, const Scalar* a,
 }
 
 struct Baseline {
-  Baseline (const Int nsteps, const Real dt, const Int ncol, const Int nlev, const Int repeat, const std::string predict_nc, const std::string prescribed_CCN)
+  Baseline (const Int nsteps, const Real dt, const Int ncol, const Int nlev, const Int repeat, const std::string predict_nc, const std::string prescribed_CCN,
+            const bool implicit_sed)
   {
     //If predict_nc="both", start looping at i_start=0 (false) and end after i_start=1 (true)
     //otherwise, modify start and end to only loop over case of interest. Test that predict_nc
@@ -112,8 +113,8 @@ struct Baseline {
 
     for (int i = i_start; i < i_end; ++i) { // predict_nc is false or true
       for (int j = j_start; j< j_end; ++j) { //prescribed_CCN is false or true
-  //                 initial condit,     repeat, nsteps, ncol, nlev, dt, prescribe or predict nc, prescribe CCN or not
-  params_.push_back({ic::Factory::mixed, repeat, nsteps, ncol, nlev, dt, i>0,                     j>0 });
+  //                 initial condit,     repeat, nsteps, ncol, nlev, dt, prescribe or predict nc, prescribe CCN or not, sedimentation scheme
+  params_.push_back({ic::Factory::mixed, repeat, nsteps, ncol, nlev, dt, i>0,                     j>0,                  implicit_sed });
       }
     }
   }
@@ -136,7 +137,8 @@ struct Baseline {
           std::cout << "Running P3 with ni=" << d->ncol << ", nk=" << d->nlev
                     << ", dt=" << d->dt << ", ts=" << d->it
                     << ", predict_nc=" << d->do_predict_nc
-                    << ", prescribed_CCN=" << d->do_prescribed_CCN;
+                    << ", prescribed_CCN=" << d->do_prescribed_CCN
+                    << ", implicit_sed=" << d->do_implicit_sed;
 
           if (!use_fortran) {
             std::cout << ", small_packn=" << SCREAM_SMALL_PACK_SIZE;
@@ -202,7 +204,7 @@ private:
     ic::Factory::IC ic;
     Int repeat, nsteps, ncol, nlev;
     Real dt;
-    bool do_predict_nc, do_prescribed_CCN;
+    bool do_predict_nc, do_prescribed_CCN, do_implicit_sed;
   };
 
   static void set_params (const ParamSet& ps, FortranData& d) {
@@ -211,6 +213,7 @@ private:
     d.it                = ps.nsteps;
     d.do_predict_nc     = ps.do_predict_nc;
     d.do_prescribed_CCN = ps.do_prescribed_CCN;
+    d.do_implicit_sed   = ps.do_implicit_sed;
   }
 
   std::vector<ParamSet> params_;
@@ -267,7 +270,9 @@ int main (int argc, char** argv) {
       "  -k <nlev>           Number of vertical levels. Default=72.\n"
       "  -r <repeat>         Number of repetitions, implies timing run (generate + no I/O). Default=0.\n"
       "  -p <predict_nc>     yes|no|both. Default=both.\n"
-      "  -c <prescribed_ccn> yes|no|both. Default=both.\n";
+      "  -c <prescribed_ccn> yes|no|both. Default=both.\n"
+      "  -m <sedimentation>  substep|implicit. Default=substep. To validate the implicit\n"
+      "                      scheme, compare it against a substep baseline with -t <tol>.\n";
     return 1;
   }
 
@@ -281,6 +286,7 @@ int main (int argc, char** argv) {
   std::string device;
   std::string predict_nc = "both";
   std::string prescribed_ccn = "both";
+  std::string sedimentation = "substep";
   std::string baseline_fn;
   for (int i = 1; i < argc-1; ++i) {
     if (ekat::argv_matches(argv[i], "-g", "--generate")) generate = true;
@@ -342,6 +348,13 @@ int main (int argc, char** argv) {
       EKAT_REQUIRE_MSG(prescribed_ccn == "yes" || prescribed_ccn == "no" || prescribed_ccn == "both",
                        "Prescribed CCN option value must be one of yes|no|both");
     }
+    if (ekat::argv_matches(argv[i], "-m", "--sedimentation")) {
+      expect_another_arg(i, argc);
+      ++i;
+      sedimentation = std::string(argv[i]);
+      EKAT_REQUIRE_MSG(sedimentation == "substep" || sedimentation == "implicit",
+                       "Sedimentation option value must be one of substep|implicit");
+    }
   }
 
   // Decorate baseline name with precision.
@@ -373,7 +386,8 @@ int main (int argc, char** argv) {
   }
 
   scream::initialize_scream_session(args.size(), args.data()); {
-    Baseline bln(timesteps, static_cast<Real>(dt), ncol, nlev, repeat, predict_nc, prescribed_ccn);
+    Baseline bln(timesteps, static_cast<Real>(dt), ncol, nlev, repeat, predict_nc, prescribed_ccn,
+                 sedimentation == "implicit");
     if (generate) {
       std::cout << "Generating to " << baseline_fn << "\n";
       nerr += bln.generate_baseline(baseline_fn, use_fortran);
@@ -350,6 +350,127 @@ static void run_bfb()
 
 };
 
+template <typename D>
+struct UnitWrap::UnitTest<D>::TestImplicitSed {
+
+// One implicit sedimentation step over dt must conserve mass, counting the
+// material that leaves the column at the bottom, and keep the mixing ratios
+// non-negative, including for Courant numbers far beyond the explicit stability
+// limit. The hydrometeors are initially in the upper half of the column only,
+// with zero fall speed below, as in P3, so the test also checks that they reach
+// the surface within the step.
+static void run_phys()
+{
+  using ekat::repack;
+  constexpr auto SPS = SCREAM_SMALL_PACK_SIZE;
+
+  static const Int nfield = 2;
+
+  const auto eps = std::numeric_limits<Scalar>::epsilon();
+
+  Int nerr = 0;
+  for (Int nk : {17, 32, 77, 128}) {
+    const Int npack = (nk + Pack::n - 1) / Pack::n;
+    const Real max_speed = 4.2, min_dz = 0.33;
+
+    view_1d<Pack> rho("rho", npack), inv_rho("inv_rho", npack), inv_dz("inv_dz", npack);
+    const auto lrho = repack<SPS>(rho), linv_rho = repack<SPS>(inv_rho), linv_dz = repack<SPS>(inv_dz);
+
+    Kokkos::Array<view_1d<Pack>, nfield> flux, V, r;
+    Kokkos::Array<uview_1d<Spack>, nfield> lflux, lV, lr;
+    for (int i = 0; i < nfield; ++i) {
+      flux[i] = view_1d<Pack>("flux", npack);
+      V[i]    = view_1d<Pack>("V", npack);
+      r[i]    = view_1d<Pack>("r", npack);
+      lflux[i] = repack<SPS>(flux[i]);
+      lV[i]    = repack<SPS>(V[i]);
+      lr[i]    = repack<SPS>(r[i]);
+    }
+
+    for (Real courant : {0.5, 5.0, 50.0}) {
+      const Real dt = courant*min_dz/max_speed;
+
+      for (Int kdir : {-1, 1}) {
+        const Int kbot = kdir == 1 ? 0 : nk-1;
+        const Int ktop = kdir == 1 ? nk-1 : 0;
+        const Int k_qxtop = ktop - 2*kdir;
+
+        const auto init_fields = KOKKOS_LAMBDA (const MemberType& team) {
+          Kokkos::parallel_for(Kokkos::TeamThreadRange(team, npack), [&] (const Int& k) {
+            const auto range = ekat::range<Pack>(k*Pack::n);
+            rho(k) = 1 + range/nk;
+            inv_rho(k) = 1 / rho(k);
+            inv_dz(k) = 1 / (min_dz + range*range / (nk*nk));
+            const auto upper = kdir == 1 ? range >= nk/2 : range < nk/2;
+            const auto mask = upper && range >= 2 && range < nk-2;
+            for (Int i = 0; i < nfield; ++i) {
+              r[i](k) = 0;
+              V[i](k) = 0;
+              r[i](k).set(mask, Scalar(i+1)*range/nk);
+              V[i](k).set(mask, (0.5 + 0.5*i)*(1 + range/nk) * max_speed/2);
+            }
+          });
+        };
+        Kokkos::parallel_for(ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, npack),
+                             init_fields);
+
+        const auto step = KOKKOS_LAMBDA (const MemberType& team, Int& nerr) {
+          const auto srho = scalarize(rho), sinv_dz = scalarize(inv_dz);
+
+          Scalar mass0[nfield], mass1[nfield];
+          for (Int i = 0; i < nfield; ++i) {
+            const auto sr = scalarize(r[i]);
+            Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, nk), [&] (const Int& k, Scalar& mass) {
+              mass += srho(k)*sr(k)/sinv_dz(k);
+            }, mass0[i]);
+          }
+          team.team_barrier();
+
+          Int k_qxbot = k_qxtop;
+          Scalar dt_left = dt, prt_accum = 0;
+          Functions::template implicit_sedimentation<nfield>(
+            lrho, linv_rho, linv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, dt_left, prt_accum,
+            {&lflux[0], &lflux[1]}, {&lV[0], &lV[1]}, {&lr[0], &lr[1]});
+          team.team_barrier();
+
+          Scalar r_min = 0;
+          for (Int i = 0; i < nfield; ++i) {
+            const auto sr = scalarize(r[i]);
+            Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, nk), [&] (const Int& k, Scalar& mass) {
+              mass += srho(k)*sr(k)/sinv_dz(k);
+            }, mass1[i]);
+            Scalar lmin;
+            Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, nk), [&] (const Int& k, Scalar& lmin) {
+              lmin = ekat::impl::min(sr(k), lmin);
+            }, Kokkos::Min<Scalar>(lmin));
+            r_min = ekat::impl::min(r_min, lmin);
+          }
+          // Include mass flowing out of the boundary.
+          mass1[0] += prt_accum;
+          mass1[1] += scalarize(flux[1])(kbot)*dt;
+
+          //   1. Check for conservation of mass.
+          for (Int i = 0; i < nfield; ++i) {
+            if (ekat::impl::rel_diff(mass0[i], mass1[i]) > 1e3*eps) ++nerr;
+          }
+          //   2. Check for non-negativity.
+          if (r_min < 0) ++nerr;
+          //   3. Check that the whole step is done, and that there is surface precip.
+          if (dt_left != 0 || k_qxbot != kbot || !(prt_accum > 0)) ++nerr;
+        };
+        Int lnerr;
+        Kokkos::parallel_reduce(ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, npack),
+                                step, lnerr);
+        nerr += lnerr;
+        Kokkos::fence();
+        REQUIRE(nerr == 0);
+      }
+    }
+  }
+}
+
+};
+
 }
 }
 }
@@ -372,4 +493,11 @@ TEST_CASE("p3_gen_sed", "[p3_functions]")
   TG::run_bfb();
 }
 
+TEST_CASE("p3_implicit_sed", "[p3_functions]")
+{
+  using TI = scream::p3::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestImplicitSed;
+
+  TI::run_phys();
+}
+
 } // namespace
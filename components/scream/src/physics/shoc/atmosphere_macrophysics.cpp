@@ -13,6 +13,15 @@ SHOCMacrophysics::SHOCMacrophysics (const ekat::Comm& comm,const ekat::Parameter
   /* Anything that can be initialized without grid information can be initialized here.
    * Like universal constants, shoc options.
    */
+
+  // If true, the max number of levels in the pbl is computed for each column
+  // from the current pressure, rather than from pref_mid. Not BFB with the
+  // reference implementation, hence off by default.
+  m_column_npbl = m_params.get<bool>("Column Dependent PBL Depth",false);
+
+  // If true, the tracers are diffused after the main SHOC kernel, in a
+  // separate kernel batched across columns and tracers. BFB with the default.
+  m_separate_tracer_diffusion = m_params.get<bool>("Separate Tracer Diffusion",false);
 }
 
 // =========================================================================================
@@ -131,8 +140,7 @@ int SHOCMacrophysics::requested_buffer_size_in_bytes() const
   // Number of Reals needed by the WorkspaceManager passed to shoc_main
   const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
   const int n_wind_slots  = ekat::npack<Spack>(2)*Spack::n;
-  const int n_trac_slots  = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
-  const int wsm_request   = WSM::get_total_bytes_needed(nlevi_packs, 13+(n_wind_slots+n_trac_slots), policy);
+  const int wsm_request   = WSM::get_total_bytes_needed(nlevi_packs, 13+n_wind_slots, policy);
 
   return interface_request + wsm_request;
 }
@@ -231,8 +239,7 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
   // vs. requested memory
   const auto policy      = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
-  const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
-  const int wsm_size     = WSM::get_total_bytes_needed(nlevi_packs, 13+(n_wind_slots+n_trac_slots), policy)/sizeof(Spack);
+  const int wsm_size     = WSM::get_total_bytes_needed(nlevi_packs, 13+n_wind_slots, policy)/sizeof(Spack);
   s_mem += wsm_size;
 
   int used_mem = (reinterpret_cast<Real*>(s_mem) - buffer_manager.get_memory())*sizeof(Real);
@@ -372,11 +379,18 @@ void SHOCMacrophysics::run_impl (const int dt)
   Kokkos::fence();
 
 
-  // Calculate maximum number of levels in pbl from surface
-  const auto pref_mid = get_field_in("pref_mid").get_view<const Spack*>();
-  const int ntop_shoc = 0;
-  const int nbot_shoc = m_num_levs;
-  m_npbl = SHF::shoc_init(nbot_shoc,ntop_shoc,pref_mid);
+  // Calculate maximum number of levels in pbl from surface. pref_mid does not
+  // change during the run, so only recompute it (and pay for the copy to host)
+  // if the field was updated since the last time we did.
+  const auto& pref_mid_f  = get_field_in("pref_mid");
+  const auto& pref_mid_ts = pref_mid_f.get_header().get_tracking().get_time_stamp();
+  if (not (pref_mid_ts==m_pref_mid_ts)) {
+    const auto pref_mid = pref_mid_f.get_view<const Spack*>();
+    const int ntop_shoc = 0;
+    const int nbot_shoc = m_num_levs;
+    m_npbl = SHF::shoc_init(nbot_shoc,ntop_shoc,pref_mid);
+    m_pref_mid_ts = pref_mid_ts;
+  }
 
   // For now set the host timestep to the shoc timestep. This forces
   // number of SHOC timesteps (nadv) to be 1.
@@ -386,12 +400,23 @@ void SHOCMacrophysics::run_impl (const int dt)
 
   // WorkspaceManager for internal local variables
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
-  const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
-  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(m_buffer.wsm_data, nlevi_packs, 13+(n_wind_slots+n_trac_slots), default_policy);
+  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(m_buffer.wsm_data, nlevi_packs, 13+n_wind_slots, default_policy);
+
+  // Storage for the separate tracer diffusion, which depends on m_nadv
+  if (m_separate_tracer_diffusion &&
+      m_tracer_diffusion.d.extent_int(1)!=m_nadv) {
+    using view_3d = SHF::view_3d<Real>;
+    using view_2d = SHF::view_2d<Real>;
+    m_tracer_diffusion.du       = view_3d("shoc tracer du",m_num_cols,m_nadv,m_num_levs);
+    m_tracer_diffusion.dl       = view_3d("shoc tracer dl",m_num_cols,m_nadv,m_num_levs);
+    m_tracer_diffusion.d        = view_3d("shoc tracer d", m_num_cols,m_nadv,m_num_levs);
+    m_tracer_diffusion.sfc_coef = view_2d("shoc tracer sfc coef",m_num_cols,m_nadv);
+  }
 
   // Run shoc main
   SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
-                 workspace_mgr,input,input_output,output,history_output);
+                 workspace_mgr,input,input_output,output,history_output,m_column_npbl,
+                 m_tracer_diffusion);
 
   // Postprocessing of SHOC outputs
   Kokkos::parallel_for("shoc_postprocess",
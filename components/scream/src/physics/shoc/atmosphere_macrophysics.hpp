@@ -423,12 +423,17 @@ protected:
   Int m_num_cols;
   Int m_num_levs;
   Int m_npbl;
+  bool m_column_npbl;
+  bool m_separate_tracer_diffusion;
   Int m_nadv;
   Int m_num_tracers;
   Int hdtime;
 
   KokkosTypes<DefaultDevice>::view_1d<Real> m_cell_area;
 
+  // Time stamp of pref_mid when m_npbl was last computed
+  util::TimeStamp m_pref_mid_ts;
+
   // Struct which contains local variables
   Buffer m_buffer;
 
@@ -437,6 +442,7 @@ protected:
   SHF::SHOCInputOutput input_output;
   SHF::SHOCOutput output;
   SHF::SHOCHistoryOutput history_output;
+  SHF::SHOCTracerDiffusion m_tracer_diffusion;
 
   // Structures which compute pre/post process
   SHOCPreprocess shoc_preprocess;
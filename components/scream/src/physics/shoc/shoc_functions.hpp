@@ -179,6 +179,23 @@ struct Functions
     view_2d<Spack>  isotropy;
   };
 
+  // This struct stores, for each column and SHOC substep, what is needed to
+  // diffuse the tracers after the main SHOC kernel. If its views are allocated,
+  // shoc_main runs the tracer diffusion in a separate kernel, batched across
+  // columns and tracers (see shoc_diffuse_tracers).
+  struct SHOCTracerDiffusion {
+    SHOCTracerDiffusion() = default;
+
+    // Factored diffusion matrix (see vd_shoc_factor), of size (shcol, nadv, nlev)
+    view_3d<Scalar> du;
+    view_3d<Scalar> dl;
+    view_3d<Scalar> d;
+    // Coefficient of the tracer surface fluxes, of size (shcol, nadv)
+    view_2d<Scalar> sfc_coef;
+
+    bool enabled () const { return d.size() > 0; }
+  };
+
   //
   // --------- Functions ---------
   //
@@ -444,7 +461,14 @@ struct Functions
     const uview_2d<Spack>&       tracer,
     const uview_1d<Spack>&       tke,
     const uview_1d<Spack>&       u_wind,
-    const uview_1d<Spack>&       v_wind);
+    const uview_1d<Spack>&       v_wind,
+    // If these views are not empty, the tracers are not diffused here. Instead,
+    // the factored tracer diffusion matrix (size nlev) and the surface flux
+    // coefficient (size 1) are stored, for use by shoc_diffuse_tracers.
+    const uview_1d<Scalar>&      tracer_du       = uview_1d<Scalar>(),
+    const uview_1d<Scalar>&      tracer_dl       = uview_1d<Scalar>(),
+    const uview_1d<Scalar>&      tracer_d        = uview_1d<Scalar>(),
+    const uview_1d<Scalar>&      tracer_sfc_coef = uview_1d<Scalar>());
 
   KOKKOS_FUNCTION
   static void diag_third_shoc_moments(
@@ -553,6 +577,16 @@ struct Functions
     const Int&                  ntop_shoc,
     const view_1d<const Spack>& pref_mid);
 
+  // Number of levels from surface whose pressure is larger than
+  // pblmaxp, for a single column. Used by shoc_init (with the reference
+  // pressure), and by shoc_main when the pbl depth is column dependent.
+  KOKKOS_FUNCTION
+  static Int shoc_column_npbl(
+    const MemberType&            team,
+    const Int&                   nbot_shoc,
+    const Int&                   ntop_shoc,
+    const uview_1d<const Spack>& pres);
+
   KOKKOS_FUNCTION
   static void shoc_main_internal(
     const MemberType&            team,
@@ -610,7 +644,24 @@ struct Functions
     const uview_1d<Spack>&       w3,
     const uview_1d<Spack>&       wqls_sec,
     const uview_1d<Spack>&       brunt,
-    const uview_1d<Spack>&       isotropy);
+    const uview_1d<Spack>&       isotropy,
+    // Tracer diffusion data of this column (empty if the tracers
+    // are diffused in this kernel)
+    const uview_2d<Scalar>&      tracer_du,
+    const uview_2d<Scalar>&      tracer_dl,
+    const uview_2d<Scalar>&      tracer_d,
+    const uview_1d<Scalar>&      tracer_sfc_coef);
+
+  // Diffuse the tracers using the data stored by shoc_main_internal, with
+  // one thread per column and tracer.
+  static void shoc_diffuse_tracers(
+    const Int&                  shcol,
+    const Int&                  nlev,
+    const Int&                  nadv,
+    const Int&                  num_qtracers,
+    const SHOCTracerDiffusion&  tracer_diffusion,
+    const view_2d<const Spack>& wtracer_sfc,
+    const view_3d<Spack>&       qtracers);
 
   // Return microseconds elapsed
   static Int shoc_main(
@@ -625,7 +676,9 @@ struct Functions
     const SHOCInput&         shoc_input,           // Input
     const SHOCInputOutput&   shoc_input_output,    // Input/Output
     const SHOCOutput&        shoc_output,          // Output
-    const SHOCHistoryOutput& shoc_history_output); // Output (diagnostic)
+    const SHOCHistoryOutput& shoc_history_output,  // Output (diagnostic)
+    const bool&              column_npbl = false,  // If true, npbl is recomputed for each column from pres
+    const SHOCTracerDiffusion& tracer_diffusion = SHOCTracerDiffusion()); // If enabled, tracers are diffused in a separate kernel
 
   KOKKOS_FUNCTION
   static void pblintd_height(
@@ -663,6 +716,27 @@ struct Functions
     const uview_1d<Scalar>& d,
     const uview_2d<Spack>&  var);
 
+  // LU factorization, in place, of the tridiagonal matrix computed by
+  // vd_shoc_decomp. The factored matrix can then be used to solve for any
+  // number of rhs with vd_shoc_solve_factored. Same operations as the
+  // Fortran vd_shoc_decomp, hence BFB with it.
+  KOKKOS_FUNCTION
+  static void vd_shoc_factor(
+    const MemberType&       team,
+    const uview_1d<Scalar>& du,
+    const uview_1d<Scalar>& dl,
+    const uview_1d<Scalar>& d);
+
+  // Solve, in place, for a single rhs var (of length nlev) using the matrix
+  // factored by vd_shoc_factor. This is serial in var, so callers should
+  // parallelize over the rhs's.
+  KOKKOS_FUNCTION
+  static void vd_shoc_solve_factored(
+    const uview_1d<const Scalar>& du,
+    const uview_1d<const Scalar>& dl,
+    const uview_1d<const Scalar>& d,
+    const uview_1d<Scalar>&       var);
+
   KOKKOS_FUNCTION
   static void pblintd_surf_temp(const Int& nlev, const Int& nlevi, const Int& npbl,
       const uview_1d<const Spack>& z, const Scalar& ustar,
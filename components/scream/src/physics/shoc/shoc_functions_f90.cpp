@@ -2176,8 +2176,7 @@ void update_prognostics_implicit_f(Int shcol, Int nlev, Int nlevi, Int num_trace
 
   // Local variable workspace
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
-  const int n_trac_slots = ekat::npack<Spack>(num_tracer+3)*Spack::n;
-  const int tmp_var_size = 8+n_wind_slots+n_trac_slots;
+  const int tmp_var_size = 8+n_wind_slots;
   ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, tmp_var_size, policy);
 
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
@@ -2702,7 +2701,7 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
                 Real* thetal, Real* qw, Real* u_wind, Real* v_wind, Real* qtracers, Real* wthv_sec, Real* tkh, Real* tk,
                 Real* shoc_ql, Real* shoc_cldfrac, Real* pblh, Real* shoc_mix, Real* isotropy, Real* w_sec, Real* thl_sec,
                 Real* qw_sec, Real* qwthl_sec, Real* wthl_sec, Real* wqw_sec, Real* wtke_sec, Real* uw_sec, Real* vw_sec,
-                Real* w3, Real* wqls_sec, Real* brunt, Real* shoc_ql2)
+                Real* w3, Real* wqls_sec, Real* brunt, Real* shoc_ql2, bool separate_tracer_diffusion)
 {
   // tkh is a local variable in C++ impl
   (void)tkh;
@@ -2849,12 +2848,21 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
   // Create local workspace
   const auto nlevi_packs = ekat::npack<Spack>(nlevi);
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
-  const int n_trac_slots = ekat::npack<Spack>(num_qtracers+3)*Spack::n;
-  ekat::WorkspaceManager<Spack, SHF::KT::Device> workspace_mgr(nlevi_packs, 13+(n_wind_slots+n_trac_slots), policy);
+  ekat::WorkspaceManager<Spack, SHF::KT::Device> workspace_mgr(nlevi_packs, 13+n_wind_slots, policy);
+
+  // If requested, diffuse the tracers in a separate kernel
+  SHF::SHOCTracerDiffusion tracer_diffusion;
+  if (separate_tracer_diffusion) {
+    tracer_diffusion.du       = SHF::view_3d<Scalar>("tracer du",shcol,nadv,nlev);
+    tracer_diffusion.dl       = SHF::view_3d<Scalar>("tracer dl",shcol,nadv,nlev);
+    tracer_diffusion.d        = SHF::view_3d<Scalar>("tracer d", shcol,nadv,nlev);
+    tracer_diffusion.sfc_coef = SHF::view_2d<Scalar>("tracer sfc coef",shcol,nadv);
+  }
 
   const auto elapsed_microsec = SHF::shoc_main(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
                                                workspace_mgr,
-                                               shoc_input, shoc_input_output, shoc_output, shoc_history_output);
+                                               shoc_input, shoc_input_output, shoc_output, shoc_history_output,
+                                               false, tracer_diffusion);
 
   // Copy wind back into separate views and
   // Transpose tracers
@@ -3042,6 +3050,100 @@ void vd_shoc_decomp_and_solve_f(Int shcol, Int nlev, Int nlevi, Int num_rhs, Rea
   ekat::device_to_host({var}, shcol, nlev, num_rhs, inout_views, true);
 }
 
+void vd_shoc_decomp_and_solve_factored_f(Int shcol, Int nlev, Int nlevi, Int num_rhs, Real* kv_term, Real* tmpi, Real* rdp_zt, Real dtime,
+                                         Real* flux, Real* var)
+{
+  using SHF = Functions<Real, DefaultDevice>;
+
+  using Scalar         = typename SHF::Scalar;
+  using Spack          = typename SHF::Spack;
+  using view_1d        = typename SHF::view_1d<Scalar>;
+  using view_2d        = typename SHF::view_2d<Spack>;
+  using view_2d_scalar = typename SHF::view_2d<Scalar>;
+  using view_3d        = typename SHF::view_3d<Spack>;
+  using view_3d_scalar = typename SHF::view_3d<Scalar>;
+  using uview_1d       = typename SHF::uview_1d<Scalar>;
+  using KT             = typename SHF::KT;
+  using ExeSpace       = typename KT::ExeSpace;
+  using MemberType     = typename SHF::MemberType;
+
+  static constexpr Int num_1d_arrays = 1;
+  static constexpr Int num_2d_arrays = 3;
+  static constexpr Int num_3d_arrays = 1;
+
+  std::vector<view_1d> temp_1d_d(num_1d_arrays);
+  std::vector<view_2d> temp_2d_d(num_2d_arrays);
+  std::vector<view_3d> temp_3d_d(num_3d_arrays);
+
+  std::vector<int> dim1_sizes(num_2d_arrays, shcol);
+  std::vector<int> dim2_sizes = {nlevi, nlevi, nlev};
+  std::vector<const Real*> ptr_array = {kv_term, tmpi, rdp_zt};
+
+  // Sync to device
+  ScreamDeepCopy::copy_to_device({flux}, shcol, temp_1d_d);
+  ekat::host_to_device(ptr_array, dim1_sizes, dim2_sizes, temp_2d_d, true);
+  ekat::host_to_device({var}, shcol, nlev, num_rhs, temp_3d_d, true);
+
+  view_1d
+    flux_d(temp_1d_d[0]);
+
+  view_2d
+    kv_term_d(temp_2d_d[0]),
+    tmpi_d(temp_2d_d[1]),
+    rdp_zt_d(temp_2d_d[2]);
+
+  view_2d_scalar
+    du_d("du", shcol, nlev),
+    dl_d("dl", shcol, nlev),
+    d_d ("d",  shcol, nlev);
+
+  view_3d
+    var_d(temp_3d_d[0]);
+
+  // The factored solver expects levels to be contiguous for each rhs
+  view_3d_scalar rhs_d("rhs", shcol, num_rhs, nlev);
+  const auto var_d_s = ekat::scalarize(var_d);
+
+  const Int nk_pack = ekat::npack<Spack>(nlev);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nk_pack);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const Int i = team.league_rank();
+
+    const Scalar flux_s{flux_d(i)};
+    const auto kv_term_s = ekat::subview(kv_term_d, i);
+    const auto tmpi_s    = ekat::subview(tmpi_d, i);
+    const auto rdp_zt_s  = ekat::subview(rdp_zt_d, i);
+    const auto du_s      = ekat::subview(du_d, i);
+    const auto dl_s      = ekat::subview(dl_d, i);
+    const auto d_s       = ekat::subview(d_d, i);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&] (const Int& k) {
+      for (Int n = 0; n < num_rhs; ++n) {
+        rhs_d(i,n,k) = var_d_s(i,k,n);
+      }
+    });
+
+    SHF::vd_shoc_decomp(team, nlev, kv_term_s, tmpi_s, rdp_zt_s, dtime, flux_s, du_s, dl_s, d_s);
+    team.team_barrier();
+    SHF::vd_shoc_factor(team, du_s, dl_s, d_s);
+    team.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, num_rhs), [&] (const Int& n) {
+      SHF::vd_shoc_solve_factored(du_s, dl_s, d_s, uview_1d(&rhs_d(i,n,0), nlev));
+    });
+    team.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&] (const Int& k) {
+      for (Int n = 0; n < num_rhs; ++n) {
+        var_d_s(i,k,n) = rhs_d(i,n,k);
+      }
+    });
+  });
+
+  // Sync back to host
+  std::vector<view_3d> inout_views = {var_d};
+  ekat::device_to_host({var}, shcol, nlev, num_rhs, inout_views, true);
+}
+
 void shoc_grid_f(Int shcol, Int nlev, Int nlevi, Real* zt_grid, Real* zi_grid, Real* pdel, Real* dz_zt, Real* dz_zi, Real* rho_zt)
 {
   using SHF = Functions<Real, DefaultDevice>;
@@ -15,6 +15,39 @@ namespace shoc {
  * #include this file, but include shoc_functions.hpp instead.
  */
 
+template<typename S, typename D>
+KOKKOS_FUNCTION
+Int Functions<S,D>::shoc_column_npbl(
+  const MemberType&            team,
+  const Int&                   nbot_shoc,
+  const Int&                   ntop_shoc,
+  const uview_1d<const Spack>& pres)
+{
+  const Scalar pblmaxp = SC::pblmaxp;
+
+  Int npbl_val = 1;
+
+  const int begin_pack_indx = ntop_shoc/Spack::n;
+  const int end_pack_indx   = nbot_shoc/Spack::n+1;
+  Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, begin_pack_indx, end_pack_indx),
+                                                  [&] (const Int& k, Int& local_max) {
+    auto range = ekat::range<IntSmallPack>(k*Spack::n);
+    auto condition = (range >= ntop_shoc && range < nbot_shoc);
+    if (condition.any()) {
+      condition = condition && pres(k) >= pblmaxp;
+    }
+
+    auto levels_from_surface = nbot_shoc - range;
+    levels_from_surface.set(!condition, 1);
+
+    if (local_max < ekat::max(levels_from_surface))
+      local_max = ekat::max(levels_from_surface);
+
+  }, Kokkos::Max<Int>(npbl_val));
+
+  return npbl_val;
+}
+
 template<typename S, typename D>
 Int Functions<S,D>::shoc_init(
   const Int&                  nbot_shoc,
@@ -29,30 +62,11 @@ Int Functions<S,D>::shoc_init(
 
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, 1);
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const Int npbl_val = shoc_column_npbl(team, nbot_shoc, ntop_shoc, pref_mid);
 
-    const Scalar pblmaxp = SC::pblmaxp;
-
-    Int npbl_val = 1;
-
-    const int begin_pack_indx = ntop_shoc/Spack::n;
-    const int end_pack_indx   = nbot_shoc/Spack::n+1;
-    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, begin_pack_indx, end_pack_indx),
-                                                    [&] (const Int& k, Int& local_max) {
-      auto range = ekat::range<IntSmallPack>(k*Spack::n);
-      auto condition = (range >= ntop_shoc && range < nbot_shoc);
-      if (condition.any()) {
-        condition = condition && pref_mid(k) >= pblmaxp;
-      }
-
-      auto levels_from_surface = nbot_shoc - range;
-      levels_from_surface.set(!condition, 1);
-
-      if (local_max < ekat::max(levels_from_surface))
-        local_max = ekat::max(levels_from_surface);
-
-    }, Kokkos::Max<Int>(npbl_val));
-
-    npbl_d(0) = npbl_val;
+    Kokkos::single(Kokkos::PerTeam(team), [&] () {
+      npbl_d(0) = npbl_val;
+    });
   });
 
   const auto host_view = Kokkos::create_mirror_view(npbl_d);
@@ -119,7 +133,11 @@ void Functions<S,D>::shoc_main_internal(
   const uview_1d<Spack>&       w3,
   const uview_1d<Spack>&       wqls_sec,
   const uview_1d<Spack>&       brunt,
-  const uview_1d<Spack>&       isotropy)
+  const uview_1d<Spack>&       isotropy,
+  const uview_2d<Scalar>&      tracer_du,
+  const uview_2d<Scalar>&      tracer_dl,
+  const uview_2d<Scalar>&      tracer_d,
+  const uview_1d<Scalar>&      tracer_sfc_coef)
 {
   // Define temporary variables
   uview_1d<Spack> rho_zt, shoc_qv, dz_zt, dz_zi, tkh;
@@ -137,6 +155,13 @@ void Functions<S,D>::shoc_main_internal(
   const auto s_shoc_ql = ekat::scalarize(shoc_ql);
   const auto s_shoc_qv = ekat::scalarize(shoc_qv);
 
+  // If tracers are diffused by shoc_diffuse_tracers, update_prognostics_implicit
+  // stores the data needed for each substep in the t-th row of the tracer views.
+  const bool defer_tracers = tracer_d.size() > 0;
+  const auto tracer_row = [&] (const uview_2d<Scalar>& v, const Int& t) {
+    return defer_tracers ? uview_1d<Scalar>(&v(t,0), nlev) : uview_1d<Scalar>();
+  };
+
   // Compute integrals of static energy, kinetic energy, water vapor, and liquid water
   // for the computation of total energy before SHOC is called.  This is for an
   // effort to conserve energy since liquid water potential temperature (which SHOC
@@ -204,7 +229,13 @@ void Functions<S,D>::shoc_main_internal(
                                 dz_zi,rho_zt,zt_grid,zi_grid,tk,tkh,uw_sfc, // Input
                                 vw_sfc,wthl_sfc,wqw_sfc,wtracer_sfc,        // Input
                                 workspace,                                  // Workspace
-                                thetal,qw,qtracers,tke,u_wind,v_wind);   // Input/Output
+                                thetal,qw,qtracers,tke,u_wind,v_wind,       // Input/Output
+                                tracer_row(tracer_du,t),                    // Output
+                                tracer_row(tracer_dl,t),                    // Output
+                                tracer_row(tracer_d,t),                     // Output
+                                defer_tracers ?                             // Output
+                                  uview_1d<Scalar>(&tracer_sfc_coef(t), 1) :
+                                  uview_1d<Scalar>());
 
     // Diagnose the second order moments
     diag_second_shoc_moments(team,nlev,nlevi,thetal,qw,u_wind,v_wind,   // Input
@@ -286,6 +317,44 @@ void Functions<S,D>::shoc_main_internal(
     {&rho_zt, &shoc_qv, &dz_zt, &dz_zi, &tkh});
 }
 
+template<typename S, typename D>
+void Functions<S,D>::shoc_diffuse_tracers(
+  const Int&                  shcol,
+  const Int&                  nlev,
+  const Int&                  nadv,
+  const Int&                  num_qtracers,
+  const SHOCTracerDiffusion&  tracer_diffusion,
+  const view_2d<const Spack>& wtracer_sfc,
+  const view_3d<Spack>&       qtracers)
+{
+  using ExeSpace = typename KT::ExeSpace;
+
+  const auto du            = tracer_diffusion.du;
+  const auto dl            = tracer_diffusion.dl;
+  const auto d             = tracer_diffusion.d;
+  const auto sfc_coef      = tracer_diffusion.sfc_coef;
+  const auto wtracer_sfc_s = ekat::scalarize(wtracer_sfc);
+  const auto qtracers_s    = ekat::scalarize(qtracers);
+
+  // Each column has its own matrix, and tracers are independent, so
+  // all (column,tracer) pairs are solved concurrently. The substeps
+  // are applied in the same order as in shoc_main_internal.
+  Kokkos::parallel_for("shoc_diffuse_tracers",
+                       Kokkos::RangePolicy<ExeSpace>(0, shcol*num_qtracers),
+                       KOKKOS_LAMBDA(const Int& idx) {
+    const Int i = idx / num_qtracers;
+    const Int q = idx % num_qtracers;
+
+    const uview_1d<Scalar> var(&qtracers_s(i,q,0), nlev);
+    for (Int t=0; t<nadv; ++t) {
+      var(nlev-1) += sfc_coef(i,t)*wtracer_sfc_s(i,q);
+      vd_shoc_solve_factored(uview_1d<const Scalar>(&du(i,t,0), nlev),
+                             uview_1d<const Scalar>(&dl(i,t,0), nlev),
+                             uview_1d<const Scalar>(&d(i,t,0),  nlev),
+                             var);
+    }
+  });
+}
 
 template<typename S, typename D>
 Int Functions<S,D>::shoc_main(
@@ -300,10 +369,20 @@ Int Functions<S,D>::shoc_main(
   const SHOCInput&         shoc_input,          // Input
   const SHOCInputOutput&   shoc_input_output,   // Input/Output
   const SHOCOutput&        shoc_output,         // Output
-  const SHOCHistoryOutput& shoc_history_output) // Output (diagnostic)
+  const SHOCHistoryOutput& shoc_history_output, // Output (diagnostic)
+  const bool&              column_npbl,         // If true, npbl is recomputed for each column from pres
+  const SHOCTracerDiffusion& tracer_diffusion)  // If enabled, tracers are diffused in a separate kernel
 {
   using ExeSpace = typename KT::ExeSpace;
 
+  const bool defer_tracers = tracer_diffusion.enabled();
+  if (defer_tracers) {
+    EKAT_REQUIRE_MSG(tracer_diffusion.d.extent(0)>=static_cast<size_t>(shcol) &&
+                     tracer_diffusion.d.extent(1)>=static_cast<size_t>(nadv) &&
+                     tracer_diffusion.d.extent(2)>=static_cast<size_t>(nlev),
+                     "Error! Tracer diffusion views are too small for shoc_main.\n");
+  }
+
   // Start timer
   auto start = std::chrono::steady_clock::now();
 
@@ -361,7 +440,20 @@ Int Functions<S,D>::shoc_main(
     const auto v_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, i, 1, Kokkos::ALL());
     const auto qtracers_s = Kokkos::subview(shoc_input_output.qtracers, i, Kokkos::ALL(), Kokkos::ALL());
 
-    shoc_main_internal(team, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
+    uview_2d<Scalar> tracer_du_s, tracer_dl_s, tracer_d_s;
+    uview_1d<Scalar> tracer_sfc_coef_s;
+    if (defer_tracers) {
+      tracer_du_s       = Kokkos::subview(tracer_diffusion.du, i, Kokkos::ALL(), Kokkos::ALL());
+      tracer_dl_s       = Kokkos::subview(tracer_diffusion.dl, i, Kokkos::ALL(), Kokkos::ALL());
+      tracer_d_s        = Kokkos::subview(tracer_diffusion.d,  i, Kokkos::ALL(), Kokkos::ALL());
+      tracer_sfc_coef_s = ekat::subview(tracer_diffusion.sfc_coef, i);
+    }
+
+    // If requested, bound the pbl using the pressure of this column,
+    // rather than the bound computed from the reference pressure.
+    const Int npbl_s = column_npbl ? shoc_column_npbl(team, nlev, 0, pres_s) : npbl;
+
+    shoc_main_internal(team, nlev, nlevi, npbl_s, nadv, num_qtracers, dtime,
                        dx_s, dy_s, zt_grid_s, zi_grid_s,                      // Input
                        pres_s, presi_s, pdel_s, thv_s, w_field_s,             // Input
                        wthl_sfc_s, wqw_sfc_s, uw_sfc_s, vw_sfc_s,             // Input
@@ -373,10 +465,16 @@ Int Functions<S,D>::shoc_main(
                        pblh_s, shoc_ql2_s,                                    // Output
                        shoc_mix_s, w_sec_s, thl_sec_s, qw_sec_s, qwthl_sec_s, // Diagnostic Output Variables
                        wthl_sec_s, wqw_sec_s, wtke_sec_s, uw_sec_s, vw_sec_s, // Diagnostic Output Variables
-                       w3_s, wqls_sec_s, brunt_s, isotropy_s);                // Diagnostic Output Variables
+                       w3_s, wqls_sec_s, brunt_s, isotropy_s,                 // Diagnostic Output Variables
+                       tracer_du_s, tracer_dl_s, tracer_d_s, tracer_sfc_coef_s); // Tracer diffusion
 
     shoc_output.pblh(i) = pblh_s;
   });
+
+  if (defer_tracers) {
+    shoc_diffuse_tracers(shcol, nlev, nadv, num_qtracers, tracer_diffusion,
+                         shoc_input.wtracer_sfc, shoc_input_output.qtracers);
+  }
   Kokkos::fence();
 
   auto finish = std::chrono::steady_clock::now();
@@ -95,6 +95,48 @@ void Functions<S,D>::vd_shoc_solve(
 #endif
 }
 
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::vd_shoc_factor(
+  const MemberType&       team,
+  const uview_1d<Scalar>& du,
+  const uview_1d<Scalar>& dl,
+  const uview_1d<Scalar>& d)
+{
+  const Int nlev = d.extent(0);
+
+  // Store the multipliers in dl and the pivots in d, as the Fortran
+  // vd_shoc_decomp does.
+  Kokkos::single(Kokkos::PerTeam(team), [&] () {
+    for (Int k = 1; k < nlev; ++k) {
+      dl(k) = dl(k)/d(k-1);
+      d(k)  = d(k) - dl(k)*du(k-1);
+    }
+  });
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::vd_shoc_solve_factored(
+  const uview_1d<const Scalar>& du,
+  const uview_1d<const Scalar>& dl,
+  const uview_1d<const Scalar>& d,
+  const uview_1d<Scalar>&       var)
+{
+  const Int nlev = var.extent(0);
+
+  // Forward elimination
+  for (Int k = 1; k < nlev; ++k) {
+    var(k) = var(k) - dl(k)*var(k-1);
+  }
+
+  // Back substitution
+  var(nlev-1) = var(nlev-1)/d(nlev-1);
+  for (Int k = nlev-1; k > 0; --k) {
+    var(k-1) = (var(k-1) - du(k-1)*var(k))/d(k-1);
+  }
+}
+
 } // namespace shoc
 } // namespace scream
 
@@ -37,7 +37,11 @@ void Functions<S,D>::update_prognostics_implicit(
   const uview_2d<Spack>&       qtracers,
   const uview_1d<Spack>&       tke,
   const uview_1d<Spack>&       u_wind,
-  const uview_1d<Spack>&       v_wind)
+  const uview_1d<Spack>&       v_wind,
+  const uview_1d<Scalar>&      tracer_du,
+  const uview_1d<Scalar>&      tracer_dl,
+  const uview_1d<Scalar>&      tracer_d,
+  const uview_1d<Scalar>&      tracer_sfc_coef)
 {
   // Define temporary variables via the WorkspaceManager
 
@@ -58,21 +62,18 @@ void Functions<S,D>::update_prognostics_implicit(
   auto dl = Kokkos::subview(dl_workspace, Kokkos::make_pair(0,nlev));
   auto d  = Kokkos::subview(d_workspace,  Kokkos::make_pair(0,nlev));
 
-  // 2d allocations for solver RHS
+  // 2d allocation for the wind solver RHS. Thermo variables and tracers
+  // are solved in place, so they need no RHS storage.
   const int num_wind_transpose_packs = ekat::npack<Spack>(2);
-  const int num_qtracers_transpose_packs = ekat::npack<Spack>(num_qtracers+3);
-
   const int n_wind_slots = num_wind_transpose_packs*Spack::n;
-  const int n_trac_slots = num_qtracers_transpose_packs*Spack::n;
-
-  const auto wind_slot    = workspace.template take_macro_block<Scalar>("wind_slot",n_wind_slots);
-  const auto tracers_slot = workspace.template take_macro_block<Scalar>("tracers_slot",n_trac_slots);
+  const auto wind_slot = workspace.template take_macro_block<Scalar>("wind_slot",n_wind_slots);
+  const auto wind_rhs  = uview_2d<Spack>(reinterpret_cast<Spack*>(wind_slot.data()),
+                                         nlev, num_wind_transpose_packs);
 
-  // Reshape 2d views
-  const auto wind_rhs     = uview_2d<Spack>(reinterpret_cast<Spack*>(wind_slot.data()),
-                                            nlev, num_wind_transpose_packs);
-  const auto qtracers_rhs  = uview_2d<Spack>(reinterpret_cast<Spack*>(tracers_slot.data()),
-                                            nlev, num_qtracers_transpose_packs);
+  // If tracer diffusion is deferred to shoc_diffuse_tracers, only the thermo
+  // variables are solved here.
+  const bool defer_tracers = tracer_d.size() > 0;
+  const Int num_solved_tracers = defer_tracers ? 0 : num_qtracers;
 
   // scalarized versions of some views will be needed
   const auto rdp_zt_s       = ekat::scalarize(rdp_zt);
@@ -84,7 +85,6 @@ void Functions<S,D>::update_prognostics_implicit(
   const auto qw_s           = ekat::scalarize(qw);
   const auto tke_s          = ekat::scalarize(tke);
   const auto qtracers_s     = ekat::scalarize(qtracers);
-  const auto qtracers_rhs_s = ekat::scalarize(qtracers_rhs);
   const auto wtracer_sfc_s  = ekat::scalarize(wtracer_sfc);
 
   // linearly interpolate tkh, tk, and air density onto the interface grids
@@ -133,26 +133,19 @@ void Functions<S,D>::update_prognostics_implicit(
       thetal_s(nlev-1) += cmnfac*wthl_sfc;
       qw_s(nlev-1)     += cmnfac*wqw_sfc;
       tke_s(nlev-1)    += cmnfac*wtke_sfc;
+      if (defer_tracers) tracer_sfc_coef(0) = cmnfac;
     });
 
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, num_qtracers), [&] (const Int& q) {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, num_solved_tracers), [&] (const Int& q) {
       qtracers_s(q, nlev-1) += cmnfac*wtracer_sfc_s(q);
     });
   }
 
-  // Store RHS values in wind_rhs and qtracers_rhs for 1st and 2nd solve respectively
+  // Store RHS values in wind_rhs for the momentum solve
   team.team_barrier();
   Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&] (const Int& k) {
     wind_rhs_s(k,0) = u_wind_s(k);
     wind_rhs_s(k,1) = v_wind_s(k);
-
-    // The rhs version of the tracers is the transpose of the input/output layout
-    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, num_qtracers), [&] (const Int& q) {
-      qtracers_rhs_s(k, q) = qtracers_s(q, k);
-    });
-    qtracers_rhs_s(k, num_qtracers)   = thetal_s(k);
-    qtracers_rhs_s(k, num_qtracers+1) = qw_s(k);
-    qtracers_rhs_s(k, num_qtracers+2) = tke_s(k);
   });
 
   // march u_wind and v_wind one step forward using implicit solver
@@ -163,39 +156,47 @@ void Functions<S,D>::update_prognostics_implicit(
     // Solve
     team.team_barrier();
     vd_shoc_solve(team, du, dl, d, wind_rhs);
+
+    // Copy RHS values back into output variables
+    team.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&] (const Int& k) {
+      u_wind_s(k) = wind_rhs_s(k, 0);
+      v_wind_s(k) = wind_rhs_s(k, 1);
+    });
   }
 
   // march temperature, total water, tke,and tracers one step forward using implicit solver
   {
     // Call decomp for thermo variables. Fluxes applied explicitly, so zero
     // fluxes out for implicit solver decomposition.
-    team.team_barrier();
     vd_shoc_decomp(team, nlev, tkh_zi, tmpi, rdp_zt, dtime, 0, du, dl, d);
 
-    // Solve
+    // Factor the matrix once, then solve for all variables in place, in their
+    // input/output layout (levels are contiguous for each tracer). Each thread
+    // handles one variable, so that the vectorization is across tracers.
     team.team_barrier();
-    vd_shoc_solve(team, du, dl, d, qtracers_rhs);
-  }
-
-  // Copy RHS values back into output variables
-  team.team_barrier();
-  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&] (const Int& k) {
-    u_wind_s(k) = wind_rhs_s(k, 0);
-    v_wind_s(k) = wind_rhs_s(k, 1);
+    vd_shoc_factor(team, du, dl, d);
 
-    // Transpose tracers back to  input/output layout
-    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, num_qtracers), [&] (const Int& q) {
-      qtracers_s(q, k) = qtracers_rhs_s(k, q);
+    team.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, num_solved_tracers+3), [&] (const Int& q) {
+      Scalar* var = q <  num_solved_tracers   ? &qtracers_s(q, 0) :
+                    q == num_solved_tracers   ? thetal_s.data() :
+                    q == num_solved_tracers+1 ? qw_s.data() : tke_s.data();
+      vd_shoc_solve_factored(du, dl, d, uview_1d<Scalar>(var, nlev));
     });
-    thetal_s(k) = qtracers_rhs_s(k, num_qtracers);
-    qw_s(k)     = qtracers_rhs_s(k, num_qtracers+1);
-    tke_s(k)    = qtracers_rhs_s(k, num_qtracers+2);
-  });
 
+    // Store the factored matrix for shoc_diffuse_tracers
+    if (defer_tracers) {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&] (const Int& k) {
+        tracer_du(k) = du(k);
+        tracer_dl(k) = dl(k);
+        tracer_d(k)  = d(k);
+      });
+    }
+  }
 
   // Release temporary variables from the workspace
   team.team_barrier();
-  workspace.template release_macro_block<Scalar>(tracers_slot,n_trac_slots);
   workspace.template release_macro_block<Scalar>(wind_slot,n_wind_slots);
   workspace.template release_many_contiguous<3,Scalar>(
     {&du_workspace, &dl_workspace, &d_workspace});
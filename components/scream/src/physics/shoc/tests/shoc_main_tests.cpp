@@ -472,6 +472,84 @@ struct UnitWrap::UnitTest<D>::TestShocMain {
       }
     }
   } // run_bfb
+
+  static void run_tracer_diffusion()
+  {
+    auto engine = setup_random_test();
+
+    // The tracers can be diffused inside the SHOC column kernel, or in a
+    // separate kernel after it (see shoc_diffuse_tracers). Both must give
+    // the same tracers, for one and several SHOC substeps.
+    ShocMainData in_kernel_data[] = {
+      //           shcol, nlev, nlevi, num_qtracers, dtime, nadv, nbot_shoc, ntop_shoc(C++ indexing)
+      ShocMainData(12,      72,    73,            5,   300,   15,        72, 0),
+      ShocMainData(7,       16,    17,            3,   300,    1,        12, 0),
+      ShocMainData(2,       7,      8,            2,   300,    5,         7, 4)
+    };
+
+    for (auto& d : in_kernel_data) {
+      d.randomize(engine,
+                  {
+                    {d.presi, {700e2,1000e2}},
+                    {d.tkh, {3,50}},
+                    {d.tke, {0.1,0.3}},
+                    {d.zi_grid, {0, 3000}},
+                    {d.wthl_sfc, {0,1e-4}},
+                    {d.wqw_sfc, {0,1e-6}},
+                    {d.uw_sfc, {0,1e-2}},
+                    {d.vw_sfc, {0,1e-4}},
+                    {d.host_dx, {3000, 3000}},
+                    {d.host_dy, {3000, 3000}},
+                    {d.phis, {0, 500}},
+                    {d.wthv_sec, {-0.02, 0.03}},
+                    {d.qw, {1e-4, 5e-2}},
+                    {d.u_wind, {-10, 0}},
+                    {d.v_wind, {-10, 0}},
+                    {d.shoc_ql, {0, 1e-3}},
+                    {d.wtracer_sfc, {0, 1e-4}},
+                  });
+    }
+
+    ShocMainData separate_data[] = {
+      ShocMainData(in_kernel_data[0]),
+      ShocMainData(in_kernel_data[1]),
+      ShocMainData(in_kernel_data[2])
+    };
+
+    static constexpr Int num_runs = sizeof(in_kernel_data) / sizeof(ShocMainData);
+    for (Int i = 0; i < num_runs; ++i) {
+      for (bool separate : {false, true}) {
+        ShocMainData& d = separate ? separate_data[i] : in_kernel_data[i];
+        d.transpose<ekat::TransposeDirection::c2f>(); // _f expects data in fortran layout
+        const int npbl = shoc_init_f(d.nlev, d.pref_mid, d.nbot_shoc, d.ntop_shoc);
+
+        shoc_main_f(d.shcol, d.nlev, d.nlevi, d.dtime, d.nadv, npbl, d.host_dx, d.host_dy,
+                    d.thv, d.zt_grid, d.zi_grid, d.pres, d.presi, d.pdel, d.wthl_sfc,
+                    d.wqw_sfc, d.uw_sfc, d.vw_sfc, d.wtracer_sfc, d.num_qtracers,
+                    d.w_field, d.inv_exner, d.phis, d.host_dse, d.tke, d.thetal, d.qw,
+                    d.u_wind, d.v_wind, d.qtracers, d.wthv_sec, d.tkh, d.tk, d.shoc_ql,
+                    d.shoc_cldfrac, d.pblh, d.shoc_mix, d.isotropy, d.w_sec, d.thl_sec,
+                    d.qw_sec, d.qwthl_sec, d.wthl_sec, d.wqw_sec, d.wtke_sec, d.uw_sec,
+                    d.vw_sec, d.w3, d.wqls_sec, d.brunt, d.shoc_ql2, separate);
+        d.transpose<ekat::TransposeDirection::f2c>(); // go back to C layout
+      }
+
+      // Both versions add the surface flux and apply the same factored
+      // solver, in the same order, so the tracers must be identical.
+      const ShocMainData& d_in  = in_kernel_data[i];
+      const ShocMainData& d_sep = separate_data[i];
+      REQUIRE(d_in.total(d_in.qtracers) == d_sep.total(d_sep.qtracers));
+      for (Int k = 0; k < d_in.total(d_in.qtracers); ++k) {
+        REQUIRE(d_in.qtracers[k] == d_sep.qtracers[k]);
+      }
+      // The thermo variables must not be affected either
+      for (Int k = 0; k < d_in.total(d_in.thetal); ++k) {
+        REQUIRE(d_in.thetal[k] == d_sep.thetal[k]);
+        REQUIRE(d_in.qw[k] == d_sep.qw[k]);
+        REQUIRE(d_in.tke[k] == d_sep.tke[k]);
+      }
+    }
+  } // run_tracer_diffusion
 };
 
 } // namespace unit_test
@@ -494,4 +572,11 @@ TEST_CASE("shoc_main_bfb", "shoc")
   TestStruct::run_bfb();
 }
 
+TEST_CASE("shoc_main_tracer_diffusion", "shoc")
+{
+  using TestStruct = scream::shoc::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestShocMain;
+
+  TestStruct::run_tracer_diffusion();
+}
+
 } // empty namespace
@@ -46,6 +46,14 @@ struct UnitWrap::UnitTest<D>::TestVdShocDecompandSolve {
       VdShocDecompandSolveData(f90_data[3])
     };
 
+    // Same, for the factored solver
+    VdShocDecompandSolveData cxx_fact_data[] = {
+      VdShocDecompandSolveData(f90_data[0]),
+      VdShocDecompandSolveData(f90_data[1]),
+      VdShocDecompandSolveData(f90_data[2]),
+      VdShocDecompandSolveData(f90_data[3])
+    };
+
     // Assume all data is in C layout
 
     // Get data from fortran.
@@ -64,6 +72,13 @@ struct UnitWrap::UnitTest<D>::TestVdShocDecompandSolve {
                                  d_cxx.kv_term, d_cxx.tmpi, d_cxx.rdp_zt,
                                  d_cxx.dtime, d_cxx.flux, d_cxx.var);
       d_cxx.transpose<ekat::TransposeDirection::f2c>(); // go back to C layout
+
+      VdShocDecompandSolveData& d_fact = cxx_fact_data[i];
+      d_fact.transpose<ekat::TransposeDirection::c2f>();
+      vd_shoc_decomp_and_solve_factored_f(d_fact.shcol, d_fact.nlev, d_fact.nlevi, d_fact.n_rhs,
+                                          d_fact.kv_term, d_fact.tmpi, d_fact.rdp_zt,
+                                          d_fact.dtime, d_fact.flux, d_fact.var);
+      d_fact.transpose<ekat::TransposeDirection::f2c>();
     }
 
     // Verify BFB results, all data should be in C layout
@@ -71,9 +86,11 @@ struct UnitWrap::UnitTest<D>::TestVdShocDecompandSolve {
       for (Int i = 0; i < num_runs; ++i) {
         VdShocDecompandSolveData& d_f90 = f90_data[i];
         VdShocDecompandSolveData& d_cxx = cxx_data[i];
+        VdShocDecompandSolveData& d_fact = cxx_fact_data[i];
         for (Int k = 0; k < d_f90.total(d_f90.var); ++k) {
           REQUIRE(d_f90.total(d_f90.var) == d_cxx.total(d_cxx.var));
           REQUIRE(d_f90.var[k] == d_cxx.var[k]);
+          REQUIRE(d_f90.var[k] == d_fact.var[k]);
         }
       }
     }
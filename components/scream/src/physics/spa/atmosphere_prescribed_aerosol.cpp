@@ -163,11 +163,25 @@ void SPA::initialize_impl ()
   SPAData_start = SPAFunc::SPAData(m_dofs_gids.size(), SPAHorizInterp.source_grid_nlevs, m_nswbands, m_nlwbands);
   SPAData_end   = SPAFunc::SPAData(m_dofs_gids.size(), SPAHorizInterp.source_grid_nlevs, m_nswbands, m_nlwbands);
 
+  // If requested, read the data of the month after the end of the current interpolation
+  // interval during the month, so that moving to the next month does not stall on I/O.
+  m_prefetch_data = m_params.get<bool>("Prefetch Data",true);
+  if (m_prefetch_data) {
+    SPADataPrefetch = SPAFunc::SPAPrefetch(m_dofs_gids.size(), SPAHorizInterp.source_grid_nlevs, m_nswbands, m_nlwbands);
+  }
+
+  // Initialize the structure used for the vertical interpolation. If a tolerance is given, the
+  // interpolation setup of a column is only redone when its pressure profiles change by more
+  // than that (relative) amount.
+  const auto vert_interp_tol = m_params.get<Real>("Vertical Interpolation Setup Tolerance",0);
+  SPAVertInterp = SPAFunc::SPAVertInterp(m_num_cols, m_num_levs, m_num_levs, m_nswbands, m_nlwbands, vert_interp_tol);
+
   // Update the local time state information and load the first set of SPA data for interpolation:
   auto ts = timestamp();
   SPATimeState.inited = false;
   SPATimeState.current_month = ts.get_month();
-  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end,
+                                m_prefetch_data ? &SPADataPrefetch : nullptr);
 }
 
 // =========================================================================================
@@ -176,10 +190,11 @@ void SPA::run_impl (const int /* dt */)
   /* Gather time and state information for interpolation */
   auto ts = timestamp();
   /* Update time state and if the month has changed, update the data.*/
-  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end,
+                                m_prefetch_data ? &SPADataPrefetch : nullptr);
 
   // Call the main SPA routine to get interpolated aerosol forcings.
-  SPAFunc::spa_main(SPATimeState, SPAPressureState,SPAData_start,SPAData_end,SPAData_out,m_num_cols,m_num_levs,m_nswbands,m_nlwbands);
+  SPAFunc::spa_main(SPATimeState, SPAPressureState,SPAData_start,SPAData_end,SPAData_out,m_num_cols,m_num_levs,m_nswbands,m_nlwbands,SPAVertInterp);
 }
 
 // =========================================================================================
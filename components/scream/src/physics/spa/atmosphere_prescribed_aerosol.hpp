@@ -109,11 +109,16 @@ protected:
   std::string m_spa_remap_file;
   std::string m_spa_data_file;
 
+  // Whether to read the data of the following month ahead of time
+  bool m_prefetch_data;
+
   // Structures to store the data used for interpolation
   SPAFunc::SPATimeState     SPATimeState;
   SPAFunc::SPAPressureState SPAPressureState;
   SPAFunc::SPAData          SPAData_start;
   SPAFunc::SPAData          SPAData_end;
+  SPAFunc::SPAPrefetch      SPADataPrefetch;
+  SPAFunc::SPAVertInterp    SPAVertInterp;
   SPAFunc::SPAHorizInterp   SPAHorizInterp;
   SPAFunc::SPAOutput        SPAData_out;
 
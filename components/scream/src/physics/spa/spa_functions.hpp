@@ -7,8 +7,13 @@
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
+#include "ekat/util/ekat_lin_interp.hpp"
 
+#include <map>
+#include <memory>
 #include <numeric>
+#include <string>
+#include <vector>
 
 namespace scream {
 namespace spa {
@@ -35,6 +40,8 @@ struct SPAFunctions
   using KT = KokkosTypes<Device>;
   using MemberType = typename KT::MemberType;
 
+  using LIV = ekat::LinInterp<Real,Spack::n>;
+
   using WorkspaceManager = typename ekat::WorkspaceManager<Spack, Device>;
   using Workspace        = typename WorkspaceManager::Workspace;
 
@@ -166,6 +173,84 @@ struct SPAFunctions
     view_1d<Int> target_grid_loc;
 
   }; // SPAHorizInterp
+
+  struct SPAVertInterp {
+    // This structure stores the temporaries used by spa_main, so that they are
+    // allocated only once, as well as the vertical interpolator. Setting up the
+    // interpolator for a column (i.e., finding where the target levels are in
+    // the source profile) only depends on the source and target pressure. If
+    // setup_tol>0, the setup of a column is reused until either profile changed
+    // by more than setup_tol (relative) since the last setup. Note that this
+    // is not BFB with setting up the interpolator every time (setup_tol=0).
+    SPAVertInterp() = default;
+    SPAVertInterp(const int ncols_, const int nlevs_src_, const int nlevs_tgt_,
+                  const int nswbands_, const int nlwbands_, const Real setup_tol_ = 0) :
+      ncols(ncols_)
+      ,nlevs_src(nlevs_src_)
+      ,nlevs_tgt(nlevs_tgt_)
+      ,setup_tol(setup_tol_)
+    {
+      const int npack_src = ekat::npack<Spack>(nlevs_src);
+      const int npack_tgt = ekat::npack<Spack>(nlevs_tgt);
+      p_src          = view_2d<Spack>("p_mid_src",ncols,npack_src);
+      ccn3_src       = view_2d<Spack>("ccn3_src",ncols,npack_src);
+      aer_g_sw_src   = view_3d<Spack>("aer_g_sw_src",ncols,nswbands_,npack_src);
+      aer_ssa_sw_src = view_3d<Spack>("aer_ssa_sw_src",ncols,nswbands_,npack_src);
+      aer_tau_sw_src = view_3d<Spack>("aer_tau_sw_src",ncols,nswbands_,npack_src);
+      aer_tau_lw_src = view_3d<Spack>("aer_tau_lw_src",ncols,nlwbands_,npack_src);
+      if (setup_tol>0) {
+        p_src_setup = view_2d<Spack>("p_mid_src_setup",ncols,npack_src);
+        pmid_setup  = view_2d<Spack>("p_mid_setup",ncols,npack_tgt);
+      }
+      // Hard-code a minimum value for aerosol concentration to zero.
+      const Real minthreshold = 0.0;
+      lin_interp = std::make_shared<LIV>(ncols,nlevs_src,nlevs_tgt,minthreshold);
+    }
+    // Number of columns, and of levels of source data and simulation
+    Int ncols;
+    Int nlevs_src;
+    Int nlevs_tgt;
+    // Relative change in pressure profiles that triggers a new setup
+    Real setup_tol = 0;
+    // Whether the interpolator was set up for all columns at least once
+    bool is_setup = false;
+    // Source data interpolated in time
+    view_2d<Spack> p_src;
+    view_2d<Spack> ccn3_src;
+    view_3d<Spack> aer_g_sw_src;
+    view_3d<Spack> aer_ssa_sw_src;
+    view_3d<Spack> aer_tau_sw_src;
+    view_3d<Spack> aer_tau_lw_src;
+    // Source and target pressure at the time of the last setup (only if setup_tol>0)
+    view_2d<Spack> p_src_setup;
+    view_2d<Spack> pmid_setup;
+    // The vertical interpolator
+    std::shared_ptr<LIV> lin_interp;
+  }; // SPAVertInterp
+
+  struct SPAPrefetch {
+    // This structure stores the data of the month following the one used as end
+    // point of the time interpolation. The data is read from file one variable
+    // per time step (see update_spa_prefetch), so that when the simulation moves
+    // to a new month, the new end point data is already available, and there is
+    // no need to stall to read a full month of data from file.
+    // The memory cost is one more month of data on the simulation grid, plus one
+    // month of source data on host.
+    SPAPrefetch() = default;
+    SPAPrefetch(const int ncol_, const int nlev_, const int nswbands_, const int nlwbands_) :
+      data(ncol_,nlev_,nswbands_,nlwbands_)
+    {}
+    // The month being prefetched (1-12). If 0, nothing is being prefetched.
+    Int month = 0;
+    // Number of variables read from file so far
+    Int num_read = 0;
+    // Whether all variables were read and remapped onto the simulation grid.
+    bool ready = false;
+    // The data as read from file, on the source grid
+    std::map<std::string,view_1d_host> source_data;
+    // The data remapped onto the simulation grid
+    SPAData data;
+  }; // SPAPrefetch
   /* ------------------------------------------------------------------------------------------- */
   // SPA routines
   static void spa_main(
@@ -179,6 +264,20 @@ struct SPAFunctions
     Int nswbands,
     Int nlwbands);
 
+  // Same as above, but reusing the temporaries and vertical interpolation setup
+  // stored in spa_vert_interp across calls.
+  static void spa_main(
+    const SPATimeState& time_state,
+    const SPAPressureState& pressure_state,
+    const SPAData&   data_beg,
+    const SPAData&   data_end,
+    const SPAOutput& data_out,
+    Int ncols_scream,
+    Int nlevs_scream,
+    Int nswbands,
+    Int nlwbands,
+    SPAVertInterp& spa_vert_interp);
+
   static void get_remap_weights_from_file(
     const std::string&       remap_file_name,
     const Int                ncols_scream,
@@ -192,6 +291,25 @@ struct SPAFunctions
     const view_1d<gid_type>& dofs_gids,
           SPAHorizInterp&    spa_horiz_interp);
 
+  // The names of the variables in the SPA data file
+  static std::vector<std::string> spa_var_names();
+
+  static void read_spa_vars_from_file(
+    const std::string&               spa_data_file_name,
+    const Int                        time_index,
+    const Int                        nswbands,
+    const Int                        nlwbands,
+    const SPAHorizInterp&            spa_horiz_interp,
+    const std::vector<std::string>&  var_names,
+          std::map<std::string,view_1d_host>& source_data);
+
+  static void remap_spa_data(
+    const Int                                 nswbands,
+    const Int                                 nlwbands,
+    const SPAHorizInterp&                     spa_horiz_interp,
+    const std::map<std::string,view_1d_host>& source_data,
+          SPAData&                            spa_data);
+
   static void update_spa_data_from_file(
     const std::string&    spa_data_file_name,
     const Int             time_index,
@@ -200,6 +318,13 @@ struct SPAFunctions
           SPAHorizInterp& spa_horiz_interp,
           SPAData&        spa_data);
 
+  static void update_spa_prefetch(
+    const std::string&    spa_data_file_name,
+    const Int             nswbands,
+    const Int             nlwbands,
+    const SPAHorizInterp& spa_horiz_interp,
+          SPAPrefetch&    prefetch);
+
   static void update_spa_timestate(
     const std::string&     spa_data_file_name,
     const Int              nswbands,
@@ -208,7 +333,8 @@ struct SPAFunctions
           SPAHorizInterp&  spa_horiz_interp,
           SPATimeState&    time_state, 
           SPAData&         spa_beg,
-          SPAData&         spa_end);
+          SPAData&         spa_end,
+          SPAPrefetch*     prefetch = nullptr);
     
 
 }; // struct Functions
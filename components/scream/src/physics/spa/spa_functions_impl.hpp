@@ -100,36 +100,70 @@ void SPAFunctions<S,D>
   Int nlevs_atm,
   Int nswbands,
   Int nlwbands)
+{
+  // Without persistent interpolation data, use temporaries that are only valid for this call.
+  SPAVertInterp spa_vert_interp(ncols_atm,pressure_state.nlevs,nlevs_atm,nswbands,nlwbands);
+  spa_main(time_state,pressure_state,data_beg,data_end,data_out,ncols_atm,nlevs_atm,nswbands,nlwbands,spa_vert_interp);
+}
+
+template <typename S, typename D>
+void SPAFunctions<S,D>
+::spa_main(
+  const SPATimeState& time_state,
+  const SPAPressureState& pressure_state,
+  const SPAData&   data_beg,
+  const SPAData&   data_end,
+  const SPAOutput& data_out,
+  Int ncols_atm,
+  Int nlevs_atm,
+  Int nswbands,
+  Int nlwbands,
+  SPAVertInterp& spa_vert_interp)
 {
   // Gather time stamp info
   auto& t_now = time_state.t_now;
   auto& t_beg = time_state.t_beg_month;
   auto& t_len = time_state.days_this_month;
 
-
   // For now we require that the Data in and the Data out have the same number of columns.
   EKAT_REQUIRE(ncols_atm==pressure_state.ncols);
-
-  // Set up temporary arrays that will be used for the spa interpolation.
-  view_2d<Spack> p_src("p_mid_src",ncols_atm,pressure_state.nlevs), 
-                 ccn3_src("ccn3_src",ncols_atm,pressure_state.nlevs);
-  view_3d<Spack> aer_g_sw_src("aer_g_sw_src",ncols_atm,nswbands,pressure_state.nlevs),
-                 aer_ssa_sw_src("aer_ssa_sw_src",ncols_atm,nswbands,pressure_state.nlevs),
-                 aer_tau_sw_src("aer_tau_sw_src",ncols_atm,nswbands,pressure_state.nlevs),
-                 aer_tau_lw_src("aer_tau_lw_src",ncols_atm,nlwbands,pressure_state.nlevs);
-
-  using ExeSpace = typename KT::ExeSpace;
-  const Int nk_pack = ekat::npack<Spack>(nlevs_atm);
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncols_atm, nk_pack);
-  // SPA Main loop
+  EKAT_REQUIRE_MSG(spa_vert_interp.ncols==ncols_atm && spa_vert_interp.nlevs_src==pressure_state.nlevs &&
+                   spa_vert_interp.nlevs_tgt==nlevs_atm,
+                   "Error! SPA vertical interpolation structure has the wrong dimensions.\n");
+
+  // Temporary arrays used for the spa interpolation, stored in spa_vert_interp so that
+  // they are not allocated at every call.
+  const auto p_src          = spa_vert_interp.p_src;
+  const auto ccn3_src       = spa_vert_interp.ccn3_src;
+  const auto aer_g_sw_src   = spa_vert_interp.aer_g_sw_src;
+  const auto aer_ssa_sw_src = spa_vert_interp.aer_ssa_sw_src;
+  const auto aer_tau_sw_src = spa_vert_interp.aer_tau_sw_src;
+  const auto aer_tau_lw_src = spa_vert_interp.aer_tau_lw_src;
+  const auto p_src_setup    = spa_vert_interp.p_src_setup;
+  const auto pmid_setup     = spa_vert_interp.pmid_setup;
+  const Real setup_tol      = spa_vert_interp.setup_tol;
+  const bool force_setup    = not spa_vert_interp.is_setup;
+
+  // Vertical interpolation is done using the EKAT linear interpolation routine, see
+  // /externals/ekat/util/ekat_lin_interp.hpp for more details.
+  const auto VertInterp = *spa_vert_interp.lin_interp;
+
+  const Int nlevs_src = pressure_state.nlevs;
+  const Int nk_pack   = ekat::npack<Spack>(nlevs_src);
+  const Int num_vert_interp = 1 + nlwbands + 3*nswbands;
+
+  // SPA Main loop. Time interpolation, setup of the vertical interpolation, and vertical
+  // interpolation of all the variables are done in a single kernel.
   // Parallel loop order:
   // 1. Loop over all horizontal columns (i index)
   // 2. Loop over all aerosol bands (n index) - where applicable
   // 3. Loop over all vertical packs (k index)
+  const Int most_bands = std::max(nlwbands, nswbands);
+  typename LIV::TeamPolicy policy(ncols_atm, ekat::OnGpu<typename LIV::ExeSpace>::value ? most_bands : 1, VertInterp.km2_pack());
   Kokkos::parallel_for(
     "spa main loop",
     policy,
-    KOKKOS_LAMBDA(const MemberType& team) {
+    KOKKOS_LAMBDA(const typename LIV::MemberType& team) {
 
     const Int i = team.league_rank();  // SCREAM column index
 
@@ -156,7 +190,6 @@ void SPAFunctions<S,D>
      *       in this loop as well.  */
     using C = scream::physics::Constants<Real>;
     static constexpr auto P0 = C::P0;
-    const Int nk_pack = ekat::npack<Spack>(pressure_state.nlevs);
     Kokkos::parallel_for(
       Kokkos::TeamThreadRange(team, nk_pack), [&] (Int k) {
         // Reconstruct vertical temperature profile using the hybrid coordinate system.
@@ -164,7 +197,6 @@ void SPAFunctions<S,D>
         // Time interpolation for CCN3
         ccn3_src_sub(k) = linear_interp(ccn3_beg_sub(k),ccn3_end_sub(k),t_norm);
     });
-    team.team_barrier();
     /* Loop over all SW variables with nswbands */
     Kokkos::parallel_for(
       Kokkos::TeamThreadRange(team, nswbands), [&] (int n) {
@@ -188,7 +220,6 @@ void SPAFunctions<S,D>
         aer_tau_sw_src_sub(k) = linear_interp(aer_tau_sw_beg_sub(k), aer_tau_sw_end_sub(k), t_norm);
       });
     });
-    team.team_barrier();
     /* Loop over all LW variables with nlwbands */
     Kokkos::parallel_for(
       Kokkos::TeamThreadRange(team, nlwbands), [&] (int n) {
@@ -203,82 +234,90 @@ void SPAFunctions<S,D>
       });
     });
     team.team_barrier();
-  });
-  Kokkos::fence();
 
-  // Third Step: Vertical interpolation, project the SPA data onto the pressure profile for this simulation.
-  // This is done using the EKAT linear interpolation routine, see /externals/ekat/util/ekat_lin_interp.hpp
-  // for more details. 
-  using LIV = ekat::LinInterp<Real,Spack::n>;
-  Real minthreshold = 0.0;  // Hard-code a minimum value for aerosol concentration to zero.
-
-  LIV VertInterp(ncols_atm,pressure_state.nlevs,nlevs_atm,minthreshold);
-  /* Parallel loop strategy:
-   * 1. Loop over all simulation columns (i index)
-   * 2. Where applicable, loop over all aerosol bands (n index)
-   */
-  const Int most_bands = std::max(nlwbands, nswbands);
-  typename LIV::TeamPolicy band_policy(ncols_atm, ekat::OnGpu<typename LIV::ExeSpace>::value ? most_bands : 1, VertInterp.km2_pack());
-  Kokkos::parallel_for("vertical-interp-spa",
-    band_policy,
-    KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
-    const int i = team.league_rank();
-    /* Setup the linear interpolater for this column. */
-    if (team.team_rank()==0) {
-      const auto tvr = Kokkos::ThreadVectorRange(team, VertInterp.km2_pack());
-    
-      VertInterp.setup(team,tvr,
-                       ekat::subview(p_src,i),
-                       ekat::subview(pressure_state.pmid,i));
+    // Third Step: Vertical interpolation, project the SPA data onto the pressure profile for this simulation.
+    /* Setup the linear interpolater for this column. The setup only depends on the source
+     * and target pressure profiles, so, if a tolerance was given, it is skipped as long as
+     * neither profile moved by more than the tolerance (relative) since the last setup. */
+    bool do_setup = true;
+    if (setup_tol>0 && !force_setup) {
+      const auto p_src_s       = ekat::scalarize(p_src_sub);
+      const auto pmid_s        = ekat::scalarize(pmid_sub);
+      const auto p_src_setup_s = ekat::scalarize(ekat::subview(p_src_setup, i));
+      const auto pmid_setup_s  = ekat::scalarize(ekat::subview(pmid_setup, i));
+      Real max_change = 0;
+      Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(team, ekat::impl::max(nlevs_src,nlevs_atm)), [&] (Int k, Real& change) {
+        if (k<nlevs_src) {
+          const Real diff = p_src_s(k)-p_src_setup_s(k);
+          change = ekat::impl::max(change, (diff<0 ? -diff : diff)/p_src_setup_s(k));
+        }
+        if (k<nlevs_atm) {
+          const Real diff = pmid_s(k)-pmid_setup_s(k);
+          change = ekat::impl::max(change, (diff<0 ? -diff : diff)/pmid_setup_s(k));
+        }
+      }, Kokkos::Max<Real>(max_change));
+      do_setup = max_change>setup_tol;
     }
-    team.team_barrier();
-    /* Conduct vertical interpolation for the 2D variable CCN3 */
-    if (team.team_rank()==0) {
-      const auto tvr = Kokkos::ThreadVectorRange(team, VertInterp.km2_pack());
-    
-      VertInterp.lin_interp(team,tvr,
-                            ekat::subview(p_src,i),
-                            ekat::subview(pressure_state.pmid,i),
-                            ekat::subview(ccn3_src,i),
-                            ekat::subview(data_out.CCN3,i));
+    if (do_setup) {
+      if (team.team_rank()==0) {
+        const auto tvr = Kokkos::ThreadVectorRange(team, VertInterp.km2_pack());
+        VertInterp.setup(team,tvr,p_src_sub,pmid_sub);
+      }
+      if (setup_tol>0) {
+        const auto& p_src_setup_sub = ekat::subview(p_src_setup, i);
+        const auto& pmid_setup_sub  = ekat::subview(pmid_setup, i);
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, ekat::impl::max(nk_pack,pmid_setup_sub.extent_int(0))), [&] (Int k) {
+          if (k<nk_pack) {
+            p_src_setup_sub(k) = p_src_sub(k);
+          }
+          if (k<pmid_setup_sub.extent_int(0)) {
+            pmid_setup_sub(k) = pmid_sub(k);
+          }
+        });
+      }
     }
-    /* Conduct vertical interpolation for the LW banded data - nlwbands (n index) */
-    Kokkos::parallel_for(
-      Kokkos::TeamThreadRange(team, nlwbands), [&] (int n) {
-      const auto& tvr = Kokkos::ThreadVectorRange(team, VertInterp.km2_pack());
-      VertInterp.lin_interp(team,
-                            tvr,
-                            ekat::subview(p_src,i),
-                            ekat::subview(pressure_state.pmid,i),
-                            ekat::subview(aer_tau_lw_src,i,n),
-                            ekat::subview(data_out.AER_TAU_LW,i,n));
-    });
-    /* Conduct vertical interpolation for the SW banded data - nswbands (n index) */
+    team.team_barrier();
+
+    /* Conduct vertical interpolation for all variables in one loop. Index m maps to
+     *   m=0:                       CCN3
+     *   m=1,...,nlwbands:          AER_TAU_LW (band m-1)
+     *   m=nlwbands+1,...:          AER_G_SW, AER_SSA_SW, AER_TAU_SW (band (m-nlwbands-1)/3) */
     Kokkos::parallel_for(
-      Kokkos::TeamThreadRange(team, nswbands), [&] (int n) {
+      Kokkos::TeamThreadRange(team, num_vert_interp), [&] (int m) {
       const auto& tvr = Kokkos::ThreadVectorRange(team, VertInterp.km2_pack());
-      VertInterp.lin_interp(team,
-                            tvr,
-                            ekat::subview(p_src,i),
-                            ekat::subview(pressure_state.pmid,i),
-                            ekat::subview(aer_g_sw_src,i,n),
-                            ekat::subview(data_out.AER_G_SW,i,n));
-      VertInterp.lin_interp(team,
-                            tvr,
-                            ekat::subview(p_src,i),
-                            ekat::subview(pressure_state.pmid,i),
-                            ekat::subview(aer_ssa_sw_src,i,n),
-                            ekat::subview(data_out.AER_SSA_SW,i,n));
-      VertInterp.lin_interp(team,
-                            tvr,
-                            ekat::subview(p_src,i),
-                            ekat::subview(pressure_state.pmid,i),
-                            ekat::subview(aer_tau_sw_src,i,n),
-                            ekat::subview(data_out.AER_TAU_SW,i,n));
+      if (m==0) {
+        VertInterp.lin_interp(team,tvr,p_src_sub,pmid_sub,
+                              ccn3_src_sub,
+                              ekat::subview(data_out.CCN3,i));
+      } else if (m<=nlwbands) {
+        const int n = m-1;
+        VertInterp.lin_interp(team,tvr,p_src_sub,pmid_sub,
+                              ekat::subview(aer_tau_lw_src,i,n),
+                              ekat::subview(data_out.AER_TAU_LW,i,n));
+      } else {
+        const int n   = (m-nlwbands-1) / 3;
+        const int var = (m-nlwbands-1) % 3;
+        if (var==0) {
+          VertInterp.lin_interp(team,tvr,p_src_sub,pmid_sub,
+                                ekat::subview(aer_g_sw_src,i,n),
+                                ekat::subview(data_out.AER_G_SW,i,n));
+        } else if (var==1) {
+          VertInterp.lin_interp(team,tvr,p_src_sub,pmid_sub,
+                                ekat::subview(aer_ssa_sw_src,i,n),
+                                ekat::subview(data_out.AER_SSA_SW,i,n));
+        } else {
+          VertInterp.lin_interp(team,tvr,p_src_sub,pmid_sub,
+                                ekat::subview(aer_tau_sw_src,i,n),
+                                ekat::subview(data_out.AER_TAU_SW,i,n));
+        }
+      }
     });
   });
   Kokkos::fence();
 
+  spa_vert_interp.is_setup = true;
 }  // END spa_main
 /*-----------------------------------------------------------------*/
 // Function to read the weights for conducting horizontal remapping
@@ -426,105 +465,92 @@ void SPAFunctions<S,D>
 }  // END get_remap_weights_from_file
 /*-----------------------------------------------------------------*/
 template<typename S, typename D>
+std::vector<std::string> SPAFunctions<S,D>
+::spa_var_names()
+{
+  return {"PS", "CCN3", "AER_G_SW", "AER_SSA_SW", "AER_TAU_SW", "AER_TAU_LW"};
+}
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
 void SPAFunctions<S,D>
-::update_spa_data_from_file(
-    const std::string&    spa_data_file_name,
-    const Int             time_index,
-    const Int             nswbands,
-    const Int             nlwbands,
-          SPAHorizInterp& spa_horiz_interp,
-          SPAData&        spa_data)
+::read_spa_vars_from_file(
+    const std::string&               spa_data_file_name,
+    const Int                        time_index,
+    const Int                        nswbands,
+    const Int                        nlwbands,
+    const SPAHorizInterp&            spa_horiz_interp,
+    const std::vector<std::string>&  var_names,
+          std::map<std::string,view_1d_host>& source_data)
 {
   // Note that the SPA data follows a conventional GLL grid format, albeit at a different resolution than
   // the simulation.  For simplicity we can use the scorpio_input object class but we must construct a
   // local grid to match the size of the SPA data file.
+  const Int ncols = spa_horiz_interp.source_grid_ncols;
+  const Int nlevs = spa_horiz_interp.source_grid_nlevs;
 
-  // To construct the grid we need to determine the number of columns and levels in the data file.
-  scorpio::register_file(spa_data_file_name,scorpio::Read);
-  Int ncol = scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"ncol");
-  spa_horiz_interp.source_grid_nlevs = scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"lev");
-  // while we have the file open, check that the dimensions map the simulation and the horizontal interpolation structure
-  EKAT_REQUIRE_MSG(nswbands==scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"swband"),"ERROR update_spa_data_from_file: Number of SW bands in simulation doesn't match the SPA data file");
-  EKAT_REQUIRE_MSG(nlwbands==scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"lwband"),"ERROR update_spa_data_from_file: Number of LW bands in simulation doesn't match the SPA data file");
-  EKAT_REQUIRE_MSG(ncol==spa_horiz_interp.source_grid_ncols,"ERROR update_spa_data_from_file: Number of columns in remap data doesn't match the SPA data file");
-
-  // Construct local arrays to read data into
-  // Note, all of the views being created here are meant to hold the local "coarse" resolution
-  // data that will need to be horizontally interpolated to the simulation grid using the remap
-  // data.  For example, 
-  //   We will first define the data surface pressure PS_v and read that from file.
-  //   then we will use the horizontal interpolation structure, spa_horiz_interp, to
-  //   interpolate PS_v onto the simulation grid: PS_v -> spa_data.PS
-  //   and so on for the other variables.
-  view_1d<Real> PS_v("PS",spa_horiz_interp.source_grid_ncols);
-  view_2d<Real> CCN3_v("CCN3",spa_horiz_interp.source_grid_ncols,spa_horiz_interp.source_grid_nlevs);
-  view_3d<Real> AER_G_SW_v("AER_G_SW",spa_horiz_interp.source_grid_ncols,nswbands,spa_horiz_interp.source_grid_nlevs);
-  view_3d<Real> AER_SSA_SW_v("AER_SSA_SW",spa_horiz_interp.source_grid_ncols,nswbands,spa_horiz_interp.source_grid_nlevs);
-  view_3d<Real> AER_TAU_SW_v("AER_TAU_SW",spa_horiz_interp.source_grid_ncols,nswbands,spa_horiz_interp.source_grid_nlevs);
-  view_3d<Real> AER_TAU_LW_v("AER_TAU_LW",spa_horiz_interp.source_grid_ncols,nlwbands,spa_horiz_interp.source_grid_nlevs);
-  auto PS_v_h            = Kokkos::create_mirror_view(PS_v);
-  auto CCN3_v_h          = Kokkos::create_mirror_view(CCN3_v);
-  auto AER_G_SW_v_h      = Kokkos::create_mirror_view(AER_G_SW_v);
-  auto AER_SSA_SW_v_h    = Kokkos::create_mirror_view(AER_SSA_SW_v);
-  auto AER_TAU_SW_v_h    = Kokkos::create_mirror_view(AER_TAU_SW_v);
-  auto AER_TAU_LW_v_h    = Kokkos::create_mirror_view(AER_TAU_LW_v);
-  Kokkos::deep_copy(PS_v_h,            PS_v);                     
-  Kokkos::deep_copy(CCN3_v_h,          CCN3_v);                   
-  Kokkos::deep_copy(AER_G_SW_v_h,      AER_G_SW_v);               
-  Kokkos::deep_copy(AER_SSA_SW_v_h,    AER_SSA_SW_v);             
-  Kokkos::deep_copy(AER_TAU_SW_v_h,    AER_TAU_SW_v);             
-  Kokkos::deep_copy(AER_TAU_LW_v_h,    AER_TAU_LW_v);             
   // Construct the grid needed for input:
   auto loc_comm = spa_horiz_interp.m_comm.split(spa_horiz_interp.m_comm.rank());
-  auto grid = std::make_shared<PointGrid>("grid",spa_horiz_interp.source_grid_ncols,spa_horiz_interp.source_grid_nlevs,loc_comm);
-  PointGrid::dofs_list_type dof_gids("",spa_horiz_interp.source_grid_ncols);
-  Kokkos::parallel_for("", spa_horiz_interp.source_grid_ncols, KOKKOS_LAMBDA (const int& ii) {
+  auto grid = std::make_shared<PointGrid>("grid",ncols,nlevs,loc_comm);
+  PointGrid::dofs_list_type dof_gids("",ncols);
+  Kokkos::parallel_for("", ncols, KOKKOS_LAMBDA (const int& ii) {
     dof_gids(ii) = ii;
   });
   grid->set_dofs(dof_gids);
 
   using namespace ShortFieldTagsNames;
-  FieldLayout scalar2d_layout_mid { {COL}, {spa_horiz_interp.source_grid_ncols} };
-  FieldLayout scalar3d_layout_mid { {COL,LEV}, {spa_horiz_interp.source_grid_ncols, spa_horiz_interp.source_grid_nlevs} };
-  FieldLayout scalar3d_swband_layout { {COL,SWBND, LEV}, {spa_horiz_interp.source_grid_ncols, nswbands, spa_horiz_interp.source_grid_nlevs} }; 
-  FieldLayout scalar3d_lwband_layout { {COL,LWBND, LEV}, {spa_horiz_interp.source_grid_ncols, nlwbands, spa_horiz_interp.source_grid_nlevs} };
-  std::vector<std::string>           fnames;
+  FieldLayout scalar2d_layout_mid { {COL}, {ncols} };
+  FieldLayout scalar3d_layout_mid { {COL,LEV}, {ncols, nlevs} };
+  FieldLayout scalar3d_swband_layout { {COL,SWBND, LEV}, {ncols, nswbands, nlevs} };
+  FieldLayout scalar3d_lwband_layout { {COL,LWBND, LEV}, {ncols, nlwbands, nlevs} };
   std::map<std::string,view_1d_host> host_views;
   std::map<std::string,FieldLayout>  layouts;
-  // Define each input variable we need
-  fnames.push_back("PS");
-  host_views["PS"] = view_1d_host(PS_v_h.data(),PS_v_h.size());//view_h("",spa_horiz_interp.source_grid_ncols);
-  layouts.emplace("PS", scalar2d_layout_mid);
-  //
-  fnames.push_back("CCN3");
-  host_views["CCN3"] = view_1d_host(CCN3_v_h.data(),CCN3_v_h.size());
-  layouts.emplace("CCN3",scalar3d_layout_mid);
-  //
-  fnames.push_back("AER_G_SW");
-  host_views["AER_G_SW"] = view_1d_host(AER_G_SW_v_h.data(),AER_G_SW_v_h.size());
-  layouts.emplace("AER_G_SW",scalar3d_swband_layout);
-  //
-  fnames.push_back("AER_SSA_SW");
-  host_views["AER_SSA_SW"] = view_1d_host(AER_SSA_SW_v_h.data(),AER_SSA_SW_v_h.size());
-  layouts.emplace("AER_SSA_SW",scalar3d_swband_layout);
-  //
-  fnames.push_back("AER_TAU_SW");
-  host_views["AER_TAU_SW"] = view_1d_host(AER_TAU_SW_v_h.data(),AER_TAU_SW_v_h.size());
-  layouts.emplace("AER_TAU_SW",scalar3d_swband_layout);
-  //
-  fnames.push_back("AER_TAU_LW");
-  host_views["AER_TAU_LW"] = view_1d_host(AER_TAU_LW_v_h.data(),AER_TAU_LW_v_h.size());
-  layouts.emplace("AER_TAU_LW",scalar3d_lwband_layout);
-  //
-  
+  for (const auto& name : var_names) {
+    if (name=="PS") {
+      layouts.emplace(name,scalar2d_layout_mid);
+    } else if (name=="CCN3") {
+      layouts.emplace(name,scalar3d_layout_mid);
+    } else if (name=="AER_TAU_LW") {
+      layouts.emplace(name,scalar3d_lwband_layout);
+    } else {
+      layouts.emplace(name,scalar3d_swband_layout);
+    }
+    // Allocate the host storage, unless the caller already did it
+    auto& v = source_data[name];
+    const Int size = layouts.at(name).size();
+    if (v.size()!=static_cast<size_t>(size)) {
+      v = view_1d_host(name,size);
+    }
+    host_views[name] = v;
+  }
+
   // Now that we have all the variables defined we can use the scorpio_input class to grab the data.
   ekat::ParameterList spa_data_in_params;
-  spa_data_in_params.set("Fields",fnames);
+  spa_data_in_params.set("Fields",var_names);
   spa_data_in_params.set("Filename",spa_data_file_name);
   AtmosphereInput spa_data_input(loc_comm,spa_data_in_params,grid,host_views,layouts);
   spa_data_input.read_variables(time_index);
   spa_data_input.finalize();
- 
+} // END read_spa_vars_from_file
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::remap_spa_data(
+    const Int                                 nswbands,
+    const Int                                 nlwbands,
+    const SPAHorizInterp&                     spa_horiz_interp,
+    const std::map<std::string,view_1d_host>& source_data,
+          SPAData&                            spa_data)
+{
+  // The source data, as read from file, is stored in flattened (LayoutRight) host views:
+  //   PS(ncol), CCN3(ncol,nlev), AER_*_SW(ncol,nswband,nlev), AER_TAU_LW(ncol,nlwband,nlev)
+  const Int nlevs = spa_horiz_interp.source_grid_nlevs;
+  const auto& PS_v_h         = source_data.at("PS");
+  const auto& CCN3_v_h       = source_data.at("CCN3");
+  const auto& AER_G_SW_v_h   = source_data.at("AER_G_SW");
+  const auto& AER_SSA_SW_v_h = source_data.at("AER_SSA_SW");
+  const auto& AER_TAU_SW_v_h = source_data.at("AER_TAU_SW");
+  const auto& AER_TAU_LW_v_h = source_data.at("AER_TAU_LW");
+
   // Now that we have the data we can map the data onto the target data.
   auto ps_h         = Kokkos::create_mirror_view(spa_data.PS);
   auto ccn3_h       = Kokkos::create_mirror_view(spa_data.CCN3);
@@ -539,7 +565,6 @@ void SPAFunctions<S,D>
   Kokkos::deep_copy(aer_tau_sw_h,0.0);
   Kokkos::deep_copy(aer_tau_lw_h,0.0);
 
-  const Int nk_pack = ekat::npack<Spack>(spa_horiz_interp.source_grid_nlevs);
   auto weights_h         = Kokkos::create_mirror_view(spa_horiz_interp.weights);
   auto source_grid_loc_h = Kokkos::create_mirror_view(spa_horiz_interp.source_grid_loc);
   auto target_grid_loc_h = Kokkos::create_mirror_view(spa_horiz_interp.target_grid_loc);
@@ -553,20 +578,21 @@ void SPAFunctions<S,D>
     // PS is defined only over columns
     ps_h(tgt_col) += PS_v_h(src_col)*src_wgt;
     // CCN3 and all AER variables have levels
-    for (int kk=0; kk<spa_horiz_interp.source_grid_nlevs; kk++) {
+    for (int kk=0; kk<nlevs; kk++) {
       // Note, all variables we map to are packed, while all the data we just loaded as
       // input are in real N-D views.  So we need to back out the indices for the target
       // data.
       int pack = kk / Spack::n; 
       int kidx = kk % Spack::n;
-      ccn3_h(tgt_col,pack)[kidx] += CCN3_v_h(src_col,kk)*src_wgt;
+      ccn3_h(tgt_col,pack)[kidx] += CCN3_v_h(src_col*nlevs+kk)*src_wgt;
       for (int n=0; n<nswbands; n++) {
-        aer_g_sw_h(tgt_col,n,pack)[kidx]   += AER_G_SW_v_h(src_col,n,kk)*src_wgt;
-        aer_ssa_sw_h(tgt_col,n,pack)[kidx] += AER_SSA_SW_v_h(src_col,n,kk)*src_wgt;
-        aer_tau_sw_h(tgt_col,n,pack)[kidx] += AER_TAU_SW_v_h(src_col,n,kk)*src_wgt;
+        const int src_idx = (src_col*nswbands+n)*nlevs+kk;
+        aer_g_sw_h(tgt_col,n,pack)[kidx]   += AER_G_SW_v_h(src_idx)*src_wgt;
+        aer_ssa_sw_h(tgt_col,n,pack)[kidx] += AER_SSA_SW_v_h(src_idx)*src_wgt;
+        aer_tau_sw_h(tgt_col,n,pack)[kidx] += AER_TAU_SW_v_h(src_idx)*src_wgt;
       }
       for (int n=0; n<nlwbands; n++) {
-        aer_tau_lw_h(tgt_col,n,pack)[kidx] += AER_TAU_LW_v_h(src_col,n,kk)*src_wgt;
+        aer_tau_lw_h(tgt_col,n,pack)[kidx] += AER_TAU_LW_v_h((src_col*nlwbands+n)*nlevs+kk)*src_wgt;
       }
     }
   }
@@ -576,11 +602,66 @@ void SPAFunctions<S,D>
   Kokkos::deep_copy(spa_data.AER_SSA_SW,aer_ssa_sw_h);
   Kokkos::deep_copy(spa_data.AER_TAU_SW,aer_tau_sw_h);
   Kokkos::deep_copy(spa_data.AER_TAU_LW,aer_tau_lw_h);
+} // END remap_spa_data
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::update_spa_data_from_file(
+    const std::string&    spa_data_file_name,
+    const Int             time_index,
+    const Int             nswbands,
+    const Int             nlwbands,
+          SPAHorizInterp& spa_horiz_interp,
+          SPAData&        spa_data)
+{
+  // To construct the grid we need to determine the number of columns and levels in the data file.
+  scorpio::register_file(spa_data_file_name,scorpio::Read);
+  Int ncol = scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"ncol");
+  spa_horiz_interp.source_grid_nlevs = scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"lev");
+  // while we have the file open, check that the dimensions map the simulation and the horizontal interpolation structure
+  EKAT_REQUIRE_MSG(nswbands==scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"swband"),"ERROR update_spa_data_from_file: Number of SW bands in simulation doesn't match the SPA data file");
+  EKAT_REQUIRE_MSG(nlwbands==scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"lwband"),"ERROR update_spa_data_from_file: Number of LW bands in simulation doesn't match the SPA data file");
+  EKAT_REQUIRE_MSG(ncol==spa_horiz_interp.source_grid_ncols,"ERROR update_spa_data_from_file: Number of columns in remap data doesn't match the SPA data file");
 
+  // Read all the variables at once into local host arrays, which hold the "coarse"
+  // resolution data, and then horizontally interpolate them onto the simulation grid
+  // using the remap data.
+  std::map<std::string,view_1d_host> source_data;
+  read_spa_vars_from_file(spa_data_file_name,time_index,nswbands,nlwbands,spa_horiz_interp,spa_var_names(),source_data);
+  remap_spa_data(nswbands,nlwbands,spa_horiz_interp,source_data,spa_data);
 } // END update_spa_data_from_file
 /*-----------------------------------------------------------------*/
 template<typename S, typename D>
 void SPAFunctions<S,D>
+::update_spa_prefetch(
+    const std::string&    spa_data_file_name,
+    const Int             nswbands,
+    const Int             nlwbands,
+    const SPAHorizInterp& spa_horiz_interp,
+          SPAPrefetch&    prefetch)
+{
+  // Nothing to do if no month is being prefetched, or if we are done
+  if (prefetch.month==0 or prefetch.ready) {
+    return;
+  }
+
+  // Read one variable per call, so that the cost of reading a month of data
+  // is spread over several time steps. Once all the variables are read,
+  // horizontally remap them onto the simulation grid.
+  const auto names = spa_var_names();
+  const Int num_vars = names.size();
+  if (prefetch.num_read<num_vars) {
+    read_spa_vars_from_file(spa_data_file_name,prefetch.month,nswbands,nlwbands,spa_horiz_interp,
+                            {names[prefetch.num_read]},prefetch.source_data);
+    ++prefetch.num_read;
+  } else {
+    remap_spa_data(nswbands,nlwbands,spa_horiz_interp,prefetch.source_data,prefetch.data);
+    prefetch.ready = true;
+  }
+} // END update_spa_prefetch
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
 ::update_spa_timestate(
   const std::string&     spa_data_file_name,
   const Int              nswbands,
@@ -589,8 +670,10 @@ void SPAFunctions<S,D>
         SPAHorizInterp&  spa_horiz_interp,
         SPATimeState&    time_state, 
         SPAData&         spa_beg,
-        SPAData&         spa_end)
+        SPAData&         spa_end,
+        SPAPrefetch*     prefetch)
 {
+  auto next_month_of = [](const Int m) { return m==12 ? 1 : m+1; };
 
   // We always want to update the current time in the time_state.
   time_state.t_now = ts.frac_of_year_in_days();
@@ -599,6 +682,10 @@ void SPAFunctions<S,D>
   //        any other frequency.
   const auto month = ts.get_month();
   if (month != time_state.current_month or !time_state.inited) {
+    // If we simply moved on to the following month, the data at the beginning of this
+    // month is the data we used at the end of the previous one, and we can just swap.
+    const bool month_advanced = time_state.inited and month==next_month_of(time_state.current_month);
+
     // Update the SPA time state information
     time_state.current_month = month;
     time_state.t_beg_month = util::TimeStamp({0,month,1}, {0,0,0}).frac_of_year_in_days();
@@ -608,11 +695,31 @@ void SPAFunctions<S,D>
     // NOTE: If the timestep is bigger than monthly this could cause the wrong values
     //       to be assigned.  A timestep greater than a month is very unlikely so we
     //       will proceed.
-    update_spa_data_from_file(spa_data_file_name,time_state.current_month,nswbands,nlwbands,spa_horiz_interp,spa_beg);
-    Int next_month = time_state.current_month==12 ? 1 : time_state.current_month+1;
-    update_spa_data_from_file(spa_data_file_name,next_month,nswbands,nlwbands,spa_horiz_interp,spa_end);
+    const Int next_month = next_month_of(time_state.current_month);
+    if (month_advanced) {
+      std::swap(spa_beg,spa_end);
+    } else {
+      update_spa_data_from_file(spa_data_file_name,time_state.current_month,nswbands,nlwbands,spa_horiz_interp,spa_beg);
+    }
+    if (prefetch!=nullptr and prefetch->ready and prefetch->month==next_month) {
+      // The data was already read during the previous month. Swap it in, and
+      // recycle the memory of spa_end for the next prefetch.
+      std::swap(spa_end,prefetch->data);
+    } else {
+      update_spa_data_from_file(spa_data_file_name,next_month,nswbands,nlwbands,spa_horiz_interp,spa_end);
+    }
+
+    // Start prefetching the month after next_month
+    if (prefetch!=nullptr) {
+      prefetch->month    = next_month_of(next_month);
+      prefetch->num_read = 0;
+      prefetch->ready    = false;
+    }
+
     // If time state was not initialized it is now:
     time_state.inited = true;
+  } else if (prefetch!=nullptr) {
+    update_spa_prefetch(spa_data_file_name,nswbands,nlwbands,spa_horiz_interp,*prefetch);
   }
 
 } // END updata_spa_timestate
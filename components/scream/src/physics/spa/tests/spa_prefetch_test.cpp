@@ -0,0 +1,117 @@
+#include "catch2/catch.hpp"
+
+#include "share/io/scream_scorpio_interface.hpp"
+#include "physics/spa/spa_functions.hpp"
+
+#include "ekat/ekat_pack.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+namespace {
+
+using namespace scream;
+using namespace spa;
+
+using SPAFunc = spa::SPAFunctions<Real, DefaultDevice>;
+
+template <typename S>
+using view_1d = typename KokkosTypes<DefaultDevice>::template view_1d<S>;
+
+// Check that two SPAData structures store the same values
+template<typename ViewT>
+bool same_values (const ViewT& v1, const ViewT& v2) {
+  auto v1_h = Kokkos::create_mirror_view(v1);
+  auto v2_h = Kokkos::create_mirror_view(v2);
+  Kokkos::deep_copy(v1_h,v1);
+  Kokkos::deep_copy(v2_h,v2);
+  const int n = v1.size()*sizeof(typename ViewT::value_type)/sizeof(Real);
+  const Real* d1 = reinterpret_cast<const Real*>(v1_h.data());
+  const Real* d2 = reinterpret_cast<const Real*>(v2_h.data());
+  for (int i=0; i<n; ++i) {
+    if (d1[i]!=d2[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void check_same_data (const SPAFunc::SPAData& d1, const SPAFunc::SPAData& d2) {
+  REQUIRE (same_values(d1.PS,d2.PS));
+  REQUIRE (same_values(d1.CCN3,d2.CCN3));
+  REQUIRE (same_values(d1.AER_G_SW,d2.AER_G_SW));
+  REQUIRE (same_values(d1.AER_SSA_SW,d2.AER_SSA_SW));
+  REQUIRE (same_values(d1.AER_TAU_SW,d2.AER_TAU_SW));
+  REQUIRE (same_values(d1.AER_TAU_LW,d2.AER_TAU_LW));
+}
+
+TEST_CASE("spa_prefetch","spa")
+{
+  // Set up the mpi communicator and init the pio subsystem
+  ekat::Comm spa_comm(MPI_COMM_WORLD);
+  MPI_Fint fcomm = MPI_Comm_c2f(spa_comm.mpi_comm());
+  scorpio::eam_init_pio_subsystem(fcomm);
+
+  using gid_type = SPAFunc::gid_type;
+
+  // The test file has data for 3 months
+  std::string spa_data_file = "spa_data_for_testing.nc";
+  std::string spa_remap_file = "spa_data_for_testing.nc";
+  Int ncols    = 48;
+  Int nlevs    = 4;
+  Int nswbands = 2;
+  Int nlwbands = 3;
+  auto comm_size = spa_comm.size();
+  auto comm_rank = spa_comm.rank();
+
+  int my_ncols = ncols/comm_size + (comm_rank < ncols%comm_size ? 1 : 0);
+  view_1d<gid_type> dofs_gids("",my_ncols);
+  gid_type min_dof = 1; // Start global-ids from 1
+  Kokkos::parallel_for("", my_ncols, KOKKOS_LAMBDA(const int& ii) {
+    dofs_gids(ii) = min_dof + static_cast<gid_type>(comm_rank + ii*comm_size);
+  });
+
+  SPAFunc::SPAHorizInterp spa_horiz_interp;
+  spa_horiz_interp.m_comm = spa_comm;
+  SPAFunc::get_remap_weights_from_file(spa_remap_file,ncols,min_dof,dofs_gids,spa_horiz_interp);
+
+  SPAFunc::SPATimeState time_state;
+  SPAFunc::SPAData spa_beg(my_ncols, nlevs, nswbands, nlwbands);
+  SPAFunc::SPAData spa_end(my_ncols, nlevs, nswbands, nlwbands);
+  SPAFunc::SPAPrefetch prefetch(my_ncols, nlevs, nswbands, nlwbands);
+
+  // Start in January: this reads months 1 and 2, and starts prefetching month 3
+  util::TimeStamp ts(2000,1,1,0,0,0);
+  SPAFunc::update_spa_timestate(spa_data_file,nswbands,nlwbands,ts,spa_horiz_interp,
+                                time_state,spa_beg,spa_end,&prefetch);
+  REQUIRE (time_state.current_month==1);
+  REQUIRE (prefetch.month==3);
+  REQUIRE (not prefetch.ready);
+
+  // Each step within the month reads one variable; one more step remaps the data.
+  const int nvars = SPAFunc::spa_var_names().size();
+  for (int step=0; step<=nvars; ++step) {
+    REQUIRE (not prefetch.ready);
+    ts += 86400;
+    SPAFunc::update_spa_timestate(spa_data_file,nswbands,nlwbands,ts,spa_horiz_interp,
+                                  time_state,spa_beg,spa_end,&prefetch);
+    REQUIRE (time_state.current_month==1);
+  }
+  REQUIRE (prefetch.ready);
+
+  // Move to February: the data must be the same as if read directly from file
+  ts = util::TimeStamp(2000,2,1,0,0,0);
+  SPAFunc::update_spa_timestate(spa_data_file,nswbands,nlwbands,ts,spa_horiz_interp,
+                                time_state,spa_beg,spa_end,&prefetch);
+  REQUIRE (time_state.current_month==2);
+
+  SPAFunc::SPAData tgt_beg(my_ncols, nlevs, nswbands, nlwbands);
+  SPAFunc::SPAData tgt_end(my_ncols, nlevs, nswbands, nlwbands);
+  SPAFunc::update_spa_data_from_file(spa_data_file,2,nswbands,nlwbands,spa_horiz_interp,tgt_beg);
+  SPAFunc::update_spa_data_from_file(spa_data_file,3,nswbands,nlwbands,spa_horiz_interp,tgt_end);
+  check_same_data(spa_beg,tgt_beg);
+  check_same_data(spa_end,tgt_end);
+
+  // All Done
+  scorpio::eam_pio_finalize();
+}
+
+} // anonymous namespace
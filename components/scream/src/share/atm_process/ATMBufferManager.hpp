@@ -2,6 +2,7 @@
 #define SCREAM_ATM_BUFFERS_MANAGER_HPP
 
 #include "share/scream_types.hpp"
+#include "share/util/scream_memory_placement.hpp"
 #include "ekat/ekat_assert.hpp"
 
 namespace scream {
@@ -17,6 +18,8 @@ struct ATMBufferManager {
   {
     m_size      = 0;
     m_allocated = false;
+    m_placement = MemoryPlacement::Default;
+    m_num_cols  = 1;
   }
 
   ~ATMBufferManager() = default;
@@ -37,10 +40,23 @@ struct ATMBufferManager {
 
   int allocated_bytes () const { return m_size*sizeof(Real); }
 
+  // Set how the buffer memory is placed (see MemoryPlacement). The buffer is
+  // carved into views of different layouts by the different processes, so the
+  // first touch can only be approximate: the buffer is split evenly across the
+  // columns, so that pages are spread across NUMA domains in the same proportions
+  // as the physics kernels' threads.
+  void set_memory_placement (const MemoryPlacement placement, const int num_cols) {
+    ekat::error::runtime_check(!m_allocated, "Error! Cannot set memory placement after allocation.\n");
+    ekat::error::runtime_check(num_cols>0, "Error! Number of columns must be positive.\n");
+
+    m_placement = placement;
+    m_num_cols  = num_cols;
+  }
+
   void allocate () {
     ekat::error::runtime_check(!m_allocated, "Error! Cannot call 'allocate' more than once.\n");
 
-    m_buffer = view_1d<Real>("",m_size);
+    m_buffer = allocate_placed_view<view_1d<Real>>("",m_size,m_placement,m_num_cols);
     m_allocated = true;
   }
 
@@ -48,9 +64,11 @@ struct ATMBufferManager {
 
 protected:
 
-  view_1d<Real> m_buffer;
-  int           m_size;
-  bool          m_allocated;
+  view_1d<Real>   m_buffer;
+  int             m_size;
+  bool            m_allocated;
+  MemoryPlacement m_placement;
+  int             m_num_cols;
 };
 
 } // scream
@@ -34,6 +34,15 @@ void AtmosphereProcess::run (const int dt) {
   update_time_stamps ();
 }
 
+void AtmosphereProcess::skip_run (const int dt) {
+  skip_run_impl(dt);
+
+  // The computed fields keep their values, which are now considered valid
+  // at the end of this step.
+  m_time_stamp += dt;
+  update_time_stamps ();
+}
+
 void AtmosphereProcess::finalize (/* what inputs? */) {
   finalize_impl(/* what inputs? */);
 }
@@ -287,6 +296,21 @@ void AtmosphereProcess::update_time_stamps () {
   for (auto& f : m_fields_out) {
     f.get_header().get_tracking().update_time_stamp(t);
   }
+
+  // The process may have written its outputs through views obtained before
+  // the last host/device sync, so let the fields know that they changed.
+  for (const auto& f : m_fields_out) {
+    f.modify<Device>();
+  }
+  for (const auto& g : m_groups_out) {
+    if (g.m_bundle) {
+      g.m_bundle->modify<Device>();
+    } else {
+      for (const auto& it : g.m_fields) {
+        it.second->modify<Device>();
+      }
+    }
+  }
 }
 
 void AtmosphereProcess::add_me_as_provider (const Field<Real>& f) {
@@ -99,6 +99,18 @@ public:
   void run (const int dt);
   void finalize   (/* what inputs? */);
 
+  // Advance the time stamp of the process (and of its computed fields) by dt,
+  // without running it. This is used by AtmosphereProcessGroup for processes
+  // that are not run at every step (see atmosphere_process_group.hpp).
+  void skip_run (const int dt);
+
+  // A process can ask to be told the wall time spent by the other processes in its
+  // group at every step (e.g., the dynamics, to balance its partition by physics cost).
+  // If measures_group_cost returns true, AtmosphereProcessGroup times the other
+  // processes at that step, and passes the time (in seconds) to add_group_cost.
+  virtual bool measures_group_cost () const { return false; }
+  virtual void add_group_cost (const double /* seconds */) {}
+
   // Return the MPI communicator
   const ekat::Comm& get_comm () const { return m_comm; }
 
@@ -270,6 +282,11 @@ protected:
   // Override this method to finalize the derived class
   virtual void finalize_impl(/* what inputs? */) = 0;
 
+  // Override this method if the derived class needs to do something when a
+  // step is skipped (see skip_run). This method is called before the
+  // timestamp is updated.
+  virtual void skip_run_impl(const int /* dt */) {}
+
   // This provides access to this process's timestamp.
   const TimeStamp& timestamp() const { return m_time_stamp; }
 
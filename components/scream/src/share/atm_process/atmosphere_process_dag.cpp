@@ -12,7 +12,8 @@ create_dag(const group_type& atm_procs,
   cleanup ();
 
   // Create the nodes
-  add_nodes(atm_procs,field_mgrs);
+  add_nodes(atm_procs,field_mgrs,true);
+  m_num_proc_nodes = m_nodes.size();
 
   // Add a 'begin' and 'end' placeholders. While they are not actual
   // nodes of the graph, they come handy when representing inputs
@@ -325,8 +326,74 @@ void AtmProcDAG::write_dag (const std::string& fname, const int verbosity) const
   ofile.close();
 }
 
+std::map<FieldIdentifier,AtmProcDAG::lifetime_type>
+AtmProcDAG::compute_field_lifetimes (const std::set<std::string>& persistent) const
+{
+  EKAT_REQUIRE_MSG (m_nodes.size()>0,
+    "Error! You need to create the dag before computing field lifetimes.\n");
+
+  // Any field needed by the placeholder nodes (begin/end of time step,
+  // surface coupling) must hold its value across time steps.
+  std::set<int> needed_outside;
+  for (int id=m_num_proc_nodes; id<static_cast<int>(m_nodes.size()); ++id) {
+    const auto& n = m_nodes[id];
+    needed_outside.insert(n.computed.begin(),n.computed.end());
+    needed_outside.insert(n.required.begin(),n.required.end());
+  }
+
+  // On the steps where a process is skipped, its outputs keep the value of its
+  // last run, which may be several steps old. Likewise, a subcycled process may
+  // read back its own outputs from the previous subcycle.
+  for (int id=0; id<m_num_proc_nodes; ++id) {
+    const auto& n = m_nodes[id];
+    if (not n.runs_once) {
+      needed_outside.insert(n.computed.begin(),n.computed.end());
+    }
+  }
+
+  // Scan the process nodes in the order they are run, and track
+  // the first writer and the last access of each field
+  constexpr int none = -1;
+  std::vector<int> first_computed(m_fids.size(),none);
+  std::vector<int> last_access(m_fids.size(),none);
+  std::vector<bool> required_before_computed(m_fids.size(),false);
+  std::vector<bool> required_after_computed(m_fids.size(),false);
+  for (int id=0; id<m_num_proc_nodes; ++id) {
+    const auto& n = m_nodes[id];
+    for (auto fid : n.required) {
+      if (first_computed[fid]==none) {
+        required_before_computed[fid] = true;
+      } else {
+        required_after_computed[fid] = true;
+      }
+      last_access[fid] = id;
+    }
+    for (auto fid : n.computed) {
+      // Note: if this node also requires the field, it reads it before
+      //       computing it, which was already detected above.
+      if (first_computed[fid]==none) {
+        first_computed[fid] = id;
+      }
+      last_access[fid] = id;
+    }
+  }
+
+  std::map<FieldIdentifier,lifetime_type> lifetimes;
+  for (int fid=0; fid<static_cast<int>(m_fids.size()); ++fid) {
+    if (first_computed[fid]==none || required_before_computed[fid] ||
+        not required_after_computed[fid] || ekat::contains(needed_outside,fid) ||
+        ekat::contains(persistent,m_fids[fid].name())) {
+      continue;
+    }
+    lifetimes.emplace(m_fids[fid],lifetime_type(first_computed[fid],last_access[fid]));
+  }
+
+  return lifetimes;
+}
+
 void AtmProcDAG::cleanup () {
   m_nodes.clear();
+  m_num_proc_nodes = 0;
   m_fid_to_last_provider.clear();
   m_unmet_deps.clear();
   m_has_unmet_deps = false;
@@ -334,7 +401,8 @@ void AtmProcDAG::cleanup () {
 
 void AtmProcDAG::
 add_nodes (const group_type& atm_procs,
-           const std::map<std::string,std::shared_ptr<FieldManager<Real>>>& field_mgrs) {
+           const std::map<std::string,std::shared_ptr<FieldManager<Real>>>& field_mgrs,
+           const bool runs_once) {
   
   const int num_procs = atm_procs.get_num_processes();
   const bool sequential = (atm_procs.get_schedule_type()==ScheduleType::Sequential);
@@ -344,6 +412,9 @@ add_nodes (const group_type& atm_procs,
   int id = m_nodes.size();
   for (int i=0; i<num_procs; ++i) {
     const auto proc = atm_procs.get_process(i);
+    const bool proc_runs_once = runs_once &&
+                                atm_procs.get_num_subcycles(i)==1 &&
+                                atm_procs.get_run_frequency(i)==1;
     const bool is_group = (proc->type()==AtmosphereProcessType::Group);
     if (is_group) {
       auto group = std::dynamic_pointer_cast<const group_type>(proc);
@@ -352,7 +423,7 @@ add_nodes (const group_type& atm_procs,
       // Add all the stuff in the group.
       // Note: no need to add remappers for this process, because
       //       the sub-group will have its remappers taken care of
-      add_nodes(*group,field_mgrs);
+      add_nodes(*group,field_mgrs,proc_runs_once);
     } else {
       // Create a node for the process
       // Node& node = m_nodes[proc->name()];
@@ -360,6 +431,7 @@ add_nodes (const group_type& atm_procs,
       Node& node = m_nodes.back();;
       node.id = id;
       node.name = proc->name();
+      node.runs_once = proc_runs_once;
       m_unmet_deps[id].clear();
 
       // Input fields
@@ -386,7 +458,12 @@ add_nodes (const group_type& atm_procs,
       }
 
       // Input groups
+      // Note: groups can only be retrieved once the field managers have ended
+      //       registration. If no field manager was passed, skip them.
       for (const auto& itg : proc->get_required_group_requests()) {
+        if (field_mgrs.size()==0) {
+          break;
+        }
         EKAT_REQUIRE_MSG (field_mgrs.find(itg.grid)!=field_mgrs.end(),
             "Error! Field manager not found for this group request.\n"
             "       Group name: " + itg.name + "\n"
@@ -435,6 +512,9 @@ add_nodes (const group_type& atm_procs,
 
       // Output groups
       for (const auto& itg : proc->get_computed_group_requests()) {
+        if (field_mgrs.size()==0) {
+          break;
+        }
         EKAT_REQUIRE_MSG (field_mgrs.find(itg.grid)!=field_mgrs.end(),
             "Error! Field manager not found for this group request.\n"
             "       Group name: " + itg.name + "\n"
@@ -14,6 +14,12 @@ public:
   using group_type = AtmosphereProcessGroup;
   static constexpr int VERB_MAX = 4;
 
+  // The lifetime of a field within an atm time step, as the interval
+  // [first,last] of dag nodes during which the field must hold its value
+  using lifetime_type = std::pair<int,int>;
+
+  // Note: if field_mgrs is empty, group requests are not processed. This allows
+  //       to create the dag before the field managers have ended registration.
   void create_dag (const group_type& atm_procs,
                    const std::map<std::string,std::shared_ptr<FieldManager<Real>>>& field_mgrs);
 
@@ -27,12 +33,30 @@ public:
     return m_unmet_deps;
   }
 
+  // Compute the lifetime of all the fields that do not need to hold their value
+  // outside of the atm time step. A field qualifies if the first node computing it
+  // does not require it, and if it is required by some later node. Its lifetime
+  // goes from the first node computing it to the last node computing/requiring it.
+  // All other fields (inputs from the previous step, fields that are computed but
+  // never used within the step, and the fields in persistent) are not returned.
+  // Neither are the fields computed by a process that does not run exactly once
+  // per atm step (see 'Run Frequency' and 'Number of Subcycles' in the process
+  // group): on the steps where it is skipped, they must keep their last value.
+  // Note: fields that are only accessed via groups are not seen by the dag if it
+  //       was created without field managers, so the caller must treat them as
+  //       persistent.
+  std::map<FieldIdentifier,lifetime_type>
+  compute_field_lifetimes (const std::set<std::string>& persistent) const;
+
 protected:
 
   void cleanup ();
 
+  // If runs_once is false, the whole group is subcycled or skipped on some steps
+  // by its parent group, so the same holds for all of its processes.
   void add_nodes (const group_type& atm_procs,
-                  const std::map<std::string,std::shared_ptr<FieldManager<Real>>>& field_mgrs);
+                  const std::map<std::string,std::shared_ptr<FieldManager<Real>>>& field_mgrs,
+                  const bool runs_once);
 
   // Add fid to list of fields in the dag, and return its position.
   // If already stored, simply return its position
@@ -52,6 +76,7 @@ protected:
     std::set<int>     required;     // input  fields
     std::set<int>     gr_computed;  // output groups
     std::set<int>     gr_required;  // input  groups
+    bool              runs_once = true; // false if subcycled or not run every step
   };
 
   // Assign an id to each field identifier
@@ -69,6 +94,10 @@ protected:
 
   // The nodes in the atm DAG
   std::vector<Node>               m_nodes;
+
+  // The number of nodes corresponding to atm processes. These are the
+  // first nodes in m_nodes, and they appear in the order they are run.
+  int                             m_num_proc_nodes;
 };
 
 } // namespace scream
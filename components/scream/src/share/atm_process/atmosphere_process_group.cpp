@@ -1,11 +1,52 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/util/scream_universal_constants.hpp"
 
 #include "ekat/std_meta/ekat_std_utils.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 
+#include <chrono>
+
 namespace scream {
 
+namespace {
+
+using view_1d = KokkosTypes<DefaultDevice>::view_1d<Real>;
+using RangePolicy = KokkosTypes<DefaultDevice>::RangePolicy;
+
+// Flat view of all the entries of a (contiguous) field
+view_1d flat_view (const Field<Real>& f) {
+  const int n = f.get_header().get_alloc_properties().get_num_scalars();
+  return view_1d(f.get_internal_view_data(),n);
+}
+
+// tend = f
+void store_state (const Field<Real>& f, const view_1d& tend) {
+  const auto v = flat_view(f);
+  Kokkos::deep_copy(tend,v);
+}
+
+// tend = (f - tend) / dt
+void compute_tendency (const Field<Real>& f, const view_1d& tend, const Real dt) {
+  const auto v = flat_view(f);
+  const Real inv_dt = 1/dt;
+  Kokkos::parallel_for(RangePolicy(0,v.extent(0)),
+                       KOKKOS_LAMBDA(const int i) {
+    tend(i) = (v(i) - tend(i))*inv_dt;
+  });
+}
+
+// f += dt*tend
+void apply_tendency (const Field<Real>& f, const view_1d& tend, const Real dt) {
+  const auto v = flat_view(f);
+  Kokkos::parallel_for(RangePolicy(0,v.extent(0)),
+                       KOKKOS_LAMBDA(const int i) {
+    v(i) += dt*tend(i);
+  });
+}
+
+} // anonymous namespace
+
 AtmosphereProcessGroup::
 AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
@@ -78,6 +119,21 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
 
     m_group_name += " ";
     m_group_name += m_atm_processes.back()->name();
+
+    // Get the scheduling options of this process
+    ProcessSchedule sched;
+    sched.num_subcycles = params_i.get<int>("Number of Subcycles",1);
+    sched.run_frequency = params_i.get<int>("Run Frequency",1);
+    EKAT_REQUIRE_MSG (sched.num_subcycles>0,
+        "Error! Invalid 'Number of Subcycles' for process " + process_name + ".\n"
+        "  - value: " + std::to_string(sched.num_subcycles) + "\n");
+    EKAT_REQUIRE_MSG (sched.run_frequency>0,
+        "Error! Invalid 'Run Frequency' for process " + process_name + ".\n"
+        "  - value: " + std::to_string(sched.run_frequency) + "\n");
+    EKAT_REQUIRE_MSG (m_group_schedule_type==ScheduleType::Sequential ||
+                      (sched.num_subcycles==1 && sched.run_frequency==1),
+        "Error! Subcycling and run frequency are only supported in sequential schedule.\n");
+    m_schedules.push_back(sched);
   }
 }
 
@@ -112,6 +168,49 @@ void AtmosphereProcessGroup::initialize_impl () {
   for (auto& atm_proc : m_atm_processes) {
     atm_proc->initialize(timestamp());
   }
+
+  // For processes that do not run at every step, we need to store the tendencies
+  // they apply to their updated fields, so that we can re-apply them on the
+  // steps where they are not run.
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    auto& sched = m_schedules[iproc];
+    if (sched.run_frequency==1) {
+      continue;
+    }
+
+    const auto& atm_proc = m_atm_processes[iproc];
+    auto add_updated = [&] (const Field<Real>& f) {
+      if (ekat::contains(sched.updated_fields,f)) {
+        return;
+      }
+      const auto& fid = f.get_header().get_identifier();
+      EKAT_REQUIRE_MSG (f.get_header().get_alloc_properties().contiguous(),
+          "Error! Run Frequency>1 requires updated fields to be contiguous.\n"
+          "   field id: " + fid.get_id_string() + "\n"
+          "   atm process: " + atm_proc->name() + "\n");
+      sched.updated_fields.push_back(f);
+      sched.tendencies.emplace_back(fid.name()+"_tend",
+          f.get_header().get_alloc_properties().get_num_scalars());
+    };
+
+    for (const auto& f : atm_proc->get_fields_out()) {
+      if (ekat::contains(atm_proc->get_fields_in(),f)) {
+        add_updated(f);
+      }
+    }
+    for (const auto& g : atm_proc->get_groups_out()) {
+      if (not atm_proc->requires_group(g.m_info->m_group_name,g.grid_name())) {
+        continue;
+      }
+      if (g.m_bundle) {
+        add_updated(*g.m_bundle);
+      } else {
+        for (const auto& it : g.m_fields) {
+          add_updated(*it.second);
+        }
+      }
+    }
+  }
 }
 
 void AtmosphereProcessGroup::run_impl (const int dt) {
@@ -123,13 +222,91 @@ void AtmosphereProcessGroup::run_impl (const int dt) {
 }
 
 void AtmosphereProcessGroup::run_sequential (const Real dt) {
-  // Get the timestamp at the beginning of the step and advance it.
-  auto ts = timestamp();
-  ts += dt;
+  // The index of this step within the day. Processes with Run Frequency N run
+  // on the steps whose index is a multiple of N, which only depends on the
+  // time stamp, so that restarted runs make the same choices.
+  const int idt = dt;
+  const int step_of_day = timestamp().sec_of_day() / idt;
+
+  // If some process wants the cost of the others (see measures_group_cost), time them
+  std::vector<std::shared_ptr<atm_proc_type>> cost_consumers;
+  for (const auto& atm_proc : m_atm_processes) {
+    if (atm_proc->measures_group_cost()) {
+      cost_consumers.push_back(atm_proc);
+    }
+  }
+  double group_cost = 0;
+
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    auto& atm_proc = m_atm_processes[iproc];
+    auto& sched = m_schedules[iproc];
+    const int nfields = sched.updated_fields.size();
+
+    const bool timed = not cost_consumers.empty() &&
+                       not ekat::contains(cost_consumers,atm_proc);
+    std::chrono::steady_clock::time_point start;
+    if (timed) {
+      Kokkos::fence();
+      start = std::chrono::steady_clock::now();
+    }
+
+    EKAT_REQUIRE_MSG (constants::seconds_per_day % (idt*sched.run_frequency) == 0,
+        "Error! Run Frequency times dt does not divide a day.\n"
+        "   atm process: " + atm_proc->name() + "\n"
+        "   dt: " + std::to_string(idt) + "\n"
+        "   run frequency: " + std::to_string(sched.run_frequency) + "\n");
+
+    const bool do_run = step_of_day % sched.run_frequency == 0;
+    EKAT_REQUIRE_MSG (do_run || sched.has_tendencies || nfields==0,
+        "Error! Process with Run Frequency>1 has no tendencies to apply.\n"
+        "   The (re)start time must be a multiple of Run Frequency times dt into the day.\n"
+        "   atm process: " + atm_proc->name() + "\n"
+        "   time stamp: " + timestamp().to_string() + "\n"
+        "   run frequency: " + std::to_string(sched.run_frequency) + "\n");
+
+    if (do_run) {
+      // Save the state of the updated fields, to compute the tendencies later
+      for (int i=0; i<nfields; ++i) {
+        store_state(sched.updated_fields[i],sched.tendencies[i]);
+      }
+
+      // Run the process
+      EKAT_REQUIRE_MSG (idt % sched.num_subcycles == 0,
+          "Error! Time step is not divisible by the number of subcycles.\n"
+          "   atm process: " + atm_proc->name() + "\n"
+          "   dt: " + std::to_string(idt) + "\n"
+          "   num subcycles: " + std::to_string(sched.num_subcycles) + "\n");
+      const int sub_dt = idt / sched.num_subcycles;
+      for (int isub=0; isub<sched.num_subcycles; ++isub) {
+        atm_proc->run(sub_dt);
+      }
+
+      for (int i=0; i<nfields; ++i) {
+        compute_tendency(sched.updated_fields[i],sched.tendencies[i],dt);
+      }
+      sched.has_tendencies = true;
+    } else {
+      // Re-apply the tendencies from the last run, and advance the time stamps
+      for (int i=0; i<nfields; ++i) {
+        apply_tendency(sched.updated_fields[i],sched.tendencies[i],dt);
+      }
+      atm_proc->skip_run(dt);
+    }
+
+    if (timed) {
+      Kokkos::fence();
+      group_cost += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+  }
+
+  for (auto& atm_proc : cost_consumers) {
+    atm_proc->add_group_cost(group_cost);
+  }
+}
 
+void AtmosphereProcessGroup::skip_run_impl (const int dt) {
   for (auto atm_proc : m_atm_processes) {
-    // Run the process
-    atm_proc->run(dt);
+    atm_proc->skip_run(dt);
   }
 }
 
@@ -22,6 +22,22 @@ namespace scream
  *  The only caveat is required fields in sequential scheduling: if an atm proc
  *  requires a field that is computed by a previous atm proc in the group,
  *  that field is not exposed as a required field of the group.
+ *
+ *  In sequential scheduling, each process can also specify, in its own
+ *  parameter list, how often it runs relative to the group:
+ *   - "Number of Subcycles" (default 1): the process is run M times at every
+ *     step of the group, each time with dt/M. The group dt must be divisible by M.
+ *   - "Run Frequency" (default 1): the process is only run every N steps of the
+ *     group. On the other steps, the tendencies that the process applied to its
+ *     updated fields (required and computed) during its last run are applied
+ *     again, while the fields it only computes keep the values from its last run.
+ *     The time stamps of the process and of its computed fields are advanced at
+ *     every step regardless. The steps where the process runs are those starting
+ *     at a multiple of N*dt seconds into the day, so that a restarted run makes
+ *     the same choices as the original one. Hence, N*dt must divide a day, and
+ *     the run must start on one of those steps (the tendencies are not restarted).
+ *  The two can be combined: a process with both M>1 and N>1 subcycles M times
+ *  on the steps where it runs.
  */
 
 class AtmosphereProcessGroup : public AtmosphereProcess
@@ -57,6 +73,10 @@ public:
 
   ScheduleType get_schedule_type () const { return m_group_schedule_type; }
 
+  // How many times the i-th process runs per group step, and every how many group steps
+  int get_num_subcycles (const int i) const { return m_schedules.at(i).num_subcycles; }
+  int get_run_frequency (const int i) const { return m_schedules.at(i).run_frequency; }
+
   // Initialize memory buffer for each process
   void initialize_atm_memory_buffer (ATMBufferManager& memory_buffer);
 
@@ -79,6 +99,9 @@ protected:
   void run_sequential (const Real dt);
   void run_parallel   (const Real dt);
 
+  // Skipping a step of the group means skipping it for all its processes
+  void skip_run_impl (const int dt);
+
   // The methods to set the fields/groups in the right processes of the group
   void set_required_field_impl (const Field<const Real>& f);
   void set_computed_field_impl (const Field<      Real>& f);
@@ -97,6 +120,19 @@ protected:
 
   // The schedule type: Parallel vs Sequential
   ScheduleType   m_group_schedule_type;
+
+  // How each process is run within a step of the group (see comment at the top)
+  struct ProcessSchedule {
+    int num_subcycles = 1;
+    int run_frequency = 1;
+
+    // Only used if run_frequency>1: the fields updated by the process, and
+    // the tendencies that the process applied to them during its last run.
+    std::vector<Field<Real>>                                updated_fields;
+    std::vector<KokkosTypes<DefaultDevice>::view_1d<Real>>  tendencies;
+    bool has_tendencies = false;
+  };
+  std::vector<ProcessSchedule>  m_schedules;
 };
 
 } // namespace scream
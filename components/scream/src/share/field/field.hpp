@@ -4,6 +4,7 @@
 #include "share/field/field_header.hpp"
 #include "share/field/field_property_check.hpp"
 #include "share/util/pointer_list.hpp"
+#include "share/util/scream_memory_placement.hpp"
 #include "share/scream_types.hpp"
 
 #include "ekat/ekat_type_traits.hpp"
@@ -11,6 +12,7 @@
 #include "ekat/kokkos/ekat_kokkos_utils.hpp"
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 
+#include <cstdint>  // For std::int64_t
 #include <memory>   // For std::shared_ptr
 
 namespace scream
@@ -22,6 +24,24 @@ enum HostOrDevice {
   Host
 };
 
+// Counters of the host/device syncs of all fields, for debugging purposes.
+// Syncs that find the target side already up to date do not copy anything,
+// and only increment num_skipped.
+struct FieldSyncStats {
+  std::int64_t num_to_host   = 0;
+  std::int64_t num_to_dev    = 0;
+  std::int64_t num_skipped   = 0;
+  std::int64_t bytes_to_host = 0;
+  std::int64_t bytes_to_dev  = 0;
+
+  void reset () { *this = FieldSyncStats(); }
+};
+
+inline FieldSyncStats& field_sync_stats () {
+  static FieldSyncStats stats;
+  return stats;
+}
+
 // ======================== FIELD ======================== //
 
 // A field is composed of metadata info (the header) and a pointer to a view.
@@ -153,18 +173,34 @@ public:
   //   - The field is a subfield of another field. In this case, this class
   //     actually stores the "parent" field view. So when calling this method,
   //     you will actually get the raw pointer of the parent field view.
+  // Since writes through the returned pointer cannot be tracked, if RT is
+  // not const, syncs from the HD side will always copy the data from now on.
   template<HostOrDevice HD = Device>
   RT* get_internal_view_data () const {
+    if (!std::is_const<RT>::value) {
+      set_untracked(HD);
+    }
     return get_view_impl<HD>().data();
   }
 
   // If someone needs the host view, some sync routines might be needed.
-  // Note: this class takes no responsibility in keeping track of whether
-  //       a sync is required in either direction. Mainly because we expect
-  //       host views to be seldom used, and even less frequently modified.
+  // The syncs only copy the data if the source side may have been modified
+  // since the last sync. A side is flagged as modified when a non-const view
+  // of it is requested (via get_view or deep_copy), or when calling modify.
+  // Note: a non-const view obtained *before* a sync can still be used to
+  //       modify the data, but that will go unnoticed. If you cache views,
+  //       call modify<HD>() after writing through them. Atm processes do this
+  //       automatically for their computed fields at the end of each run.
+  // Note: sync_to_host only checks the device side. Changes made on host
+  //       are not discarded, unless the device was modified as well.
   void sync_to_host () const;
   void sync_to_dev () const;
 
+  // Flag the data on the HD side as modified, so that the next sync
+  // from that side will copy the data.
+  template<HostOrDevice HD = Device>
+  void modify () const;
+
   // Set the field to a constant value (on host or device)
   template<HostOrDevice HD = Device>
   void deep_copy (const RT value);
@@ -229,8 +265,13 @@ public:
 
   // ---- Setters and non-const methods ---- //
 
-  // Allocate the actual view
-  void allocate_view ();
+  // Allocate the actual view. If the field has columns, the memory can be
+  // placed according to the given placement (see MemoryPlacement).
+  void allocate_view (const MemoryPlacement placement = MemoryPlacement::Default);
+
+  // Use the first entries of storage as the view of this field, rather than
+  // allocating a new view. This allows fields to share memory (see FieldManager).
+  void allocate_view (const view_type<RT*>& storage);
 
 protected:
 
@@ -284,6 +325,23 @@ protected:
        get_view_type<view_ND_type<T,N>,HD>>
   get_ND_view () const;
 
+  void set_untracked (const HostOrDevice hd) const {
+    if (hd==Device) {
+      m_sync_state->dev_untracked = true;
+    } else {
+      m_sync_state->host_untracked = true;
+    }
+  }
+
+  // Whether host and device data may differ, in either direction. An
+  // "untracked" side may be modified at any time (see get_internal_view_data).
+  struct SyncState {
+    bool host_modified  = false;
+    bool dev_modified   = true;
+    bool host_untracked = false;
+    bool dev_untracked  = false;
+  };
+
   // Metadata (name, rank, dims, customere/providers, time stamp, ...)
   std::shared_ptr<header_type>            m_header;
 
@@ -294,6 +352,9 @@ protected:
   // the same host mirror of parents.
   std::shared_ptr<HM<view_type<RT*>>>     m_view_h;
 
+  // Host/device sync state. Shared by all fields storing the same views.
+  std::shared_ptr<SyncState>              m_sync_state;
+
   // List of property checks for this field.
   std::shared_ptr<property_check_list>    m_prop_checks;
 };
@@ -314,6 +375,7 @@ Field ()
   // Create an empty host mirror view
   // Note: this is needed cause 'ensure_host_view' cannot modify this class
   m_view_h = std::make_shared<HM<view_type<RT*>>>();
+  m_sync_state = std::make_shared<SyncState>();
 }
 
 template<typename RealType>
@@ -328,6 +390,7 @@ Field (const identifier_type& id)
   // Create an empty host mirror view
   // Note: this is needed cause 'ensure_host_view' cannot modify this class
   m_view_h = std::make_shared<HM<view_type<RT*>>>();
+  m_sync_state = std::make_shared<SyncState>();
 }
 
 template<typename RealType>
@@ -337,6 +400,7 @@ Field (const Field<SrcRealType>& src)
  : m_header (src.get_header_ptr())
  , m_view_d (src.m_view_d)
  , m_view_h (src.m_view_h)
+ , m_sync_state (src.m_sync_state)
  , m_prop_checks (src.m_prop_checks)
 {
   using src_field_type = Field<SrcRealType>;
@@ -388,6 +452,7 @@ operator= (const Field<SrcRT>& src) {
     m_header = src.m_header;
     m_view_d = src.m_view_d;
     m_view_h = src.m_view_h;
+    m_sync_state = src.m_sync_state;
     m_prop_checks = src.m_prop_checks;
   }
 
@@ -450,6 +515,11 @@ auto Field<RealType>::get_view () const
   EKAT_REQUIRE_MSG (DstRankDynamic>0 || alloc_prop.contiguous(),
       "Error! Cannot use all compile-time dimensions for strided views.\n");
 
+  // A non-const view may be used to modify the data
+  if (!std::is_const<DstValueType>::value) {
+    modify<HD>();
+  }
+
   return DstView(view_ND);
 }
 
@@ -462,7 +532,21 @@ sync_to_host () const {
 
   // Ensure host view was created (lazy construction)
   ensure_host_view ();
+
+  auto& state = *m_sync_state;
+  auto& stats = field_sync_stats();
+  if (!state.dev_modified && !state.dev_untracked) {
+    ++stats.num_skipped;
+    return;
+  }
+
   Kokkos::deep_copy(*m_view_h,m_view_d);
+  state.host_modified = state.dev_modified = false;
+
+  ++stats.num_to_host;
+  if (m_view_h->data()!=m_view_d.data()) {
+    stats.bytes_to_host += m_view_d.size()*sizeof(RT);
+  }
 }
 
 template<typename RealType>
@@ -474,7 +558,32 @@ sync_to_dev () const {
 
   // Ensure host view was created (lazy construction)
   ensure_host_view ();
+
+  auto& state = *m_sync_state;
+  auto& stats = field_sync_stats();
+  if (!state.host_modified && !state.host_untracked) {
+    ++stats.num_skipped;
+    return;
+  }
+
   Kokkos::deep_copy(m_view_d,*m_view_h);
+  state.host_modified = state.dev_modified = false;
+
+  ++stats.num_to_dev;
+  if (m_view_h->data()!=m_view_d.data()) {
+    stats.bytes_to_dev += m_view_d.size()*sizeof(RT);
+  }
+}
+
+template<typename RealType>
+template<HostOrDevice HD>
+void Field<RealType>::
+modify () const {
+  if (HD==Device) {
+    m_sync_state->dev_modified = true;
+  } else {
+    m_sync_state->host_modified = true;
+  }
 }
 
 template<typename RealType>
@@ -493,35 +602,35 @@ deep_copy (const field_type& field_src) {
     case 1:
       {
         auto v     = get_view<RT*,HD>();
-        auto v_src = field_src.get_view<RT*,HD>();
+        auto v_src = field_src.get_view<const_RT*,HD>();
         Kokkos::deep_copy(v,v_src);
       }
       break;
     case 2:
       {
         auto v     = get_view<RT**,HD>();
-        auto v_src = field_src.get_view<RT**,HD>();
+        auto v_src = field_src.get_view<const_RT**,HD>();
         Kokkos::deep_copy(v,v_src);
       }
       break;
     case 3:
       {
         auto v     = get_view<RT***,HD>();
-        auto v_src = field_src.get_view<RT***,HD>();
+        auto v_src = field_src.get_view<const_RT***,HD>();
         Kokkos::deep_copy(v,v_src);
       }
       break;
     case 4:
       {
         auto v     = get_view<RT****,HD>();
-        auto v_src = field_src.get_view<RT****,HD>();
+        auto v_src = field_src.get_view<const_RT****,HD>();
         Kokkos::deep_copy(v,v_src);
       }
       break;
     case 5:
       {
         auto v     = get_view<RT*****,HD>();
-        auto v_src = field_src.get_view<RT*****,HD>();
+        auto v_src = field_src.get_view<const_RT*****,HD>();
         Kokkos::deep_copy(v,v_src);
       }
       break;
@@ -605,6 +714,7 @@ subfield (const std::string& sf_name, const ekat::units::Units& sf_units,
   sf.m_header = create_subfield_header(sf_id,m_header,idim,index,dynamic);
   sf.m_view_d = m_view_d;
   sf.m_view_h = m_view_h;
+  sf.m_sync_state = m_sync_state;
   sf.m_prop_checks = std::make_shared<property_check_list>();
 
   return sf;
@@ -665,7 +775,7 @@ Field<RealType>::equivalent(const Field<RhsRT>& rhs) const
 }
 
 template<typename RealType>
-void Field<RealType>::allocate_view ()
+void Field<RealType>::allocate_view (const MemoryPlacement placement)
 {
   // Not sure if simply returning would be safe enough. Re-allocating
   // would definitely be error prone (someone may have already gotten
@@ -689,7 +799,40 @@ void Field<RealType>::allocate_view ()
   // Create the view, by quering allocation properties for the allocation size
   const int view_dim = alloc_prop.get_alloc_size() / sizeof(RT);
 
-  m_view_d = decltype(m_view_d)(id.name(),view_dim);
+  // Placement only makes sense for fields distributed over columns
+  const bool has_cols = layout->rank()>0 && layout->tag(0)==FieldTag::Column;
+  if (has_cols) {
+    m_view_d = allocate_placed_view<decltype(m_view_d)>(id.name(),view_dim,placement,layout->dim(0));
+  } else {
+    m_view_d = decltype(m_view_d)(id.name(),view_dim);
+  }
+}
+
+template<typename RealType>
+void Field<RealType>::allocate_view (const view_type<RT*>& storage)
+{
+  EKAT_REQUIRE_MSG(!is_allocated(), "Error! View was already allocated.\n");
+
+  const auto& id     = m_header->get_identifier();
+  const auto& layout = id.get_layout_ptr();
+  auto& alloc_prop   = m_header->get_alloc_properties();
+
+  EKAT_REQUIRE_MSG(layout->are_dimensions_set(),
+      "Error! Cannot allocate the view until all the field's dimensions are set.\n");
+
+  // Commit the allocation properties (does nothing if already committed)
+  alloc_prop.commit(layout);
+
+  const int view_dim = alloc_prop.get_alloc_size() / sizeof(RT);
+  EKAT_REQUIRE_MSG(static_cast<int>(storage.size())>=view_dim,
+      "Error! Input storage is too small for field '" + id.name() + "'.\n"
+      "  - storage size: " + std::to_string(storage.size()) + "\n"
+      "  - field size  : " + std::to_string(view_dim) + "\n");
+
+  m_view_d = Kokkos::subview(storage,Kokkos::make_pair(0,view_dim));
+
+  // Other fields can write to the same storage, without us knowing
+  m_sync_state->dev_untracked = true;
 }
 
 template<typename RealType>
@@ -711,6 +854,7 @@ auto Field<RealType>::get_ND_view () const ->
     f.m_header = parent;
     f.m_view_d = m_view_d;
     f.m_view_h = m_view_h;  // Make sure we share the same host view ptr.
+    f.m_sync_state = m_sync_state;
 
     auto v_np1 = f.get_ND_view<HD,T,N+1>();
 
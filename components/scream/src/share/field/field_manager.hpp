@@ -16,9 +16,12 @@
 
 #include <algorithm>
 #include <initializer_list>
+#include <list>
 #include <map>
 #include <memory>
+#include <ostream>
 #include <set>
+#include <vector>
 
 namespace scream
 {
@@ -69,6 +72,25 @@ public:
   void registration_ends ();
   void clean_up ();
 
+  // Set how the memory of the fields is placed (see MemoryPlacement). A field
+  // gets the placement of the first group containing it that has one set,
+  // or the default placement otherwise. Must be called before registration_ends.
+  void set_memory_placement (const MemoryPlacement placement);
+  void set_memory_placement (const std::string& group_name, const MemoryPlacement placement);
+
+  // Set the lifetime of fields within an atm time step, as an interval [first,last]
+  // of atm process indices (see AtmProcDAG::compute_field_lifetimes). At registration_ends,
+  // fields whose lifetimes do not overlap are allocated in the same memory pool.
+  // Only fields that are not in any group and that have no subfields are aliased.
+  // Must be called before registration_ends.
+  void set_field_lifetimes (const std::map<std::string,std::pair<int,int>>& lifetimes);
+
+  // Whether the field shares its memory with other fields (i.e., it is in a memory pool).
+  // Such a field only holds its value during its lifetime within the atm time step.
+  bool is_aliased (const std::string& name) const;
+
+  // Print the memory used by the fields, with and without aliasing, and the memory pools.
+  void print_memory_report (std::ostream& out) const;
 
   // Get information about the state of the repo
   int size () const { return m_fields.size(); }
@@ -105,6 +127,9 @@ protected:
 
   void pre_process_group_requests ();
 
+  // Allocate the fields in m_field_lifetimes that can share memory, in memory pools
+  void allocate_memory_pools ();
+
   // The state of the repository
   RepoState           m_repo_state;
 
@@ -128,6 +153,21 @@ protected:
 
   // The grid where the fields in this FM live
   std::shared_ptr<const AbstractGrid> m_grid;
+
+  // The memory placement of fields not in any of the groups in m_group_placement
+  MemoryPlacement m_default_placement;
+
+  // The memory placement of the fields in each group
+  std::map<ci_string,MemoryPlacement> m_group_placement;
+
+  // The lifetime of the fields that are candidates for aliasing, and the
+  // fields in each of the memory pools built at registration_ends
+  std::map<ci_string,std::pair<int,int>>  m_field_lifetimes;
+  std::vector<std::list<ci_string>>       m_memory_pools;
+
+  // The memory used by the fields, without and with aliasing (in bytes)
+  long long m_bytes_requested;
+  long long m_bytes_allocated;
 };
 
 // ============================== IMPLEMENTATION ============================= //
@@ -137,6 +177,9 @@ FieldManager<RealType>::
 FieldManager (const grid_ptr_type& grid)
   : m_repo_state (RepoState::Clean)
   , m_grid       (grid)
+  , m_default_placement (MemoryPlacement::Default)
+  , m_bytes_requested (0)
+  , m_bytes_allocated (0)
 {
   EKAT_REQUIRE_MSG (m_grid!=nullptr,
       "Error! Input grid pointer is not valid.");
@@ -412,6 +455,174 @@ void FieldManager<RealType>::registration_begins ()
   m_repo_state = RepoState::Open;
 }
 
+template<typename RealType>
+void FieldManager<RealType>::
+set_memory_placement (const MemoryPlacement placement)
+{
+  EKAT_REQUIRE_MSG(m_repo_state!=RepoState::Closed,
+      "Error! Cannot set the memory placement after registration has completed.\n");
+
+  m_default_placement = placement;
+}
+
+template<typename RealType>
+void FieldManager<RealType>::
+set_memory_placement (const std::string& group_name, const MemoryPlacement placement)
+{
+  EKAT_REQUIRE_MSG(m_repo_state!=RepoState::Closed,
+      "Error! Cannot set the memory placement after registration has completed.\n");
+
+  m_group_placement[group_name] = placement;
+}
+
+template<typename RealType>
+void FieldManager<RealType>::
+set_field_lifetimes (const std::map<std::string,std::pair<int,int>>& lifetimes)
+{
+  EKAT_REQUIRE_MSG(m_repo_state!=RepoState::Closed,
+      "Error! Cannot set the field lifetimes after registration has completed.\n");
+
+  m_field_lifetimes.clear();
+  for (const auto& it : lifetimes) {
+    EKAT_REQUIRE_MSG (it.second.first<=it.second.second,
+        "Error! Invalid lifetime for field '" + it.first + "'.\n");
+    m_field_lifetimes[it.first] = it.second;
+  }
+}
+
+template<typename RealType>
+bool FieldManager<RealType>::
+is_aliased (const std::string& name) const
+{
+  EKAT_REQUIRE_MSG(m_repo_state==RepoState::Closed,
+      "Error! Cannot tell if a field is aliased until registration has completed.\n");
+
+  for (const auto& pool : m_memory_pools) {
+    if (ekat::contains(pool,ci_string(name))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template<typename RealType>
+void FieldManager<RealType>::
+print_memory_report (std::ostream& out) const
+{
+  EKAT_REQUIRE_MSG(m_repo_state==RepoState::Closed,
+      "Error! Cannot print the memory report until registration has completed.\n");
+
+  const double MB = 1024.0*1024.0;
+  out << "Fields memory on grid " << m_grid->name() << ":\n"
+      << "  - without aliasing: " << m_bytes_requested/MB << " MB\n"
+      << "  - with aliasing   : " << m_bytes_allocated/MB << " MB\n";
+  for (size_t i=0; i<m_memory_pools.size(); ++i) {
+    out << "  - memory pool " << i << ":";
+    for (const auto& fn : m_memory_pools[i]) {
+      out << " " << fn;
+    }
+    out << "\n";
+  }
+}
+
+template<typename RealType>
+void FieldManager<RealType>::
+allocate_memory_pools ()
+{
+  // We can alias a field only if it is a standalone allocation: it must not
+  // be allocated already (as part of a bundled group), must not be in any
+  // group (groups may be accessed by processes that the lifetimes do not
+  // know of), and must not be a subfield, nor the parent of a subfield.
+  auto can_alias = [&](const ci_string& fname) -> bool {
+    if (not has_field(fname) || m_fields.at(fname)->is_allocated()) {
+      return false;
+    }
+    for (const auto& it : m_field_groups) {
+      if (ekat::contains(it.second->m_fields_names,fname)) {
+        return false;
+      }
+    }
+    for (const auto& it : m_subfield_requests) {
+      if (ci_string(it.first)==fname || ci_string(it.second.parent_name)==fname) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // The alloc size of a field, in number of RT's
+  auto alloc_size = [&](const ci_string& fname) -> int {
+    auto f = m_fields.at(fname);
+    auto& ap = f->get_header().get_alloc_properties();
+    ap.commit(f->get_header().get_identifier().get_layout_ptr());
+    return ap.get_alloc_size() / sizeof(RT);
+  };
+
+  // Sort candidates by decreasing size, so that each pool is sized by its first field,
+  // and the smaller fields fill the gaps in the lifetime of the larger ones.
+  std::vector<std::pair<int,ci_string>> candidates;
+  for (const auto& it : m_field_lifetimes) {
+    if (can_alias(it.first)) {
+      candidates.emplace_back(alloc_size(it.first),it.first);
+    }
+  }
+  std::stable_sort(candidates.begin(),candidates.end(),
+                   [](const std::pair<int,ci_string>& a, const std::pair<int,ci_string>& b) {
+                     return a.first>b.first;
+                   });
+
+  // Greedily put each field in the first pool where it does not overlap any other field.
+  // Two lifetimes [a,b] and [c,d] overlap if a<=d and c<=b. In particular, two fields
+  // accessed by the same atm process always overlap.
+  m_memory_pools.clear();
+  std::vector<int> pool_sizes;
+  for (const auto& c : candidates) {
+    const auto& lt = m_field_lifetimes.at(c.second);
+    bool placed = false;
+    for (size_t ip=0; ip<m_memory_pools.size() && not placed; ++ip) {
+      bool overlap = false;
+      for (const auto& fn : m_memory_pools[ip]) {
+        const auto& other = m_field_lifetimes.at(fn);
+        if (lt.first<=other.second && other.first<=lt.second) {
+          overlap = true;
+          break;
+        }
+      }
+      if (not overlap) {
+        m_memory_pools[ip].push_back(c.second);
+        placed = true;
+      }
+    }
+    if (not placed) {
+      m_memory_pools.push_back({c.second});
+      pool_sizes.push_back(c.first);
+    }
+  }
+
+  // Allocate the pools, and let the fields view their pool. A pool with one
+  // field is simply a regular allocation, so don't store it as a pool.
+  using pool_view_type = typename field_type::template view_type<RT*>;
+  for (size_t ip=0; ip<m_memory_pools.size(); ++ip) {
+    const auto& pool = m_memory_pools[ip];
+    if (pool.size()==1) {
+      continue;
+    }
+    const auto& f0 = m_fields.at(pool.front());
+    const auto& layout = f0->get_header().get_identifier().get_layout();
+    const bool has_cols = layout.rank()>0 && layout.tag(0)==FieldTag::Column;
+    auto storage = allocate_placed_view<pool_view_type>("memory_pool_" + std::to_string(ip),
+                                                        pool_sizes[ip],
+                                                        has_cols ? m_default_placement : MemoryPlacement::Default,
+                                                        has_cols ? layout.dim(0) : 1);
+    for (const auto& fn : pool) {
+      m_fields.at(fn)->allocate_view(storage);
+    }
+  }
+  m_memory_pools.erase(std::remove_if(m_memory_pools.begin(),m_memory_pools.end(),
+                                      [](const std::list<ci_string>& p) { return p.size()==1; }),
+                       m_memory_pools.end());
+}
+
 template<typename RealType>
 void FieldManager<RealType>::
 registration_ends ()
@@ -481,6 +692,30 @@ registration_ends ()
   // of group B. It also checks that the requests are not inconsistent.
   pre_process_group_requests ();
 
+  // Memory placement of a bundled allocation of the given groups: the one of
+  // the first group that has a placement set, or the default one.
+  auto get_group_placement = [&](const std::list<std::string>& gnames) -> MemoryPlacement {
+    for (const auto& gn : gnames) {
+      auto it = m_group_placement.find(gn);
+      if (it!=m_group_placement.end()) {
+        return it->second;
+      }
+    }
+    return m_default_placement;
+  };
+
+  // Memory placement of a single field: the one of the first group
+  // containing it that has a placement set, or the default one.
+  auto get_field_placement = [&](const ci_string& fname) -> MemoryPlacement {
+    for (const auto& it : m_group_placement) {
+      auto g = m_field_groups.find(it.first);
+      if (g!=m_field_groups.end() && ekat::contains(g->second->m_fields_names,fname)) {
+        return it.second;
+      }
+    }
+    return m_default_placement;
+  };
+
   // Gather a list of groups to be bundled
   // NOTE: copied groups are always created bundled, but in a second phase,
   //       without creating individual subfields.
@@ -739,8 +974,8 @@ registration_ends ()
         }
       }
 
-      // Allocate
-      C->allocate_view();
+      // Allocate, with the placement of the first group in the cluster that has one
+      C->allocate_view(get_group_placement(cluster));
 
       // Note: as of 02/2021, idim should *always* be 1, but we store it just in case,
       //       to avoid bugs in the future.
@@ -838,7 +1073,7 @@ registration_ends ()
     for (const auto& req : m_group_requests.at(gname)) {
       G_ap.request_allocation(real_size,req.pack_size);
     }
-    G->allocate_view();
+    G->allocate_view(get_group_placement({gname}));
 
     // Now, update the group info of the copied group, by setting the
     // correct subview_idx, in case the user wants to extract the
@@ -858,16 +1093,20 @@ registration_ends ()
     info.m_bundled = true;
   }
 
+  // Fields whose lifetimes within the time step do not overlap can share memory
+  allocate_memory_pools ();
+
   for (auto& it : m_fields) {
     if (it.second->is_allocated()) {
-      // If the field has been already allocated, then it was in a bunlded group, so skip it.
+      // If the field has been already allocated, then it was in a bunlded group
+      // or in a memory pool, so skip it.
       continue;
     }
 
     // Skip requests for subfields, since we need to have all fields allocated first
     if (m_subfield_requests.find(it.first)==m_subfield_requests.end()) {
       // A brand new field. Allocate it
-      it.second->allocate_view();
+      it.second->allocate_view(get_field_placement(it.first));
     }
   }
 
@@ -881,6 +1120,25 @@ registration_ends ()
     *f = p->subfield (fid.name(),fid.get_units(),sv_info.dim_idx,sv_info.slice_idx,sv_info.dynamic);
   }
 
+  // Compute the memory used by the fields. Subfields view their parent's memory,
+  // and each memory pool is as large as its largest field.
+  m_bytes_requested = m_bytes_allocated = 0;
+  for (const auto& it : m_fields) {
+    if (it.second->get_header().get_parent().lock()==nullptr) {
+      m_bytes_requested += it.second->get_header().get_alloc_properties().get_alloc_size();
+    }
+  }
+  m_bytes_allocated = m_bytes_requested;
+  for (const auto& pool : m_memory_pools) {
+    long long max_size = 0;
+    for (const auto& fn : pool) {
+      const long long size = m_fields.at(fn)->get_header().get_alloc_properties().get_alloc_size();
+      m_bytes_allocated -= size;
+      max_size = std::max(max_size,size);
+    }
+    m_bytes_allocated += max_size;
+  }
+
   for (const auto& it : m_field_groups) {
     if (ekat::contains(copied_groups,it.first)) {
       // Copied groups use the same field names as the group they copied,
@@ -30,8 +30,8 @@ bool views_are_equal(const Field<RT1>& f1, const Field<RT2>& f2) {
   switch (l1.rank()) {
     case 1:
       {
-        auto v1 = f1.template get_view<RT1*,Host>();
-        auto v2 = f2.template get_view<RT2*,Host>();
+        auto v1 = f1.template get_view<const RT1*,Host>();
+        auto v2 = f2.template get_view<const RT2*,Host>();
         for (int i=0; i<dims[0]; ++i) {
           if (v1(i) != v2(i)) {
             return false;
@@ -41,8 +41,8 @@ bool views_are_equal(const Field<RT1>& f1, const Field<RT2>& f2) {
       break;
     case 2:
       {
-        auto v1 = f1.template get_view<RT1**,Host>();
-        auto v2 = f2.template get_view<RT2**,Host>();
+        auto v1 = f1.template get_view<const RT1**,Host>();
+        auto v2 = f2.template get_view<const RT2**,Host>();
         for (int i=0; i<dims[0]; ++i) {
           for (int j=0; j<dims[1]; ++j) {
             if (v1(i,j) != v2(i,j)) {
@@ -53,8 +53,8 @@ bool views_are_equal(const Field<RT1>& f1, const Field<RT2>& f2) {
       break;
     case 3:
       {
-        auto v1 = f1.template get_view<RT1***,Host>();
-        auto v2 = f2.template get_view<RT2***,Host>();
+        auto v1 = f1.template get_view<const RT1***,Host>();
+        auto v2 = f2.template get_view<const RT2***,Host>();
         for (int i=0; i<dims[0]; ++i) {
           for (int j=0; j<dims[1]; ++j) {
             for (int k=0; k<dims[2]; ++k) {
@@ -66,8 +66,8 @@ bool views_are_equal(const Field<RT1>& f1, const Field<RT2>& f2) {
       break;
     case 4:
       {
-        auto v1 = f1.template get_view<RT1****,Host>();
-        auto v2 = f2.template get_view<RT2****,Host>();
+        auto v1 = f1.template get_view<const RT1****,Host>();
+        auto v2 = f2.template get_view<const RT2****,Host>();
         for (int i=0; i<dims[0]; ++i) {
           for (int j=0; j<dims[1]; ++j) {
             for (int k=0; k<dims[2]; ++k) {
@@ -80,8 +80,8 @@ bool views_are_equal(const Field<RT1>& f1, const Field<RT2>& f2) {
       break;
     case 5:
       {
-        auto v1 = f1.template get_view<RT1*****,Host>();
-        auto v2 = f2.template get_view<RT2*****,Host>();
+        auto v1 = f1.template get_view<const RT1*****,Host>();
+        auto v2 = f2.template get_view<const RT2*****,Host>();
         for (int i=0; i<dims[0]; ++i) {
           for (int j=0; j<dims[1]; ++j) {
             for (int k=0; k<dims[2]; ++k) {
@@ -86,6 +86,12 @@ public:
       } else {
         do_remap_bwd ();
       }
+
+      // The remapped fields were modified on device
+      for (int i=0; i<m_num_fields; ++i) {
+        const auto& f = forward ? get_tgt_field(i) : get_src_field(i);
+        f.template modify<Device>();
+      }
     }
   }
 
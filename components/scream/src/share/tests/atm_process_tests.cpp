@@ -174,6 +174,46 @@ public:
   }
 };
 
+// Increments a field by dt at every run, and counts how many times it ran
+class Inc : public DummyProcess
+{
+public:
+  Inc (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    // Nothing to do here
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_3d_scalar_layout (true);
+
+    add_field<Updated>("Concentration A",lt,kg/pow(m,3),m_grid_name);
+  }
+
+  int num_runs () const { return m_num_runs; }
+
+protected:
+  void run_impl (const int dt) {
+    auto f = get_field_out("Concentration A");
+    f.sync_to_host();
+    auto v = f.get_view<Real**,Host>();
+    for (int i=0; i<v.extent_int(0); ++i) {
+      for (int j=0; j<v.extent_int(1); ++j) {
+        v(i,j) += dt;
+    }}
+    f.sync_to_dev();
+    ++m_num_runs;
+  }
+
+  int m_num_runs = 0;
+};
+
 // ================================ TESTS ============================== //
 
 TEST_CASE("process_factory", "") {
@@ -268,6 +308,154 @@ TEST_CASE("atm_proc_dag", "") {
 
     REQUIRE (dag.has_unmet_dependencies());
   }
+
+  // Foo computes Temperature, which Bar and Baz read. Bar computes
+  // Concentration A, which Baz reads. Temperature tendency is read by
+  // Foo before Baz computes it, so it comes from the previous step.
+  SECTION ("lifetimes") {
+    auto get_lifetimes = [&] (const ekat::ParameterList& params) {
+      std::shared_ptr<AtmosphereProcess> atm_process (factory.create("group",comm,params));
+      atm_process->set_grids(gm);
+
+      AtmProcDAG dag;
+      dag.create_dag(*std::dynamic_pointer_cast<AtmosphereProcessGroup>(atm_process),{});
+      REQUIRE (not dag.has_unmet_dependencies());
+
+      std::map<std::string,AtmProcDAG::lifetime_type> lifetimes;
+      for (const auto& it : dag.compute_field_lifetimes({})) {
+        lifetimes.emplace(it.first.name(),it.second);
+      }
+      return lifetimes;
+    };
+    using lifetime_type = AtmProcDAG::lifetime_type;
+
+    // All processes run once per step
+    auto params = create_test_params();
+    auto lifetimes = get_lifetimes(params);
+    REQUIRE (lifetimes.size()==2);
+    REQUIRE (lifetimes.at("Temperature")==lifetime_type(0,2));
+    REQUIRE (lifetimes.at("Concentration A")==lifetime_type(1,2));
+
+    // Bar is subcycled: its outputs must persist
+    params = create_test_params();
+    params.sublist("Process 1").sublist("Process 0").set("Number of Subcycles",2);
+    lifetimes = get_lifetimes(params);
+    REQUIRE (lifetimes.size()==1);
+    REQUIRE (lifetimes.at("Temperature")==lifetime_type(0,2));
+
+    // The group of Bar and Baz is skipped every other step: the outputs of
+    // all its processes must persist, but not the inputs it reads from Foo
+    params = create_test_params();
+    params.sublist("Process 1").set("Run Frequency",2);
+    lifetimes = get_lifetimes(params);
+    REQUIRE (lifetimes.size()==1);
+    REQUIRE (lifetimes.at("Temperature")==lifetime_type(0,2));
+
+    // Foo is skipped every other step: Temperature must persist
+    params = create_test_params();
+    params.sublist("Process 0").set("Run Frequency",2);
+    lifetimes = get_lifetimes(params);
+    REQUIRE (lifetimes.size()==1);
+    REQUIRE (lifetimes.at("Concentration A")==lifetime_type(1,2));
+  }
+}
+
+TEST_CASE("atm_proc_subcycling", "") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("Inc",&create_atmosphere_process<Inc>);
+  factory.register_product("grouP",&create_atmosphere_process<AtmosphereProcessGroup>);
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  // A group with a single process, which runs every 3 steps,
+  // and subcycles twice when it runs
+  ekat::ParameterList params ("Atmosphere Processes");
+  params.set("Number of Entries",1);
+  params.set<std::string>("Schedule Type","Sequential");
+  auto& p0 = params.sublist("Process 0");
+  p0.set<std::string>("Process Name", "Inc");
+  p0.set<std::string>("Grid Name", "Point Grid");
+  p0.set("Run Frequency",3);
+  p0.set("Number of Subcycles",2);
+
+  auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+  group->set_grids(gm);
+
+  // Create and set the field
+  const auto& req = *group->get_computed_field_requests().begin();
+  Field<Real> f(req.fid);
+  f.allocate_view();
+  f.deep_copy(0.0);
+  group->set_computed_field(f);
+  group->set_required_field(f.get_const());
+
+  util::TimeStamp t0 ({2000,1,1},{0,0,0});
+  group->initialize(t0);
+
+  const int dt = 10;
+  const int nsteps = 6;
+  for (int n=0; n<nsteps; ++n) {
+    group->run(dt);
+  }
+
+  // The process ran (with 2 subcycles) only at steps 0 and 3, but its
+  // tendency was applied at every step, so f is the same as if it ran
+  // at every step.
+  auto inc = std::dynamic_pointer_cast<const Inc>(group->get_process(0));
+  REQUIRE (inc->num_runs()==4);
+
+  f.sync_to_host();
+  auto v = f.get_view<Real**,Host>();
+  for (int i=0; i<v.extent_int(0); ++i) {
+    for (int j=0; j<v.extent_int(1); ++j) {
+      REQUIRE (v(i,j)==dt*nsteps);
+  }}
+
+  // All time stamps are up to date
+  REQUIRE (f.get_header().get_tracking().get_time_stamp()==t0+dt*nsteps);
+
+  group->finalize();
+
+  // Which steps run only depends on the time stamp. A group (re)started at
+  // t0+nsteps*dt runs at its first step, as the original group would have.
+  auto restarted = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+  restarted->set_grids(gm);
+  restarted->set_computed_field(f);
+  restarted->set_required_field(f.get_const());
+  restarted->initialize(t0+dt*nsteps);
+  for (int n=0; n<3; ++n) {
+    restarted->run(dt);
+  }
+  auto inc_r = std::dynamic_pointer_cast<const Inc>(restarted->get_process(0));
+  REQUIRE (inc_r->num_runs()==2);
+  f.sync_to_host();
+  for (int i=0; i<v.extent_int(0); ++i) {
+    for (int j=0; j<v.extent_int(1); ++j) {
+      REQUIRE (v(i,j)==dt*(nsteps+3));
+  }}
+  restarted->finalize();
+
+  // A group started on a step where the process does not run has no tendencies to apply
+  auto misaligned = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+  misaligned->set_grids(gm);
+  misaligned->set_computed_field(f);
+  misaligned->set_required_field(f.get_const());
+  misaligned->initialize(t0+dt);
+  REQUIRE_THROWS (misaligned->run(dt));
+
+  // Run Frequency times dt must divide a day
+  auto bad_dt = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+  bad_dt->set_grids(gm);
+  bad_dt->set_computed_field(f);
+  bad_dt->set_required_field(f.get_const());
+  bad_dt->initialize(t0);
+  REQUIRE_THROWS (bad_dt->run(14));
 }
 
 } // empty namespace
@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 #include <numeric>
+#include <sstream>
 
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 #include "share/field/field_identifier.hpp"
@@ -207,6 +208,59 @@ TEST_CASE("field", "") {
     }
   }
 
+  SECTION ("lazy_sync") {
+    Field<Real> f1 (fid);
+    f1.allocate_view();
+    f1.deep_copy(1.0);
+
+    auto& stats = field_sync_stats();
+    stats.reset();
+
+    // The first sync copies, the second finds host already up to date
+    f1.sync_to_host();
+    f1.sync_to_host();
+    REQUIRE (stats.num_to_host==1);
+    REQUIRE (stats.num_skipped==1);
+
+    // Nothing changed on host, so nothing to copy back
+    f1.sync_to_dev();
+    REQUIRE (stats.num_to_dev==0);
+    REQUIRE (stats.num_skipped==2);
+
+    // A non-const host view flags host as modified
+    auto v = f1.get_view<Real**,Host>();
+    v(0,0) = 2.0;
+    f1.sync_to_dev();
+    REQUIRE (stats.num_to_dev==1);
+
+    // A non-const device view flags device as modified...
+    auto d = f1.get_view<Real**>();
+    f1.sync_to_host();
+    REQUIRE (stats.num_to_host==2);
+
+    // ...but writing through it after a sync requires an explicit modify
+    Kokkos::deep_copy(d,3.0);
+    f1.sync_to_host();
+    REQUIRE (stats.num_to_host==2);
+    f1.modify<Device>();
+    f1.sync_to_host();
+    REQUIRE (stats.num_to_host==3);
+    REQUIRE (v(0,0)==3.0);
+
+    // Subfields share the sync state of their parent
+    auto sf = f1.subfield(0,0);
+    sf.deep_copy(4.0);
+    f1.sync_to_host();
+    REQUIRE (stats.num_to_host==4);
+    REQUIRE (v(0,0)==4.0);
+
+    // Raw pointers cannot be tracked, so syncs always copy from then on
+    f1.get_internal_view_data<Host>();
+    f1.sync_to_dev();
+    f1.sync_to_dev();
+    REQUIRE (stats.num_to_dev==3);
+  }
+
   // Subfields
   SECTION ("subfield") {
     std::vector<FieldTag> t1 = {COL,CMP,CMP,LEV};
@@ -477,6 +531,90 @@ TEST_CASE("field_mgr", "") {
   REQUIRE (views_are_equal(f5,f4.get_component(subview_slice)));
 }
 
+TEST_CASE("field_mgr_aliasing", "") {
+  using namespace scream;
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+  using FID = FieldIdentifier;
+  using FR  = FieldRequest;
+  using lifetime_t = std::pair<int,int>;
+
+  const int ncols = 4;
+  const int nlevs = 7;
+
+  std::vector<FieldTag> tags = {COL,LEV};
+  std::vector<int> dims1 = {ncols,nlevs};
+  std::vector<int> dims2 = {ncols,nlevs+1};
+
+  FID fid1("field_1", {tags, dims1}, m/s, "phys");
+  FID fid2("field_2", {tags, dims2}, m/s, "phys");
+  FID fid3("field_3", {tags, dims1}, m/s, "phys");
+  FID fid4("field_4", {tags, dims1}, m/s, "phys");
+  FID fid5("field_5", {tags, dims1}, m/s, "phys");
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto pg = create_point_grid("phys",ncols*comm.size(),nlevs,comm);
+  FieldManager<Real> field_mgr(pg);
+
+  field_mgr.registration_begins();
+  field_mgr.register_field(FR(fid1));
+  field_mgr.register_field(FR(fid2));
+  field_mgr.register_field(FR(fid3));
+  field_mgr.register_field(FR(fid4));
+  field_mgr.register_field(FR(fid5,"group_1"));
+
+  // field_1 and field_2 do not overlap, but field_3 overlaps both.
+  // field_4 has no lifetime, and field_5 is in a group, so neither is aliased.
+  std::map<std::string,lifetime_t> lifetimes;
+  lifetimes["field_1"] = lifetime_t(0,1);
+  lifetimes["field_2"] = lifetime_t(2,3);
+  lifetimes["field_3"] = lifetime_t(1,2);
+  lifetimes["field_5"] = lifetime_t(4,5);
+  REQUIRE_THROWS (field_mgr.set_field_lifetimes({{"field_1",lifetime_t(1,0)}}));
+  field_mgr.set_field_lifetimes(lifetimes);
+  field_mgr.registration_ends();
+
+  // Cannot change lifetimes after registration ends
+  REQUIRE_THROWS (field_mgr.set_field_lifetimes(lifetimes));
+
+  // Only field_1 and field_2 share memory
+  REQUIRE (field_mgr.is_aliased("field_1"));
+  REQUIRE (field_mgr.is_aliased("field_2"));
+  REQUIRE (not field_mgr.is_aliased("field_3"));
+  REQUIRE (not field_mgr.is_aliased("field_4"));
+  REQUIRE (not field_mgr.is_aliased("field_5"));
+
+  auto f1 = field_mgr.get_field(fid1.name());
+  auto f2 = field_mgr.get_field(fid2.name());
+  auto f3 = field_mgr.get_field(fid3.name());
+  auto f4 = field_mgr.get_field(fid4.name());
+  auto f5 = field_mgr.get_field(fid5.name());
+
+  // Fields in the same pool start at the beginning of the pool
+  const auto d1 = f1.get_view<Real**>().data();
+  const auto d2 = f2.get_view<Real**>().data();
+  REQUIRE (d1==d2);
+  for (auto f : {f3,f4,f5}) {
+    REQUIRE (f.get_view<Real**>().data()!=d1);
+  }
+
+  // Writing to a field in the pool is visible from the other fields in the pool
+  f2.deep_copy(1.0);
+  f1.sync_to_host();
+  auto h1 = f1.get_view<Real**,Host>();
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int ilev=0; ilev<nlevs; ++ilev) {
+      REQUIRE (h1(icol,ilev)==1.0);
+    }
+  }
+
+  // The report lists the fields in each pool
+  std::stringstream ss;
+  field_mgr.print_memory_report(ss);
+  REQUIRE (ss.str().find("field_1")!=std::string::npos);
+  REQUIRE (ss.str().find("field_3")==std::string::npos);
+}
+
 TEST_CASE("tracers_bundle", "") {
   using namespace scream;
   using namespace ekat::units;
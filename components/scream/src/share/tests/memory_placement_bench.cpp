@@ -0,0 +1,122 @@
+#include <catch2/catch.hpp>
+
+#include "share/util/scream_memory_placement.hpp"
+#include "share/util/scream_test_params.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_pack.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include <iostream>
+
+// Memory bandwidth benchmark for the allocation policies in MemoryPlacement.
+// For each placement, it allocates three (ncols,nlev) arrays, and runs a
+// triad a = b + s*c with one team per column, as the physics kernels do.
+// On multi-socket nodes with OpenMP, the first touch placements should
+// show a higher bandwidth than the default Kokkos allocation.
+// The problem size can be changed via the test params, e.g.
+//   ./memory_placement --ekat-test-params ncols=4096,nlevs=72,nreps=50
+// The defaults are ncols=2048, nlevs=128, nreps=20.
+
+namespace {
+
+using namespace scream;
+
+using KT         = KokkosTypes<DefaultDevice>;
+using Spack      = ekat::Pack<Real,SCREAM_PACK_SIZE>;
+using view_1d    = KT::view_1d<Real>;
+using ExeSpace   = KT::ExeSpace;
+using MemberType = KT::MemberType;
+
+// Runs the triad nreps times on views allocated with the given
+// placement, and returns the bandwidth in GB/s
+double run_triad (const MemoryPlacement placement,
+                  const int ncols, const int nlevs, const int nreps)
+{
+  const int npacks = ekat::npack<Spack>(nlevs);
+  const int size = ncols*npacks*Spack::n;
+
+  auto a = allocate_placed_view<view_1d>("a",size,placement,ncols);
+  auto b = allocate_placed_view<view_1d>("b",size,placement,ncols);
+  auto c = allocate_placed_view<view_1d>("c",size,placement,ncols);
+
+  // The views must be zero initialized, regardless of the placement
+  int nonzero = 0;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<ExeSpace>(0,size),
+                          KOKKOS_LAMBDA(const int i, int& n) {
+    n += (a(i)!=0) + (b(i)!=0) + (c(i)!=0);
+  },nonzero);
+  REQUIRE (nonzero==0);
+
+  using pack_view = ekat::Unmanaged<KT::view_2d<Spack>>;
+  pack_view av(reinterpret_cast<Spack*>(a.data()),ncols,npacks);
+  pack_view bv(reinterpret_cast<Spack*>(b.data()),ncols,npacks);
+  pack_view cv(reinterpret_cast<Spack*>(c.data()),ncols,npacks);
+  Kokkos::deep_copy(bv,Spack(1));
+  Kokkos::deep_copy(cv,Spack(2));
+
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncols,npacks);
+  auto triad = KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,npacks),
+                         [&](const int k) {
+      av(icol,k) = bv(icol,k) + 0.5*cv(icol,k);
+    });
+  };
+
+  // Warm up
+  Kokkos::parallel_for(policy,triad);
+  Kokkos::fence();
+
+  Kokkos::Timer timer;
+  for (int i=0; i<nreps; ++i) {
+    Kokkos::parallel_for(policy,triad);
+  }
+  Kokkos::fence();
+  const double t = timer.seconds() / nreps;
+
+  // Check the result
+  int nbad = 0;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<ExeSpace>(0,size),
+                          KOKKOS_LAMBDA(const int i, int& n) {
+    n += (a(i)!=2);
+  },nbad);
+  REQUIRE (nbad==0);
+
+  // Three arrays moved per triad
+  return t>0 ? 3.0*size*sizeof(Real)/t/1e9 : 0;
+}
+
+} // anonymous namespace
+
+TEST_CASE("memory_placement") {
+  using namespace scream;
+
+  SECTION ("names") {
+    for (auto p : {MemoryPlacement::Default,
+                   MemoryPlacement::FirstTouch,
+                   MemoryPlacement::FirstTouchHugePages}) {
+      REQUIRE (str2memory_placement(e2str(p))==p);
+    }
+    REQUIRE (str2memory_placement("first touch")==MemoryPlacement::FirstTouch);
+    REQUIRE_THROWS (str2memory_placement("Interleaved"));
+  }
+
+  SECTION ("triad_bandwidth") {
+    const int ncols = get_test_param("ncols",2048);
+    const int nlevs = get_test_param("nlevs",128);
+    const int nreps = get_test_param("nreps",20);
+    REQUIRE (ncols>0);
+    REQUIRE (nlevs>0);
+    REQUIRE (nreps>0);
+
+    std::cout << "memory_placement: ncols=" << ncols << ", nlevs=" << nlevs
+              << ", nreps=" << nreps << ", concurrency=" << ExeSpace::concurrency() << "\n";
+    for (auto p : {MemoryPlacement::Default,
+                   MemoryPlacement::FirstTouch,
+                   MemoryPlacement::FirstTouchHugePages}) {
+      const double bw = run_triad(p,ncols,nlevs,nreps);
+      std::cout << "  " << e2str(p) << ": " << bw << " GB/s\n";
+    }
+  }
+}
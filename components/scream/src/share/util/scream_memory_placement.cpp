@@ -0,0 +1,60 @@
+#include "share/util/scream_memory_placement.hpp"
+
+#include "ekat/util/ekat_string_utils.hpp"
+
+#include <cstdint>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace scream
+{
+
+std::string e2str (const MemoryPlacement placement) {
+  switch (placement) {
+    case MemoryPlacement::Default:             return "Default";
+    case MemoryPlacement::FirstTouch:          return "First Touch";
+    case MemoryPlacement::FirstTouchHugePages: return "First Touch Huge Pages";
+    default:
+      EKAT_ERROR_MSG ("Error! Unrecognized memory placement.\n");
+  }
+  return "";
+}
+
+MemoryPlacement str2memory_placement (const std::string& name) {
+  using ci_string = ekat::CaseInsensitiveString;
+  const ci_string ci_name = name;
+  for (auto p : {MemoryPlacement::Default,
+                 MemoryPlacement::FirstTouch,
+                 MemoryPlacement::FirstTouchHugePages}) {
+    if (ci_name==ci_string(e2str(p))) {
+      return p;
+    }
+  }
+  EKAT_ERROR_MSG ("Error! Unrecognized memory placement '" + name + "'.\n"
+                  "       Valid choices: 'Default', 'First Touch', 'First Touch Huge Pages'.\n");
+  return MemoryPlacement::Default;
+}
+
+void advise_huge_pages (void* ptr, const long long num_bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  // Only whole huge pages can be advised, so shrink the range to
+  // the 2MB aligned part of [ptr,ptr+num_bytes).
+  constexpr std::uintptr_t huge_page_size = 2*1024*1024;
+  auto beg = reinterpret_cast<std::uintptr_t>(ptr);
+  auto end = beg + num_bytes;
+  beg = (beg + huge_page_size - 1) & ~(huge_page_size - 1);
+  end = end & ~(huge_page_size - 1);
+  if (end>beg) {
+    // Failure is not an error: THP may be disabled on this system,
+    // in which case we simply get regular pages.
+    madvise(reinterpret_cast<void*>(beg), end-beg, MADV_HUGEPAGE);
+  }
+#else
+  (void) ptr;
+  (void) num_bytes;
+#endif
+}
+
+} // namespace scream
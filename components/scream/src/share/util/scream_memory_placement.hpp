@@ -0,0 +1,92 @@
+#ifndef SCREAM_MEMORY_PLACEMENT_HPP
+#define SCREAM_MEMORY_PLACEMENT_HPP
+
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <string>
+
+namespace scream
+{
+
+/*
+ * How the memory of a (large, long lived) allocation is placed.
+ *
+ * On host memory, pages are placed on the NUMA domain of the thread that
+ * touches them first. Kokkos zero-initializes views with a RangePolicy, whose
+ * decomposition has nothing to do with the one of our physics kernels, which
+ * use one team per column. On multi-socket nodes, this means that many pages
+ * end up on a different domain than the threads that use them.
+ *   - Default: plain Kokkos allocation.
+ *   - FirstTouch: the view is allocated uninitialized, and then zeroed with a
+ *     TeamPolicy over columns, with the same decomposition used by the physics
+ *     kernels (see ekat::ExeSpaceUtils::get_default_team_policy).
+ *   - FirstTouchHugePages: same as FirstTouch, but the allocation is also
+ *     advised to be backed by transparent huge pages (2MB on x86), to reduce
+ *     TLB misses. Only the 2MB-aligned part of the allocation can be advised,
+ *     so this has no effect on small allocations.
+ * On device memory, FirstTouch* only changes how the view is zeroed.
+ */
+
+enum class MemoryPlacement {
+  Default,
+  FirstTouch,
+  FirstTouchHugePages
+};
+
+std::string e2str (const MemoryPlacement placement);
+MemoryPlacement str2memory_placement (const std::string& name);
+
+// Advise the OS to back the memory in [ptr,ptr+num_bytes) with huge pages.
+// Does nothing on systems without transparent huge pages.
+void advise_huge_pages (void* ptr, const long long num_bytes);
+
+// Allocate a 1d view with size entries, placed according to placement.
+// The entries are assumed to be distributed across ncols columns, in the
+// sense that column i owns the i-th chunk of size/ncols contiguous entries.
+template<typename ViewT>
+ViewT allocate_placed_view (const std::string& name, const int size,
+                            const MemoryPlacement placement, const int ncols)
+{
+  static_assert (ViewT::rank==1, "Error! Only 1d views can be placed.\n");
+
+  if (placement==MemoryPlacement::Default || size==0) {
+    return ViewT(name,size);
+  }
+  EKAT_REQUIRE_MSG (ncols>0, "Error! Invalid number of columns for a placed view.\n");
+
+  using value_type = typename ViewT::non_const_value_type;
+  using exe_space  = typename ViewT::execution_space;
+  using mem_space  = typename ViewT::memory_space;
+  using MemberType = typename ekat::KokkosTypes<typename ViewT::device_type>::MemberType;
+
+  ViewT v (Kokkos::view_alloc(name,Kokkos::WithoutInitializing),size);
+
+  if (placement==MemoryPlacement::FirstTouchHugePages &&
+      Kokkos::SpaceAccessibility<Kokkos::HostSpace,mem_space>::accessible) {
+    advise_huge_pages(v.data(),static_cast<long long>(size)*sizeof(value_type));
+  }
+
+  // Zero the view with one team per column. With a static schedule (the
+  // default for TeamPolicy), thread t gets the same range of columns it
+  // gets in the physics kernels, and therefore touches the same pages.
+  const int chunk = (size + ncols - 1) / ncols;
+  const auto policy = ekat::ExeSpaceUtils<exe_space>::get_default_team_policy(ncols, chunk);
+  Kokkos::parallel_for(name + " first touch", policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const int beg = team.league_rank()*chunk;
+    const int end = beg+chunk < size ? beg+chunk : size;
+    if (beg>=end) return;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,beg,end),
+                         [&](const int i) {
+      v(i) = value_type(0);
+    });
+  });
+  Kokkos::fence();
+
+  return v;
+}
+
+} // namespace scream
+
+#endif // SCREAM_MEMORY_PLACEMENT_HPP
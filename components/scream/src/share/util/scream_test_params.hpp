@@ -0,0 +1,36 @@
+#ifndef SCREAM_TEST_PARAMS_HPP
+#define SCREAM_TEST_PARAMS_HPP
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <sstream>
+#include <string>
+
+namespace scream {
+
+/*
+ * Return the value of a test param, or the given default if the param was
+ * not passed. Test params are given on the command line, as in
+ *   ./my_test --ekat-test-params ncols=4096,nreps=50
+ */
+template<typename T>
+T get_test_param (const std::string& name, const T& default_value)
+{
+  const auto& params = ekat::TestSession::get().params;
+  const auto it = params.find(name);
+  if (it==params.end()) {
+    return default_value;
+  }
+
+  std::istringstream ss(it->second);
+  T value;
+  ss >> value;
+  EKAT_REQUIRE_MSG (not ss.fail() && ss.eof(),
+      "Error! Could not parse test param '" + name + "=" + it->second + "'.\n");
+  return value;
+}
+
+} // namespace scream
+
+#endif // SCREAM_TEST_PARAMS_HPP
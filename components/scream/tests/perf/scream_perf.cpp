@@ -0,0 +1,837 @@
+#include "share/scream_types.hpp"
+#include "share/scream_session.hpp"
+
+#include "physics/p3/p3_f90.hpp"
+#include "physics/p3/p3_functions.hpp"
+#include "physics/p3/p3_functions_f90.hpp"
+#include "physics/p3/p3_ic_cases.hpp"
+#include "physics/shoc/shoc_f90.hpp"
+#include "physics/shoc/shoc_ic_cases.hpp"
+#include "physics/cld_fraction/cld_fraction_functions.hpp"
+#include "physics/spa/spa_functions.hpp"
+#ifdef SCREAM_PERF_HAS_RRTMGP
+# include "physics/rrtmgp/scream_rrtmgp_interface.hpp"
+# include "physics/rrtmgp/mo_garand_atmos_io.h"
+# include "physics/rrtmgp/rrtmgp_test_utils.hpp"
+# include "physics/rrtmgp/simple_netcdf.hpp"
+# include "cpp/rrtmgp/mo_gas_concentrations.h"
+# include "YAKL.h"
+#endif
+#ifdef SCREAM_PERF_HAS_HOMME
+# include "dynamics/homme/physics_dynamics_remapper.hpp"
+# include "dynamics/homme/interface/scream_homme_interface.hpp"
+# include "dynamics/homme/dynamics_driven_grids_manager.hpp"
+# include "dynamics/homme/homme_dimensions.hpp"
+# include "share/field/field.hpp"
+#endif
+
+#include "ekat/mpi/ekat_comm.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef SCREAM_PERF_GIT_SHA
+# define SCREAM_PERF_GIT_SHA "unknown"
+#endif
+
+#ifdef SCREAM_PERF_HAS_HOMME
+extern "C" {
+// From the homme tests helpers, to set up a cubed sphere mesh without a namelist
+void init_test_params_f90 ();
+void cleanup_test_f90 ();
+}
+#endif
+
+namespace {
+
+using namespace scream;
+
+/*
+ * Performance benchmarks of the scream physics processes, meant to track
+ * performance regressions across versions on a given machine. Each benchmark
+ * is run over a matrix of ncol/nlev, and the thread count is whatever Kokkos
+ * was initialized with (the ctest/scream_perf_all targets sweep it by running
+ * the executable once per thread count). The results are written as JSON, one
+ * record per (benchmark,ncol,nlev), with
+ *   - the mean and min time of one call, in seconds,
+ *   - the throughput, in columns*levels per second (based on the mean time),
+ *   - an estimate of the bandwidth, in GB/s, assuming each input/output array
+ *     is read/written exactly once per call. This is a lower bound on the
+ *     actual memory traffic, so it is only meaningful as a relative measure.
+ * Only kernel time is measured: setting up and resetting the inputs between
+ * repetitions is not timed. Benchmarks that can only run on some sizes (e.g.,
+ * the dynamics remap, whose nlev is fixed when building homme) run on the
+ * closest valid ones, and the record holds the sizes actually used.
+ * The radiation and dynamics benchmarks are only built if rrtmgp's data and
+ * homme are available, respectively.
+ */
+
+struct Record {
+  std::string name;
+  Int ncol, nlev, reps;
+  double mean_s, min_s;
+  double bytes;
+};
+
+struct Timings {
+  std::vector<double> times;
+
+  void add (const double t) { times.push_back(t); }
+
+  double mean () const {
+    double sum = 0;
+    for (const auto t : times) sum += t;
+    return sum/times.size();
+  }
+  double min () const { return *std::min_element(times.begin(), times.end()); }
+};
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_s (const Clock::time_point& start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+Record make_record (const std::string& name, const Int ncol, const Int nlev,
+                    const Timings& t, const double bytes) {
+  return Record{name, ncol, nlev, static_cast<Int>(t.times.size()), t.mean(), t.min(), bytes};
+}
+
+// ----------------------------------------------------------------------------
+// P3
+// ----------------------------------------------------------------------------
+
+// Full p3_main, with either the default (substepped) or the implicit
+// sedimentation. The inputs come from the mixed ic case.
+Record bench_p3_main (const Int ncol, const Int nlev, const Int reps, const bool implicit_sed) {
+  using namespace scream::p3;
+
+  p3_init();
+
+  Timings t;
+  double bytes = 0;
+  for (Int r = -1; r < reps; ++r) {
+    const auto d = ic::Factory::create(ic::Factory::mixed, ncol, nlev);
+    d->dt = 300;
+    d->it = 1;
+    d->do_implicit_sed = implicit_sed;
+    if (r == -1) {
+      FortranDataIterator fdi(d);
+      for (Int i = 0; i < fdi.nfield(); ++i) {
+        bytes += fdi.getfield(i).size*sizeof(Real);
+      }
+      // Warm up
+      p3_main(*d);
+      continue;
+    }
+    t.add(1e-6*p3_main(*d));
+  }
+
+  return make_record(implicit_sed ? "p3_main_implicit_sed" : "p3_main", ncol, nlev, t, bytes);
+}
+
+// Rain sedimentation alone, which is the part of P3 whose cost depends the
+// most on the time step (through the number of substeps).
+Record bench_p3_rain_sed (const Int ncol, const Int nlev, const Int reps, const bool implicit_sed) {
+  using P3F        = p3::Functions<Real, DefaultDevice>;
+  using Spack      = P3F::Spack;
+  using KT         = P3F::KT;
+  using ExeSpace   = KT::ExeSpace;
+  using MemberType = P3F::MemberType;
+  using view_2d    = P3F::view_2d<Spack>;
+
+  p3::p3_init();
+
+  const Int nk_pack = ekat::npack<Spack>(nlev);
+  const Int nk_pack_flux = ekat::npack<Spack>(nlev+1);
+  const Real dt = 300;
+  const Real inv_dt = 1/dt;
+  constexpr Int kdir = -1;
+  const Int ktop = 0;
+  const Int kbot = nlev-1;
+
+  enum { rho, inv_rho, rhofacr, cld_frac_r, inv_dz, qr_incld, qr, nr, nr_incld,
+         mu_r, lamr, qr_tend, nr_tend, num_arrays };
+  std::vector<view_2d> init(num_arrays), v(num_arrays);
+  for (int n = 0; n < num_arrays; ++n) {
+    init[n] = view_2d("init", ncol, nk_pack);
+    v[n]    = view_2d("v", ncol, nk_pack);
+  }
+  view_2d precip_liq_flux("precip_liq_flux", ncol, nk_pack_flux);
+  P3F::view_1d<Real> precip_liq_surf("precip_liq_surf", ncol);
+
+  // Levels 100 m apart, with rain in the lower half of the column, so that
+  // the rain falls through a few levels per time step
+  std::vector<decltype(Kokkos::create_mirror_view(init[0]))> h(num_arrays);
+  for (int n = 0; n < num_arrays; ++n) {
+    h[n] = Kokkos::create_mirror_view(init[n]);
+  }
+  for (Int i = 0; i < ncol; ++i) {
+    for (Int k = 0; k < nlev; ++k) {
+      const Int kp = k / Spack::n, s = k % Spack::n;
+      const Real height = (nlev-1-k)*100;
+      const Real dens = 1.2*std::exp(-height/8000);
+      const bool raining = k >= nlev/2;
+      h[rho](i,kp)[s]        = dens;
+      h[inv_rho](i,kp)[s]    = 1/dens;
+      h[rhofacr](i,kp)[s]    = std::pow(1.2/dens, 0.54);
+      h[cld_frac_r](i,kp)[s] = 1;
+      h[inv_dz](i,kp)[s]     = 1.0/100;
+      h[qr](i,kp)[s]         = raining ? 1e-4*(1 + 0.1*(i%7)) : 0;
+      h[nr](i,kp)[s]         = raining ? 1e4 : 0;
+      h[qr_incld](i,kp)[s]   = h[qr](i,kp)[s];
+      h[nr_incld](i,kp)[s]   = h[nr](i,kp)[s];
+    }
+  }
+  for (int n = 0; n < num_arrays; ++n) {
+    Kokkos::deep_copy(init[n], h[n]);
+  }
+
+  const auto vn_table_vals = p3::P3GlobalForFortran::vn_table_vals();
+  const auto vm_table_vals = p3::P3GlobalForFortran::vm_table_vals();
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, nk_pack);
+  ekat::WorkspaceManager<Spack, KT::Device> wsm(nk_pack, 4, policy);
+
+  const auto rho_d = v[rho]; const auto inv_rho_d = v[inv_rho]; const auto rhofacr_d = v[rhofacr];
+  const auto cld_frac_r_d = v[cld_frac_r]; const auto inv_dz_d = v[inv_dz];
+  const auto qr_incld_d = v[qr_incld]; const auto qr_d = v[qr]; const auto nr_d = v[nr];
+  const auto nr_incld_d = v[nr_incld]; const auto mu_r_d = v[mu_r]; const auto lamr_d = v[lamr];
+  const auto qr_tend_d = v[qr_tend]; const auto nr_tend_d = v[nr_tend];
+
+  Timings t;
+  for (Int r = -1; r < reps; ++r) {
+    for (int n = 0; n < num_arrays; ++n) {
+      Kokkos::deep_copy(v[n], init[n]);
+    }
+    Kokkos::deep_copy(precip_liq_flux, Spack(0));
+    Kokkos::deep_copy(precip_liq_surf, 0);
+    Kokkos::fence();
+
+    const auto start = Clock::now();
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const Int i = team.league_rank();
+      P3F::rain_sedimentation(
+        ekat::subview(rho_d, i), ekat::subview(inv_rho_d, i), ekat::subview(rhofacr_d, i),
+        ekat::subview(cld_frac_r_d, i), ekat::subview(inv_dz_d, i), ekat::subview(qr_incld_d, i),
+        team, wsm.get_workspace(team), vn_table_vals, vm_table_vals,
+        nlev, ktop, kbot, kdir, dt, inv_dt,
+        ekat::subview(qr_d, i), ekat::subview(nr_d, i), ekat::subview(nr_incld_d, i),
+        ekat::subview(mu_r_d, i), ekat::subview(lamr_d, i), ekat::subview(precip_liq_flux, i),
+        ekat::subview(qr_tend_d, i), ekat::subview(nr_tend_d, i),
+        precip_liq_surf(i), implicit_sed);
+    });
+    Kokkos::fence();
+    if (r >= 0) t.add(elapsed_s(start));
+  }
+
+  const double bytes = (num_arrays+1)*double(ncol)*nlev*sizeof(Real);
+  return make_record(implicit_sed ? "p3_rain_sed_implicit" : "p3_rain_sed", ncol, nlev, t, bytes);
+}
+
+// ----------------------------------------------------------------------------
+// SHOC
+// ----------------------------------------------------------------------------
+
+// One shoc_main call (nadv=1) on the standard ic case.
+Record bench_shoc_main (const Int ncol, const Int nlev, const Int reps) {
+  using namespace scream::shoc;
+
+  const Int num_qtracers = 3;
+  shoc_init(nlev, false, true);
+
+  Timings t;
+  double bytes = 0;
+  for (Int r = -1; r < reps; ++r) {
+    const auto d = ic::Factory::create(ic::Factory::standard, ncol, nlev, num_qtracers);
+    d->dtime = 300;
+    d->nadv  = 1;
+    if (r == -1) {
+      FortranDataIterator fdi(d);
+      for (Int i = 0; i < fdi.nfield(); ++i) {
+        bytes += fdi.getfield(i).size*sizeof(Real);
+      }
+      // Warm up
+      shoc_main(*d, false);
+      continue;
+    }
+    t.add(1e-6*shoc_main(*d, false));
+  }
+
+  return make_record("shoc_main", ncol, nlev, t, bytes);
+}
+
+// ----------------------------------------------------------------------------
+// CldFraction
+// ----------------------------------------------------------------------------
+
+Record bench_cld_fraction (const Int ncol, const Int nlev, const Int reps) {
+  using CFF   = cld_fraction::CldFractionFunctions<Real, DefaultDevice>;
+  using Pack  = CFF::Pack;
+  using view_2d = CFF::view_2d<Pack>;
+
+  const Int npack = ekat::npack<Pack>(nlev);
+  view_2d qi("qi", ncol, npack), liq_cld_frac("liq_cld_frac", ncol, npack),
+          ice_cld_frac("ice_cld_frac", ncol, npack), tot_cld_frac("tot_cld_frac", ncol, npack);
+
+  auto qi_h  = Kokkos::create_mirror_view(qi);
+  auto liq_h = Kokkos::create_mirror_view(liq_cld_frac);
+  for (Int i = 0; i < ncol; ++i) {
+    for (Int k = 0; k < nlev; ++k) {
+      const Int kp = k / Pack::n, s = k % Pack::n;
+      qi_h(i,kp)[s]  = (i+k)%3==0 ? 1e-5 : 0;
+      liq_h(i,kp)[s] = (i+k)%4==0 ? 0.5 : 0;
+    }
+  }
+  Kokkos::deep_copy(qi, qi_h);
+  Kokkos::deep_copy(liq_cld_frac, liq_h);
+
+  Timings t;
+  for (Int r = -1; r < reps; ++r) {
+    Kokkos::fence();
+    const auto start = Clock::now();
+    CFF::main(ncol, nlev, qi, liq_cld_frac, ice_cld_frac, tot_cld_frac);
+    Kokkos::fence();
+    if (r >= 0) t.add(elapsed_s(start));
+  }
+
+  const double bytes = 4*double(ncol)*nlev*sizeof(Real);
+  return make_record("cld_fraction", ncol, nlev, t, bytes);
+}
+
+// ----------------------------------------------------------------------------
+// SPA
+// ----------------------------------------------------------------------------
+
+// spa_main (time and vertical interpolation), with source data on the same
+// horizontal grid and with as many levels as the simulation grid, as in
+// the atm process. The interpolator is set up at every call.
+Record bench_spa_main (const Int ncol, const Int nlev, const Int reps) {
+  using SPAF    = spa::SPAFunctions<Real, DefaultDevice>;
+  using Spack   = SPAF::Spack;
+  using view_1d = SPAF::view_1d<Spack>;
+  using view_2d = SPAF::view_2d<Spack>;
+  using view_3d = SPAF::view_3d<Spack>;
+  using C       = scream::physics::Constants<Real>;
+
+  const Int nswbands = 14, nlwbands = 16;
+  const Int npack = ekat::npack<Spack>(nlev);
+
+  SPAF::SPATimeState time_state;
+  time_state.inited          = true;
+  time_state.current_month   = 0;
+  time_state.t_beg_month     = 0;
+  time_state.t_now           = 15;
+  time_state.days_this_month = 31;
+
+  // Hybrid coordinates, with the same levels for the source and target
+  view_1d hyam("hyam", npack), hybm("hybm", npack);
+  view_2d pmid("pmid", ncol, npack);
+  auto hyam_h = Kokkos::create_mirror_view(hyam);
+  auto hybm_h = Kokkos::create_mirror_view(hybm);
+  auto pmid_h = Kokkos::create_mirror_view(pmid);
+  for (Int k = 0; k < nlev; ++k) {
+    const Int kp = k / Spack::n, s = k % Spack::n;
+    const Real eta = (k+0.5)/nlev;
+    hyam_h(kp)[s] = 0.1*(1-eta)*eta;
+    hybm_h(kp)[s] = eta;
+    for (Int i = 0; i < ncol; ++i) {
+      pmid_h(i,kp)[s] = 0.99e5*hybm_h(kp)[s] + C::P0*hyam_h(kp)[s];
+    }
+  }
+  Kokkos::deep_copy(hyam, hyam_h);
+  Kokkos::deep_copy(hybm, hybm_h);
+  Kokkos::deep_copy(pmid, pmid_h);
+
+  SPAF::SPAPressureState pressure_state;
+  pressure_state.ncols = ncol;
+  pressure_state.nlevs = nlev;
+  pressure_state.hyam  = hyam;
+  pressure_state.hybm  = hybm;
+  pressure_state.pmid  = pmid;
+
+  SPAF::SPAData data_beg(ncol, nlev, nswbands, nlwbands);
+  SPAF::SPAData data_end(ncol, nlev, nswbands, nlwbands);
+  for (auto* data : {&data_beg, &data_end}) {
+    const Real f = data==&data_beg ? 1 : 2;
+    Kokkos::deep_copy(data->PS, f*1e5);
+    Kokkos::deep_copy(data->CCN3, Spack(f*100));
+    Kokkos::deep_copy(data->AER_G_SW, Spack(f*0.5));
+    Kokkos::deep_copy(data->AER_SSA_SW, Spack(f*0.4));
+    Kokkos::deep_copy(data->AER_TAU_SW, Spack(f*1e-3));
+    Kokkos::deep_copy(data->AER_TAU_LW, Spack(f*1e-4));
+  }
+
+  SPAF::SPAOutput data_out;
+  data_out.CCN3       = view_2d("CCN3", ncol, npack);
+  data_out.AER_G_SW   = view_3d("AER_G_SW", ncol, nswbands, npack);
+  data_out.AER_SSA_SW = view_3d("AER_SSA_SW", ncol, nswbands, npack);
+  data_out.AER_TAU_SW = view_3d("AER_TAU_SW", ncol, nswbands, npack);
+  data_out.AER_TAU_LW = view_3d("AER_TAU_LW", ncol, nlwbands, npack);
+
+  SPAF::SPAVertInterp vert_interp(ncol, nlev, nlev, nswbands, nlwbands);
+
+  Timings t;
+  for (Int r = -1; r < reps; ++r) {
+    Kokkos::fence();
+    const auto start = Clock::now();
+    SPAF::spa_main(time_state, pressure_state, data_beg, data_end, data_out,
+                   ncol, nlev, nswbands, nlwbands, vert_interp);
+    Kokkos::fence();
+    if (r >= 0) t.add(elapsed_s(start));
+  }
+
+  // Each of the 1+3*nswbands+nlwbands fields is read at two times, and written
+  // once, and pmid is read
+  const Int nfields = 1 + 3*nswbands + nlwbands;
+  const double bytes = (3*nfields+1)*double(ncol)*nlev*sizeof(Real);
+  return make_record("spa_main", ncol, nlev, t, bytes);
+}
+
+#ifdef SCREAM_PERF_HAS_RRTMGP
+// ----------------------------------------------------------------------------
+// RRTMGP
+// ----------------------------------------------------------------------------
+
+// rrtmgp_main (sw and lw fluxes) on the all-sky atmosphere of rrtmgp_tests.
+// The first profile of the input file is interpolated to nlev layers (in log
+// pressure for the pressures, which keeps them within the k-distribution
+// tables), and copied to all columns. Clouds are set as in rrtmgp_tests.
+Record bench_rrtmgp_main (const Int ncol, const Int nlev, const Int reps) {
+  const std::string inputfile = "./data/rrtmgp-allsky.nc";
+  const std::vector<std::string> gas_names = {"h2o", "co2", "o3", "n2o", "co", "ch4", "o2", "n2"};
+  const int ngas = gas_names.size();
+
+  // Read the first profile of the input file
+  simple_netcdf::SimpleNetCDF io;
+  io.open(inputfile, NC_NOWRITE);
+  const int nlay_in = io.getDimSize("lay");
+  io.close();
+
+  real2d p_lay_in("p_lay_in", 1, nlay_in);
+  real2d t_lay_in("t_lay_in", 1, nlay_in);
+  real2d p_lev_in("p_lev_in", 1, nlay_in+1);
+  real2d t_lev_in("t_lev_in", 1, nlay_in+1);
+  GasConcs gas_concs_in;
+  read_atmos(inputfile, p_lay_in, t_lay_in, p_lev_in, t_lev_in, gas_concs_in, 1);
+
+  const auto t_lay_in_h = t_lay_in.createHostCopy();
+  const auto p_lev_in_h = p_lev_in.createHostCopy();
+  const auto t_lev_in_h = t_lev_in.createHostCopy();
+  std::vector<realHost2d> vmr_in_h;
+  for (const auto& name : gas_names) {
+    real2d vmr("vmr", 1, nlay_in);
+    gas_concs_in.get_vmr(name, vmr);
+    vmr_in_h.push_back(vmr.createHostCopy());
+  }
+  gas_concs_in.reset();
+
+  // Linear interpolation of the n entries of a at the (0-based) fractional index x
+  const auto interp = [] (const realHost2d& a, const int n, const real x, const bool log_scale) {
+    const real xc = std::min(std::max(x, real(0)), real(n-1));
+    const int k = std::min(static_cast<int>(xc), n-2);
+    const real w = xc - k;
+    return log_scale ? std::exp((1-w)*std::log(a(1,k+1)) + w*std::log(a(1,k+2)))
+                     : (1-w)*a(1,k+1) + w*a(1,k+2);
+  };
+
+  realHost2d p_lay_h("p_lay", ncol, nlev);
+  realHost2d t_lay_h("t_lay", ncol, nlev);
+  realHost2d p_lev_h("p_lev", ncol, nlev+1);
+  realHost2d t_lev_h("t_lev", ncol, nlev+1);
+  std::vector<realHost2d> vmr_h;
+  for (int g = 0; g < ngas; ++g) {
+    vmr_h.push_back(realHost2d("vmr", ncol, nlev));
+  }
+  const real ratio = real(nlay_in)/nlev;
+  for (int icol = 1; icol <= ncol; ++icol) {
+    for (int ilev = 1; ilev <= nlev+1; ++ilev) {
+      const real x = (ilev-1)*ratio;
+      p_lev_h(icol,ilev) = interp(p_lev_in_h, nlay_in+1, x, true);
+      t_lev_h(icol,ilev) = interp(t_lev_in_h, nlay_in+1, x, false);
+    }
+    for (int ilay = 1; ilay <= nlev; ++ilay) {
+      const real x = (ilay-0.5)*ratio - 0.5;
+      p_lay_h(icol,ilay) = std::sqrt(p_lev_h(icol,ilay)*p_lev_h(icol,ilay+1));
+      t_lay_h(icol,ilay) = interp(t_lay_in_h, nlay_in, x, false);
+      for (int g = 0; g < ngas; ++g) {
+        vmr_h[g](icol,ilay) = interp(vmr_in_h[g], nlay_in, x, false);
+      }
+    }
+  }
+
+  real2d p_lay("p_lay", ncol, nlev);
+  real2d t_lay("t_lay", ncol, nlev);
+  real2d p_lev("p_lev", ncol, nlev+1);
+  real2d t_lev("t_lev", ncol, nlev+1);
+  p_lay_h.deep_copy_to(p_lay);
+  t_lay_h.deep_copy_to(t_lay);
+  p_lev_h.deep_copy_to(p_lev);
+  t_lev_h.deep_copy_to(t_lev);
+
+  string1d gas_names_1d("gas_names", ngas);
+  for (int g = 0; g < ngas; ++g) {
+    gas_names_1d(g+1) = gas_names[g];
+  }
+  GasConcs gas_concs;
+  gas_concs.init(gas_names_1d, ncol, nlev);
+  for (int g = 0; g < ngas; ++g) {
+    real2d vmr("vmr", ncol, nlev);
+    vmr_h[g].deep_copy_to(vmr);
+    gas_concs.set_vmr(gas_names[g], vmr);
+  }
+
+  // Only loads the lookup tables at the first call
+  rrtmgp::rrtmgp_initialize(gas_concs);
+
+  real1d sfc_alb_dir_vis("sfc_alb_dir_vis", ncol);
+  real1d sfc_alb_dir_nir("sfc_alb_dir_nir", ncol);
+  real1d sfc_alb_dif_vis("sfc_alb_dif_vis", ncol);
+  real1d sfc_alb_dif_nir("sfc_alb_dif_nir", ncol);
+  real1d mu0("mu0", ncol);
+  real2d lwp("lwp", ncol, nlev);
+  real2d iwp("iwp", ncol, nlev);
+  real2d rel("rel", ncol, nlev);
+  real2d rei("rei", ncol, nlev);
+  real2d cld("cld", ncol, nlev);
+  rrtmgpTest::dummy_atmos(inputfile, ncol, p_lay, t_lay,
+                          sfc_alb_dir_vis, sfc_alb_dir_nir,
+                          sfc_alb_dif_vis, sfc_alb_dif_nir,
+                          mu0, lwp, iwp, rel, rei, cld);
+
+  const int nswbands = rrtmgp::k_dist_sw.get_nband();
+  real2d sfc_alb_dir("sfc_alb_dir", ncol, nswbands);
+  real2d sfc_alb_dif("sfc_alb_dif", ncol, nswbands);
+  rrtmgp::compute_band_by_band_surface_albedos(ncol, nswbands,
+                                               sfc_alb_dir_vis, sfc_alb_dir_nir,
+                                               sfc_alb_dif_vis, sfc_alb_dif_nir,
+                                               sfc_alb_dir, sfc_alb_dif);
+
+  real2d sw_flux_up ("sw_flux_up",  ncol, nlev+1);
+  real2d sw_flux_dn ("sw_flux_dn",  ncol, nlev+1);
+  real2d sw_flux_dir("sw_flux_dir", ncol, nlev+1);
+  real2d lw_flux_up ("lw_flux_up",  ncol, nlev+1);
+  real2d lw_flux_dn ("lw_flux_dn",  ncol, nlev+1);
+
+  Timings t;
+  for (Int r = -1; r < reps; ++r) {
+    Kokkos::fence();
+    const auto start = Clock::now();
+    rrtmgp::rrtmgp_main(ncol, nlev, p_lay, t_lay, p_lev, t_lev, gas_concs,
+                        sfc_alb_dir, sfc_alb_dif, mu0, lwp, iwp, rel, rei,
+                        sw_flux_up, sw_flux_dn, sw_flux_dir, lw_flux_up, lw_flux_dn,
+                        false);
+    Kokkos::fence();
+    if (r >= 0) t.add(elapsed_s(start));
+  }
+  gas_concs.reset();
+
+  // Inputs: p/t at layers and interfaces, the gases, and the 4 cloud arrays.
+  // Outputs: the 5 fluxes. The work scales with the number of g-points, so
+  // this is an even looser bound than for the other benchmarks.
+  const double bytes = (2 + ngas + 4 + 2*(1+5))*double(ncol)*nlev*sizeof(real);
+  return make_record("rrtmgp_main", ncol, nlev, t, bytes);
+}
+#endif
+
+#ifdef SCREAM_PERF_HAS_HOMME
+// ----------------------------------------------------------------------------
+// Physics-dynamics remapper
+// ----------------------------------------------------------------------------
+
+// The number of levels is fixed by the dynamics lib, and the columns are the
+// GLL points of the ne x ne cubed sphere, with the smallest ne (but at least 2)
+// giving ncol columns or more.
+int homme_ne (const Int ncol) {
+  int ne = 2;
+  while (54*ne*ne+2 < ncol) ++ne;
+  return ne;
+}
+
+// Remap of the fields exchanged by the atm processes and homme (a 2d scalar, 3d
+// scalars and vectors, and the tracers) between the Physics GLL and Dynamics
+// grids, forward (phys->dyn) or backward.
+Record bench_homme_pd_remap (const Int ncol, const Int reps, const bool fwd) {
+  using namespace ShortFieldTagsNames;
+  using PackType = ekat::Pack<Homme::Real,HOMMEXX_VECTOR_SIZE>;
+  using FID = FieldIdentifier;
+  using FL  = FieldLayout;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  if (!is_parallel_inited_f90()) {
+    auto comm_f = MPI_Comm_c2f(MPI_COMM_WORLD);
+    init_parallel_f90(comm_f);
+  }
+  init_test_params_f90 ();
+
+  auto& c = Homme::Context::singleton();
+  auto& sp = c.create<Homme::SimulationParams>();
+  sp.qsize = HOMMEXX_QSIZE_D;
+  set_homme_param("ne",homme_ne(ncol));
+
+  ekat::ParameterList params;
+  params.set<std::string>("Reference Grid","Physics GLL");
+  DynamicsDrivenGridsManager gm(comm,params);
+  gm.build_grids(std::set<std::string>{"Physics GLL","Dynamics"});
+
+  auto phys_grid = gm.get_grid("Physics GLL");
+  auto dyn_grid  = gm.get_grid("Dynamics");
+
+  constexpr int np  = HOMMEXX_NP;
+  constexpr int NVL = HOMMEXX_NUM_PHYSICAL_LEV;
+  constexpr int NQ  = HOMMEXX_QSIZE_D;
+  const int nle = get_num_local_elems_f90();
+  const int nlc = get_num_local_columns_f90(0);
+  const auto units = ekat::units::m;
+  const auto dgn = dyn_grid->name();
+  const auto pgn = phys_grid->name();
+
+  // 2d scalar, 3d scalar, 3d vector and tracers
+  std::vector<Field<Real>> phys_fields = {
+    Field<Real>(FID("s_2d",  FL({COL          }, {nlc          }), units, pgn)),
+    Field<Real>(FID("s_3d",  FL({COL,      LEV}, {nlc,      NVL}), units, pgn)),
+    Field<Real>(FID("v_3d",  FL({COL, CMP, LEV}, {nlc,  2,  NVL}), units, pgn)),
+    Field<Real>(FID("tr_3d", FL({COL, CMP, LEV}, {nlc, NQ,  NVL}), units, pgn))
+  };
+  std::vector<Field<Real>> dyn_fields = {
+    Field<Real>(FID("s_2d",  FL({EL,          GP, GP     }, {nle,      np, np     }), units, dgn)),
+    Field<Real>(FID("s_3d",  FL({EL,          GP, GP, LEV}, {nle,      np, np, NVL}), units, dgn)),
+    Field<Real>(FID("v_3d",  FL({EL,     CMP, GP, GP, LEV}, {nle,  2,  np, np, NVL}), units, dgn)),
+    Field<Real>(FID("tr_3d", FL({EL,     CMP, GP, GP, LEV}, {nle, NQ,  np, np, NVL}), units, dgn))
+  };
+
+  auto remapper = gm.create_remapper(phys_grid,dyn_grid);
+  remapper->registration_begins();
+  double bytes = 0;
+  for (size_t n = 0; n < phys_fields.size(); ++n) {
+    for (auto* f : {&phys_fields[n], &dyn_fields[n]}) {
+      if (f->get_header().get_identifier().get_layout().has_tag(LEV)) {
+        f->get_header().get_alloc_properties().request_allocation<PackType>();
+      }
+      f->allocate_view();
+      bytes += f->get_header().get_identifier().get_layout().size()*sizeof(Real);
+    }
+    remapper->register_field(phys_fields[n], dyn_fields[n]);
+  }
+  remapper->registration_ends();
+
+  Timings t;
+  for (Int r = -1; r < reps; ++r) {
+    Kokkos::fence();
+    const auto start = Clock::now();
+    remapper->remap(fwd);
+    Kokkos::fence();
+    if (r >= 0) t.add(elapsed_s(start));
+  }
+
+  const Int ncol_global = get_num_global_columns_f90(0);
+
+  // Delete the remapper before cleaning up homme, since it has some MPI stuff in it
+  remapper = nullptr;
+  Homme::Context::finalize_singleton();
+  cleanup_test_f90();
+
+  return make_record(fwd ? "homme_pd_remap_fwd" : "homme_pd_remap_bwd", ncol_global, NVL, t, bytes);
+}
+#endif
+
+// ----------------------------------------------------------------------------
+// Driver
+// ----------------------------------------------------------------------------
+
+const std::vector<std::string>& all_benchmarks () {
+  static const std::vector<std::string> names = {
+    "p3_main", "p3_main_implicit_sed", "p3_rain_sed", "p3_rain_sed_implicit",
+    "shoc_main", "cld_fraction", "spa_main",
+#ifdef SCREAM_PERF_HAS_RRTMGP
+    "rrtmgp_main",
+#endif
+#ifdef SCREAM_PERF_HAS_HOMME
+    "homme_pd_remap_fwd", "homme_pd_remap_bwd",
+#endif
+  };
+  return names;
+}
+
+// Some benchmarks can't run on any ncol/nlev: return the sizes they actually
+// run on for the requested ones.
+std::pair<Int,Int> actual_sizes (const std::string& name, const Int ncol, const Int nlev) {
+#ifdef SCREAM_PERF_HAS_HOMME
+  if (name == "homme_pd_remap_fwd" || name == "homme_pd_remap_bwd") {
+    const int ne = homme_ne(ncol);
+    return {54*ne*ne+2, HOMMEXX_NUM_PHYSICAL_LEV};
+  }
+#endif
+  return {ncol, nlev};
+}
+
+Record run_benchmark (const std::string& name, const Int ncol, const Int nlev, const Int reps) {
+  if (name == "p3_main")              return bench_p3_main(ncol, nlev, reps, false);
+  if (name == "p3_main_implicit_sed") return bench_p3_main(ncol, nlev, reps, true);
+  if (name == "p3_rain_sed")          return bench_p3_rain_sed(ncol, nlev, reps, false);
+  if (name == "p3_rain_sed_implicit") return bench_p3_rain_sed(ncol, nlev, reps, true);
+  if (name == "shoc_main")            return bench_shoc_main(ncol, nlev, reps);
+  if (name == "cld_fraction")         return bench_cld_fraction(ncol, nlev, reps);
+  if (name == "spa_main")             return bench_spa_main(ncol, nlev, reps);
+#ifdef SCREAM_PERF_HAS_RRTMGP
+  if (name == "rrtmgp_main")          return bench_rrtmgp_main(ncol, nlev, reps);
+#endif
+#ifdef SCREAM_PERF_HAS_HOMME
+  if (name == "homme_pd_remap_fwd")   return bench_homme_pd_remap(ncol, reps, true);
+  if (name == "homme_pd_remap_bwd")   return bench_homme_pd_remap(ncol, reps, false);
+#endif
+  EKAT_ERROR_MSG("Unknown benchmark '" << name << "'.");
+  return Record();
+}
+
+void write_json (std::ostream& os, const std::vector<Record>& records, const int nthreads) {
+  os << "{\n"
+     << "  \"version\": \"" << SCREAM_PERF_GIT_SHA << "\",\n"
+     << "  \"exec_space\": \"" << Kokkos::DefaultExecutionSpace::name() << "\",\n"
+     << "  \"concurrency\": " << nthreads << ",\n"
+     << "  \"real_size\": " << sizeof(Real) << ",\n"
+     << "  \"pack_size\": " << SCREAM_PACK_SIZE << ",\n"
+     << "  \"small_pack_size\": " << SCREAM_SMALL_PACK_SIZE << ",\n"
+     << "  \"benchmarks\": [\n";
+  for (size_t i = 0; i < records.size(); ++i) {
+    const auto& r = records[i];
+    const double colslevs = double(r.ncol)*r.nlev;
+    // A call may be faster than the clock resolution
+    const double inv_mean = r.mean_s > 0 ? 1/r.mean_s : 0;
+    os << "    {\"name\": \"" << r.name << "\""
+       << ", \"ncol\": " << r.ncol
+       << ", \"nlev\": " << r.nlev
+       << ", \"reps\": " << r.reps
+       << ", \"mean_s\": " << r.mean_s
+       << ", \"min_s\": " << r.min_s
+       << ", \"throughput_collev_per_s\": " << colslevs*inv_mean
+       << ", \"bytes\": " << r.bytes
+       << ", \"bandwidth_GBps\": " << 1e-9*r.bytes*inv_mean
+       << "}" << (i+1 < records.size() ? "," : "") << "\n";
+  }
+  os << "  ]\n"
+     << "}\n";
+}
+
+std::vector<Int> parse_int_list (const std::string& s) {
+  std::vector<Int> list;
+  for (const auto& item : ekat::split(s, ',')) {
+    list.push_back(std::stoi(item));
+    EKAT_REQUIRE_MSG(list.back() > 0, "Sizes must be positive, got " << item);
+  }
+  return list;
+}
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  std::vector<Int> ncols = {64, 1024};
+  std::vector<Int> nlevs = {72, 128};
+  Int repeat = 10;
+  std::string out_file;
+  std::vector<std::string> names = all_benchmarks();
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-h", "--help")) {
+      std::cout <<
+        argv[0] << " [options]\n"
+        "Options:\n"
+        "  -i <ncol,...>   Comma-separated list of numbers of columns. Default=64,1024.\n"
+        "  -k <nlev,...>   Comma-separated list of numbers of levels. Default=72,128.\n"
+        "  -r <repeat>     Number of timed repetitions. Default=10.\n"
+        "  -b <name,...>   Comma-separated list of benchmarks to run. Default=all:\n"
+        "                  ";
+      for (const auto& name : all_benchmarks()) std::cout << name << " ";
+      std::cout << "\n"
+        "  -o <file>       Write the JSON results to file. Default=scream_perf_<concurrency>.json\n";
+      return 0;
+    }
+    if (ekat::argv_matches(argv[i], "-i", "--ncol")) {
+      expect_another_arg(i, argc);
+      ++i;
+      ncols = parse_int_list(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-k", "--nlev")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nlevs = parse_int_list(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      ++i;
+      repeat = std::atoi(argv[i]);
+      EKAT_REQUIRE_MSG(repeat > 0, "Number of repetitions must be positive.");
+    }
+    if (ekat::argv_matches(argv[i], "-b", "--bench")) {
+      expect_another_arg(i, argc);
+      ++i;
+      names = ekat::split(std::string(argv[i]), ',');
+    }
+    if (ekat::argv_matches(argv[i], "-o", "--output")) {
+      expect_another_arg(i, argc);
+      ++i;
+      out_file = argv[i];
+    }
+  }
+
+  // The homme benchmarks need MPI, which the scream session does not init
+  MPI_Init(&argc, &argv);
+
+  // Decorate the kokkos args with the ones from the scream session
+  std::vector<char*> args;
+  for (int i=0; i<argc; ++i) args.push_back(argv[i]);
+
+  scream::initialize_scream_session(args.size(), args.data()); {
+    const int nthreads = Kokkos::DefaultExecutionSpace().concurrency();
+    if (out_file.empty()) {
+      out_file = "scream_perf_" + std::to_string(nthreads) + ".json";
+    }
+
+    std::vector<Record> records;
+    for (const auto& name : names) {
+      std::set<std::pair<Int,Int>> done;
+      for (const auto ncol : ncols) {
+        for (const auto nlev : nlevs) {
+          const auto sizes = actual_sizes(name, ncol, nlev);
+          if (!done.insert(sizes).second) continue;
+          records.push_back(run_benchmark(name, sizes.first, sizes.second, repeat));
+          const auto& r = records.back();
+          std::cout << r.name << " ncol=" << r.ncol << " nlev=" << r.nlev
+                    << ": " << r.mean_s << " s, "
+                    << (r.mean_s > 0 ? double(r.ncol)*r.nlev/r.mean_s : 0) << " collev/s\n";
+        }
+      }
+    }
+
+    std::ofstream ofs(out_file);
+    EKAT_REQUIRE_MSG(ofs.good(), "Could not open " << out_file << " for writing.");
+    write_json(ofs, records, nthreads);
+    std::cout << "Results written to " << out_file << "\n";
+
+    scream::p3::P3GlobalForFortran::deinit();
+#ifdef SCREAM_PERF_HAS_RRTMGP
+    if (scream::rrtmgp::initialized) {
+      scream::rrtmgp::rrtmgp_finalize();
+    }
+    if (yakl::isInitialized()) {
+      yakl::finalize();
+    }
+#endif
+  } scream::finalize_scream_session();
+  MPI_Finalize();
+
+  return 0;
+}